@@ -0,0 +1,565 @@
+//*****************************************************************************
+// bsp.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// The parts of BSP.c the program uses, for the host port: the microphone
+// plays WAV files, the LCD draws into a frame buffer, the buttons follow a
+// script, and the trace UART writes to a file.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "host.h"
+#include "BSP.h"
+
+#define MAXFILES  1024       // sound files queued
+#define MICFIFOSIZE 256      // samples kept for BSP_Microphone_Get, as BSP.c
+
+static uint32_t ClockFrequency = 16000000; // cycles/second, as BSP.c
+
+//******** BUTTONS ********\\
+
+double Presses[2][HOST_MAXPRESSES]; // simulated seconds of each scripted press
+int NumPresses[2];
+
+int Host_ButtonPress(int button, double seconds){
+  int b = button - 1;
+  if((b < 0) || (b > 1) || (NumPresses[b] == HOST_MAXPRESSES)){
+    return 0;
+  }
+  Presses[b][NumPresses[b]++] = seconds;
+  return 1;
+}
+
+static int pressed(int b){
+  double t = (double)Host_Cycles()/ClockFrequency;
+  int i;
+  for(i = 0; i < NumPresses[b]; i++){
+    if((t >= Presses[b][i]) && (t < Presses[b][i] + HOST_PRESS)){
+      return 1;
+    }
+  }
+  return 0;
+}
+
+void BSP_Button1_Init(void){
+}
+
+uint8_t BSP_Button1_Input(void){
+  return pressed(0) ? 0 : 0x40;    // 0 if pressed, as PD6
+}
+
+void BSP_Button2_Init(void){
+}
+
+uint8_t BSP_Button2_Input(void){
+  return pressed(1) ? 0 : 0x80;    // 0 if pressed, as PD7
+}
+
+//******** RGB LED ********\\
+
+uint16_t Red, Green, Blue;   // 10-bit duty cycles, not shown
+
+void BSP_RGB_Init(uint16_t red, uint16_t green, uint16_t blue){
+  BSP_RGB_Set(red, green, blue);
+}
+
+void BSP_RGB_Set(uint16_t red, uint16_t green, uint16_t blue){
+  Red = red;
+  Green = green;
+  Blue = blue;
+}
+
+//******** MICROPHONE ********\\
+
+const char *Files[MAXFILES]; // queued sound files, played in order
+uint32_t FileRates[MAXFILES]; // their sample rates in Hz
+int NumFiles;
+int NextFile;
+FILE *Wav;                   // file being played, 0 before the first
+uint32_t WavLeft;            // bytes of samples left in it
+uint32_t WavChannels;
+uint32_t WavRate;            // samples per second of the file opened last
+uint32_t WavBits;            // 8 or 16
+uint64_t Samples;            // samples played
+uint32_t MicRate;            // samples per second, 0 until BSP_Microphone_Start
+uint64_t MicStart;           // Host_Cycles at BSP_Microphone_Start
+uint64_t MicTaken;           // samples taken or lost since then
+
+static uint32_t le(const unsigned char *p, int n){
+  uint32_t v = 0;
+  while(n--){
+    v = (v<<8) | p[n];
+  }
+  return v;
+}
+
+// opens a WAV file and finds its samples, 0 if it is not PCM
+static int wavOpen(const char *name){
+  unsigned char h[40];
+  uint32_t size, format = 0;
+  Wav = fopen(name, "rb");
+  if((Wav == 0) || (fread(h, 1, 12, Wav) != 12) ||
+     (memcmp(h, "RIFF", 4) != 0) || (memcmp(&h[8], "WAVE", 4) != 0)){
+    return 0;
+  }
+  while(fread(h, 1, 8, Wav) == 8){ // chunks, padded to an even size
+    size = le(&h[4], 4);
+    if(memcmp(h, "fmt ", 4) == 0){
+      if((size < 16) || (size > sizeof(h)) || (fread(h, 1, size, Wav) != size)){
+        return 0;
+      }
+      format = le(h, 2);
+      WavChannels = le(&h[2], 2);
+      WavRate = le(&h[4], 4);
+      WavBits = le(&h[14], 2);
+      if(size & 1){
+        fgetc(Wav);
+      }
+    }else if(memcmp(h, "data", 4) == 0){
+      WavLeft = size;
+      return ((format == 1) || (format == 0xFFFE)) && (WavChannels > 0) &&
+             ((WavBits == 8) || (WavBits == 16));
+    }else if(fseek(Wav, size + (size & 1), SEEK_CUR) != 0){
+      return 0;
+    }
+  }
+  return 0;
+}
+
+int Host_MicOpen(const char *name){
+  if(NumFiles == MAXFILES){
+    return 0;
+  }
+  if(wavOpen(name) == 0){
+    if(Wav){
+      fclose(Wav);
+      Wav = 0;
+    }
+    return 0;
+  }
+  fclose(Wav);
+  Wav = 0;
+  FileRates[NumFiles] = WavRate;
+  Files[NumFiles++] = name;
+  return 1;
+}
+
+uint64_t Host_MicSamples(void){
+  return Samples;
+}
+
+void BSP_Microphone_Init(void){
+}
+
+// the next sample of the first channel, 0 to 1023 like the ADC, the
+// simulation ends after the last sample of the last file
+static void wavSample(uint16_t *mic){
+  unsigned char s[2*8];
+  uint32_t frame;
+  while((Wav == 0) || (WavLeft < WavChannels*WavBits/8)){
+    if(Wav){
+      fclose(Wav);
+      Wav = 0;
+    }
+    if(NextFile == NumFiles){
+      Host_Exit("end of sound", 0);
+    }
+    wavOpen(Files[NextFile++]);
+  }
+  frame = WavChannels*WavBits/8;
+  if(frame > sizeof(s)){           // more channels than kept, read the first
+    fread(s, 1, WavBits/8, Wav);
+    fseek(Wav, frame - WavBits/8, SEEK_CUR);
+  }else{
+    fread(s, 1, frame, Wav);
+  }
+  WavLeft = WavLeft - frame;
+  if(WavBits == 8){
+    *mic = (uint16_t)s[0]<<2;      // unsigned
+  }else{
+    *mic = (uint16_t)((le(s, 2) ^ 0x8000)>>6); // signed to offset binary
+  }
+  Samples++;
+}
+
+void BSP_Microphone_Input(uint16_t *mic){
+  wavSample(mic);
+}
+
+// the files must be recorded at the rate the program samples at, as
+// nothing resamples them
+void BSP_Microphone_Start(uint32_t freq, uint8_t priority){
+  int i;
+  for(i = 0; i < NumFiles; i++){
+    if(FileRates[i] != freq){
+      fprintf(stderr, "bsp: %s is sampled at %u Hz, the microphone at %u Hz\n",
+              Files[i], FileRates[i], freq);
+      exit(1);
+    }
+  }
+  MicRate = freq;
+  MicStart = Host_Cycles();
+  MicTaken = 0;
+}
+
+// the samples converted by now on the simulated clock; a FIFO overflow
+// loses the oldest here rather than the newest as on the board, which
+// only a thread missing several ticks would see
+int BSP_Microphone_Get(uint16_t *mic){
+  uint64_t due;
+  if(MicRate == 0){
+    return 0;
+  }
+  due = (Host_Cycles() - MicStart)*MicRate/ClockFrequency;
+  while(due - MicTaken > MICFIFOSIZE){
+    wavSample(mic);
+    MicTaken++;
+  }
+  if(MicTaken == due){
+    return 0;
+  }
+  wavSample(mic);
+  MicTaken++;
+  return 1;
+}
+
+//******** LCD ********\\
+
+uint16_t Host_Frame[HOST_LCDSIZE][HOST_LCDSIZE];
+uint32_t StX, StY;           // text cursor, columns 0 to 20, rows 0 to 12
+int TimeIndex;               // plot column, 0 to 99
+int32_t Ymax, Ymin, Yrange;  // plot vertical axis
+uint16_t PlotBGColor;
+
+// standard ascii 5x7 font, ' ' to '~' of Font in BSP.c
+static const uint8_t Font[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x07, 0x00,
+  0x14, 0x7F, 0x14, 0x7F, 0x14,
+  0x24, 0x2A, 0x7F, 0x2A, 0x12,
+  0x23, 0x13, 0x08, 0x64, 0x62,
+  0x36, 0x49, 0x56, 0x20, 0x50,
+  0x00, 0x08, 0x07, 0x03, 0x00,
+  0x00, 0x1C, 0x22, 0x41, 0x00,
+  0x00, 0x41, 0x22, 0x1C, 0x00,
+  0x2A, 0x1C, 0x7F, 0x1C, 0x2A,
+  0x08, 0x08, 0x3E, 0x08, 0x08,
+  0x00, 0x80, 0x70, 0x30, 0x00,
+  0x08, 0x08, 0x08, 0x08, 0x08,
+  0x00, 0x00, 0x60, 0x60, 0x00,
+  0x20, 0x10, 0x08, 0x04, 0x02,
+  0x3E, 0x51, 0x49, 0x45, 0x3E, // 0
+  0x00, 0x42, 0x7F, 0x40, 0x00, // 1
+  0x72, 0x49, 0x49, 0x49, 0x46, // 2
+  0x21, 0x41, 0x49, 0x4D, 0x33, // 3
+  0x18, 0x14, 0x12, 0x7F, 0x10, // 4
+  0x27, 0x45, 0x45, 0x45, 0x39, // 5
+  0x3C, 0x4A, 0x49, 0x49, 0x31, // 6
+  0x41, 0x21, 0x11, 0x09, 0x07, // 7
+  0x36, 0x49, 0x49, 0x49, 0x36, // 8
+  0x46, 0x49, 0x49, 0x29, 0x1E, // 9
+  0x00, 0x00, 0x14, 0x00, 0x00,
+  0x00, 0x40, 0x34, 0x00, 0x00,
+  0x00, 0x08, 0x14, 0x22, 0x41,
+  0x14, 0x14, 0x14, 0x14, 0x14,
+  0x00, 0x41, 0x22, 0x14, 0x08,
+  0x02, 0x01, 0x59, 0x09, 0x06,
+  0x3E, 0x41, 0x5D, 0x59, 0x4E,
+  0x7C, 0x12, 0x11, 0x12, 0x7C, // A
+  0x7F, 0x49, 0x49, 0x49, 0x36, // B
+  0x3E, 0x41, 0x41, 0x41, 0x22, // C
+  0x7F, 0x41, 0x41, 0x41, 0x3E, // D
+  0x7F, 0x49, 0x49, 0x49, 0x41, // E
+  0x7F, 0x09, 0x09, 0x09, 0x01, // F
+  0x3E, 0x41, 0x41, 0x51, 0x73, // G
+  0x7F, 0x08, 0x08, 0x08, 0x7F, // H
+  0x00, 0x41, 0x7F, 0x41, 0x00, // I
+  0x20, 0x40, 0x41, 0x3F, 0x01, // J
+  0x7F, 0x08, 0x14, 0x22, 0x41, // K
+  0x7F, 0x40, 0x40, 0x40, 0x40, // L
+  0x7F, 0x02, 0x1C, 0x02, 0x7F, // M
+  0x7F, 0x04, 0x08, 0x10, 0x7F, // N
+  0x3E, 0x41, 0x41, 0x41, 0x3E, // O
+  0x7F, 0x09, 0x09, 0x09, 0x06, // P
+  0x3E, 0x41, 0x51, 0x21, 0x5E, // Q
+  0x7F, 0x09, 0x19, 0x29, 0x46, // R
+  0x26, 0x49, 0x49, 0x49, 0x32, // S
+  0x03, 0x01, 0x7F, 0x01, 0x03, // T
+  0x3F, 0x40, 0x40, 0x40, 0x3F, // U
+  0x1F, 0x20, 0x40, 0x20, 0x1F, // V
+  0x3F, 0x40, 0x38, 0x40, 0x3F, // W
+  0x63, 0x14, 0x08, 0x14, 0x63, // X
+  0x03, 0x04, 0x78, 0x04, 0x03, // Y
+  0x61, 0x59, 0x49, 0x4D, 0x43, // Z
+  0x00, 0x7F, 0x41, 0x41, 0x41,
+  0x02, 0x04, 0x08, 0x10, 0x20,
+  0x00, 0x41, 0x41, 0x41, 0x7F,
+  0x04, 0x02, 0x01, 0x02, 0x04,
+  0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x03, 0x07, 0x08, 0x00,
+  0x20, 0x54, 0x54, 0x78, 0x40, // a
+  0x7F, 0x28, 0x44, 0x44, 0x38, // b
+  0x38, 0x44, 0x44, 0x44, 0x28, // c
+  0x38, 0x44, 0x44, 0x28, 0x7F, // d
+  0x38, 0x54, 0x54, 0x54, 0x18, // e
+  0x00, 0x08, 0x7E, 0x09, 0x02, // f
+  0x18, 0xA4, 0xA4, 0x9C, 0x78, // g
+  0x7F, 0x08, 0x04, 0x04, 0x78, // h
+  0x00, 0x44, 0x7D, 0x40, 0x00, // i
+  0x20, 0x40, 0x40, 0x3D, 0x00, // j
+  0x7F, 0x10, 0x28, 0x44, 0x00, // k
+  0x00, 0x41, 0x7F, 0x40, 0x00, // l
+  0x7C, 0x04, 0x78, 0x04, 0x78, // m
+  0x7C, 0x08, 0x04, 0x04, 0x78, // n
+  0x38, 0x44, 0x44, 0x44, 0x38, // o
+  0xFC, 0x18, 0x24, 0x24, 0x18, // p
+  0x18, 0x24, 0x24, 0x18, 0xFC, // q
+  0x7C, 0x08, 0x04, 0x04, 0x08, // r
+  0x48, 0x54, 0x54, 0x54, 0x24, // s
+  0x04, 0x04, 0x3F, 0x44, 0x24, // t
+  0x3C, 0x40, 0x40, 0x20, 0x7C, // u
+  0x1C, 0x20, 0x40, 0x20, 0x1C, // v
+  0x3C, 0x40, 0x30, 0x40, 0x3C, // w
+  0x44, 0x28, 0x10, 0x28, 0x44, // x
+  0x4C, 0x90, 0x90, 0x90, 0x7C, // y
+  0x44, 0x64, 0x54, 0x4C, 0x44, // z
+  0x00, 0x08, 0x36, 0x41, 0x00,
+  0x00, 0x00, 0x77, 0x00, 0x00,
+  0x00, 0x41, 0x36, 0x08, 0x00,
+  0x02, 0x01, 0x02, 0x04, 0x02,
+};
+
+void BSP_LCD_Init(void){
+  BSP_LCD_FillScreen(LCD_BLACK);
+  StX = 0;
+  StY = 0;
+}
+
+void BSP_LCD_DrawPixel(int16_t x, int16_t y, uint16_t color){
+  if((x >= 0) && (x < HOST_LCDSIZE) && (y >= 0) && (y < HOST_LCDSIZE)){
+    Host_Frame[y][x] = color;
+  }
+}
+
+void BSP_LCD_DrawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color){
+  BSP_LCD_FillRect(x, y, 1, h, color);
+}
+
+void BSP_LCD_DrawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color){
+  BSP_LCD_FillRect(x, y, w, 1, color);
+}
+
+void BSP_LCD_FillScreen(uint16_t color){
+  BSP_LCD_FillRect(0, 0, HOST_LCDSIZE, HOST_LCDSIZE, color);
+}
+
+void BSP_LCD_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+  int16_t i, j;
+  for(j = y; j < y + h; j++){
+    for(i = x; i < x + w; i++){
+      BSP_LCD_DrawPixel(i, j, color);
+    }
+  }
+}
+
+uint16_t BSP_LCD_Color565(uint8_t r, uint8_t g, uint8_t b){
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+uint16_t BSP_LCD_SwapColor(uint16_t x){
+  return (x << 11) | (x & 0x07E0) | (x >> 11);
+}
+
+// a 6 by 8 cell, the character in the top left 5 by 7
+void BSP_LCD_DrawChar(int16_t x, int16_t y, char c, int16_t textColor, int16_t bgColor, uint8_t size){
+  const uint8_t *glyph;
+  int32_t col, row;
+  if(((x + 6*size - 1) >= HOST_LCDSIZE) || ((y + 8*size - 1) >= HOST_LCDSIZE) ||
+     ((x + 6*size - 1) < 0) || ((y + 8*size - 1) < 0)){
+    return;                          // clipped whole, as BSP.c
+  }
+  if((c < ' ') || (c > '~')){
+    c = ' ';
+  }
+  glyph = &Font[(c - ' ')*5];
+  for(row = 0; row < 8; row++){
+    for(col = 0; col < 6; col++){
+      BSP_LCD_FillRect(x + col*size, y + row*size, size, size,
+                       ((col < 5) && (glyph[col] & (1<<row))) ? textColor : bgColor);
+    }
+  }
+}
+
+uint32_t BSP_LCD_DrawString(uint16_t x, uint16_t y, char *pt, int16_t textColor){
+  uint32_t count = 0;
+  if(y > 12){
+    return 0;
+  }
+  while(*pt){
+    BSP_LCD_DrawChar(x*6, y*10, *pt, textColor, LCD_BLACK, 1);
+    pt++;
+    x = x + 1;
+    if(x > 20){
+      return count;
+    }
+    count++;
+  }
+  return count;
+}
+
+void BSP_LCD_SetCursor(uint32_t newX, uint32_t newY){
+  if((newX > 20) || (newY > 12)){
+    return;
+  }
+  StX = newX;
+  StY = newY;
+}
+
+// prints at the cursor and moves it on, a red * in the last column if it overflows
+static void outString(char *s, uint32_t width, int16_t textColor){
+  BSP_LCD_DrawString(StX, StY, s, textColor);
+  StX = StX + width;
+  if(StX > 20){
+    StX = 20;
+    BSP_LCD_DrawChar(StX*6, StY*10, '*', LCD_RED, LCD_BLACK, 1);
+  }
+}
+
+void BSP_LCD_OutUDec(uint32_t n, int16_t textColor){
+  char s[12];
+  outString(s, sprintf(s, "%u", n), textColor);
+}
+
+void BSP_LCD_OutUDec4(uint32_t n, int16_t textColor){
+  char s[12];
+  outString(s, sprintf(s, "%4u", (n > 9999) ? 9999 : n), textColor);
+}
+
+void BSP_LCD_OutUDec5(uint32_t n, int16_t textColor){
+  char s[12];
+  outString(s, sprintf(s, "%5u", (n > 99999) ? 99999 : n), textColor);
+}
+
+void BSP_LCD_OutUFix2_1(uint32_t n, int16_t textColor){
+  char s[12];
+  if(n > 999){
+    n = 999;
+  }
+  sprintf(s, "%2u.%u", n/10, n%10);
+  outString(s, 4, textColor);
+}
+
+void BSP_LCD_OutUHex2(uint32_t n, int16_t textColor){
+  char s[12];
+  if(n > 255){
+    strcpy(s, "**,");
+  }else{
+    sprintf(s, "%02X,", n);
+  }
+  outString(s, 3, textColor);
+}
+
+void BSP_LCD_Drawaxes(uint16_t axisColor, uint16_t bgColor, char *xLabel,
+  char *yLabel1, uint16_t label1Color, char *yLabel2, uint16_t label2Color,
+  int32_t ymax, int32_t ymin){
+  int i;
+  Ymax = ymax;
+  Ymin = ymin;
+  Yrange = Ymax - Ymin;
+  TimeIndex = 0;
+  PlotBGColor = bgColor;
+  BSP_LCD_FillRect(0, 17, 111, 111, bgColor);
+  BSP_LCD_DrawFastHLine(10, 117, 101, axisColor);
+  BSP_LCD_DrawFastVLine(10, 17, 101, axisColor);
+  for(i = 20; i <= 110; i = i + 10){
+    BSP_LCD_DrawPixel(i, 118, axisColor);
+  }
+  for(i = 17; i < 117; i = i + 10){
+    BSP_LCD_DrawPixel(9, i, axisColor);
+  }
+  for(i = 50; (*xLabel) && (i < 100); i = i + 6){
+    BSP_LCD_DrawChar(i, 120, *xLabel++, axisColor, bgColor, 1);
+  }
+  if(*yLabel2){ // two labels
+    for(i = 26; (*yLabel2) && (i < 50); i = i + 8){
+      BSP_LCD_DrawChar(0, i, *yLabel2++, label2Color, bgColor, 1);
+    }
+    i = 82;
+  }else{ // one label
+    i = 42;
+  }
+  for(; (*yLabel1) && (i < 120); i = i + 8){
+    BSP_LCD_DrawChar(0, i, *yLabel1++, label1Color, bgColor, 1);
+  }
+}
+
+void BSP_LCD_PlotPoint(int32_t data1, uint16_t color1){
+  data1 = ((data1 - Ymin)*100)/Yrange;
+  if(data1 > 98){
+    data1 = 98;
+    color1 = LCD_RED;
+  }
+  if(data1 < 0){
+    data1 = 0;
+    color1 = LCD_RED;
+  }
+  BSP_LCD_DrawPixel(TimeIndex + 11, 116 - data1, color1);
+  BSP_LCD_DrawPixel(TimeIndex + 11, 115 - data1, color1);
+}
+
+void BSP_LCD_PlotIncrement(void){
+  TimeIndex = TimeIndex + 1;
+  if(TimeIndex > 99){
+    TimeIndex = 0;
+  }
+  BSP_LCD_DrawFastVLine(TimeIndex + 11, 17, 100, PlotBGColor);
+}
+
+int Host_LCDSave(const char *name){
+  FILE *f = fopen(name, "wb");
+  uint16_t c;
+  int x, y;
+  if(f == 0){
+    return 0;
+  }
+  fprintf(f, "P6\n%d %d\n255\n", HOST_LCDSIZE, HOST_LCDSIZE);
+  for(y = 0; y < HOST_LCDSIZE; y++){
+    for(x = 0; x < HOST_LCDSIZE; x++){
+      c = Host_Frame[y][x];
+      fputc(((c>>11)&0x1F)*255/31, f);
+      fputc(((c>>5)&0x3F)*255/63, f);
+      fputc((c&0x1F)*255/31, f);
+    }
+  }
+  return fclose(f) == 0;
+}
+
+//******** CLOCK ********\\
+
+void BSP_Clock_InitFastest(void){
+  ClockFrequency = 80000000;
+}
+
+uint32_t BSP_Clock_GetFreq(void){
+  return ClockFrequency;
+}
+
+//******** TRACE UART ********\\
+
+FILE *Uart;                  // trace dumps, 0 to drop them
+
+int Host_UartOpen(const char *name){
+  if(name == 0){
+    return 1;
+  }
+  Uart = fopen(name, "ab");
+  return Uart != 0;
+}
+
+void Host_UartOut(uint32_t byte){
+  if(Uart){
+    fputc(byte, Uart);
+  }
+}
@@ -0,0 +1,348 @@
+//*****************************************************************************
+// hal.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Simulated processor for the host port: registers, SysTick, interrupt
+// mask, thread contexts and the functions of osasm.s and the startup file.
+
+// os.c builds each thread's initial stack with the PC in a stack word,
+// which is pointer sized with HOST defined, so the program may be linked
+// position independent like any other.
+
+#define _XOPEN_SOURCE 700
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <ucontext.h>
+#include "host.h"
+#include "BSP.h"
+#include "CortexM.h"
+#include "hw_memmap.h"
+#include "hw_sysctl.h"
+#include "hw_watchdog.h"
+
+#define NUMREGS     64           // registers used by the program
+#define NUMCONTEXTS 8            // foreground threads and the idle thread
+#define CONTEXTSTACK (1<<20)     // host stack of each thread in bytes
+#define PCWORD      14           // initial PC, above R4-R11, R0-R3, R12 and LR at the saved sp
+#define PENDSTSET   0x04000000   // INTCTRL bits
+#define PENDSTCLR   0x02000000
+#define COUNTFLAG   0x00010000   // STCTRL bit, cleared when read
+
+struct tcb;                      // os.c, its first member is the saved sp
+extern struct tcb *RunPt;
+void Scheduler(void);
+
+// a register, the program reads and writes port, which is compared with
+// what it was last shown at each host call to find the writes; a write of
+// the value just read is missed, which none of the registers modelled mind
+struct reg{
+  uint32_t address;
+  uint32_t value;              // registers without a model keep what was written
+  volatile uint32_t port;
+  uint32_t shown;
+};
+struct reg Regs[NUMREGS];
+uint32_t NumRegs;
+
+struct context{
+  struct tcb *tcb;
+  ucontext_t uc;
+  void(*task)(void);
+};
+struct context Contexts[NUMCONTEXTS];
+uint32_t NumContexts;
+
+uint64_t Now;                  // simulated bus cycles
+uint32_t Primask;              // 1 while interrupts are disabled
+uint32_t Pending;              // SysTick pending
+uint32_t Active;               // 1 while the SysTick handler runs, it does not nest
+uint32_t StCtrl;               // enable, interrupt and clock source bits
+uint32_t StCountFlag;
+uint32_t StReload;
+uint64_t StNext;               // Now when the SysTick count next reaches 0
+uint32_t StCurrent;            // count while SysTick is off
+uint32_t CycBase;              // DWT_CYCCNT is Now - CycBase
+uint32_t WdtLoad;
+uint64_t WdtFed;               // Now at the latest load of watchdog timer 0
+int WdtOn;
+
+static void fail(const char *msg){
+  fprintf(stderr, "hal: %s\n", msg);
+  exit(1);
+}
+
+// reading a register, with the side effects of a read
+static uint32_t regRead(struct reg *r){
+  uint32_t v;
+  switch(r->address){
+    case 0xE000E010:             // STCTRL
+      v = StCtrl | (StCountFlag ? COUNTFLAG : 0);
+      StCountFlag = 0;
+      return v;
+    case 0xE000E014:             // STRELOAD
+      return StReload;
+    case 0xE000E018:             // STCURRENT, cycles to the next time it reaches 0
+      return (StCtrl & 1) ? (uint32_t)(StNext - Now) : StCurrent;
+    case 0xE000ED04:             // INTCTRL
+      return Pending ? PENDSTSET : 0;
+    case 0xE0001004:             // DWT_CYCCNT
+      return (uint32_t)Now - CycBase;
+    case WATCHDOG0_BASE + WDT_O_LOAD:
+      return 0xFFFFFFFF;         // never written, so every load is seen
+  }
+  if((r->address & 0xFFFFFF00) == (SYSCTL_PRWD & 0xFFFFFF00)){
+    return 0xFFFFFFFF;           // peripheral ready registers, ready at once
+  }
+  return r->value;
+}
+
+static void regWrite(struct reg *r, uint32_t v){
+  r->value = v;
+  switch(r->address){
+    case 0xE000E010:
+      if(((StCtrl & 1) == 0) && (v & 1)){ // counts from the reload
+        StNext = Now + StReload + 1;
+      }
+      StCtrl = v & 7;
+      break;
+    case 0xE000E014:
+      StReload = v & 0x00FFFFFF;
+      break;
+    case 0xE000E018:             // clears the count, the reload comes next cycle
+      StCountFlag = 0;
+      StCurrent = 0;
+      StNext = Now + StReload + 1;
+      break;
+    case 0xE000ED04:
+      if(v & PENDSTSET){
+        Pending = 1;
+      }
+      if(v & PENDSTCLR){
+        Pending = 0;
+      }
+      break;
+    case 0xE0001004:
+      CycBase = (uint32_t)Now - v;
+      break;
+    case WATCHDOG0_BASE + WDT_O_LOAD:
+      WdtLoad = v;
+      WdtFed = Now;
+      break;
+    case WATCHDOG0_BASE + WDT_O_CTL:
+      WdtOn = (v & WDT_CTL_RESEN) != 0;
+      break;
+  }
+}
+
+// applies what the program wrote to the ports
+static void sync(void){
+  struct reg *r;
+  for(r = Regs; r < &Regs[NumRegs]; r++){
+    if(r->port != r->shown){
+      r->shown = r->port;
+      regWrite(r, r->port);
+    }
+  }
+}
+
+static struct context *contextOf(struct tcb *t);
+
+// SysTick handler, the part in osasm.s
+static void sysTick(void){
+  struct tcb *old = RunPt;
+  Pending = 0;
+  Primask = 1;
+  Active = 1;
+  Scheduler();
+  Active = 0;
+  Primask = 0;                 // tasks run with interrupts enabled
+  if(RunPt != old){
+    swapcontext(&contextOf(old)->uc, &contextOf(RunPt)->uc);
+  }
+}
+
+// takes a pending SysTick if interrupts are enabled, called at each host
+// call after sync, so the interrupt comes between two instructions; event
+// threads enable interrupts inside the handler, which only a device
+// interrupt of higher priority could preempt
+static void poll(void){
+  if(Pending && (Primask == 0) && (Active == 0)){
+    sysTick();
+  }
+}
+
+volatile uint32_t *Host_Reg(uint32_t address){
+  struct reg *r;
+  uint32_t i;
+  sync();
+  poll();
+  for(i = 0; (i < NumRegs) && (Regs[i].address != address); i++){};
+  if(i == NumRegs){
+    if(NumRegs == NUMREGS){
+      fail("too many registers, raise NUMREGS");
+    }
+    NumRegs++;
+    Regs[i].address = address;
+    Regs[i].value = 0;
+  }
+  r = &Regs[i];
+  r->shown = regRead(r);
+  r->port = r->shown;
+  return &r->port;
+}
+
+uint64_t Host_Cycles(void){
+  return Now;
+}
+
+uint32_t Host_Work(void){
+  struct timespec t;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+  return (uint32_t)(uint64_t)((t.tv_sec + 1e-9*t.tv_nsec)*BSP_Clock_GetFreq());
+}
+
+// resets on the cycle watchdog timer 0 times out the second time, if
+// that comes before the clock reaches next
+static void watchdog(uint64_t next){
+  if(WdtOn && (next - WdtFed > 2*(uint64_t)WdtLoad)){
+    Now = WdtFed + 2*(uint64_t)WdtLoad + 1;
+    Host_Exit("watchdog reset", 2);
+  }
+}
+
+// runs the clock to the next time SysTick reaches 0
+static void wrap(void){
+  watchdog(StNext);
+  Now = StNext;
+  StNext = Now + StReload + 1;
+  StCountFlag = 1;
+  if(StCtrl & 2){
+    Pending = 1;
+  }
+  Host_Tick();
+}
+
+void Host_Busy(uint64_t cycles){
+  sync();
+  poll();
+  while((StCtrl & 1) && (StNext - Now <= cycles)){
+    cycles = cycles - (StNext - Now);
+    wrap();
+    poll();                    // a preempted thread resumes here, cycles still to run
+  }
+  watchdog(Now + cycles);
+  Now = Now + cycles;
+}
+
+//******** STARTUP FILE ********\\
+
+void DisableInterrupts(void){
+  sync();
+  Primask = 1;
+}
+
+void EnableInterrupts(void){
+  sync();
+  Primask = 0;
+  poll();
+}
+
+long StartCritical(void){
+  long sr;
+  sync();
+  poll();
+  sr = Primask;
+  Primask = 1;
+  return sr;
+}
+
+void EndCritical(long sr){
+  sync();
+  Primask = (uint32_t)sr;
+  poll();
+}
+
+// nothing but SysTick interrupts, so the clock goes to its next tick
+void WaitForInterrupt(void){
+  sync();
+  if((StCtrl & 3) != 3){
+    Host_Exit("waiting for an interrupt with SysTick off", 2);
+  }
+  wrap();
+  poll();
+}
+
+//******** OSASM ********\\
+
+static void start(int i){
+  Contexts[i].task();
+  Host_Exit("a thread returned", 2);
+}
+
+// the context of a thread, made the first time it runs, from the initial
+// PC that os.c put on its stack
+static struct context *contextOf(struct tcb *t){
+  struct context *c;
+  intptr_t *sp;
+  uint32_t i;
+  for(i = 0; i < NumContexts; i++){
+    if(Contexts[i].tcb == t){
+      return &Contexts[i];
+    }
+  }
+  if(NumContexts == NUMCONTEXTS){
+    fail("too many threads, raise NUMCONTEXTS");
+  }
+  c = &Contexts[NumContexts];
+  sp = *(intptr_t **)t;
+  c->tcb = t;
+  c->task = (void(*)(void))sp[PCWORD];
+  getcontext(&c->uc);
+  c->uc.uc_stack.ss_sp = malloc(CONTEXTSTACK);
+  c->uc.uc_stack.ss_size = CONTEXTSTACK;
+  c->uc.uc_link = 0;
+  if(c->uc.uc_stack.ss_sp == 0){
+    fail("out of memory");
+  }
+  makecontext(&c->uc, (void(*)(void))start, 1, (int)NumContexts);
+  NumContexts++;
+  return c;
+}
+
+void StartOS(void){
+  sync();
+  Primask = 0;
+  setcontext(&contextOf(RunPt)->uc);
+}
+
+int32_t OS_AtomicAdd(int32_t *pt, int32_t n){
+  sync();
+  poll();
+  *pt = *pt + n;
+  return *pt;
+}
+
+int32_t OS_AtomicTake(int32_t *pt){
+  sync();
+  poll();
+  if(*pt <= 0){
+    return 0;
+  }
+  *pt = *pt - 1;
+  return 1;
+}
+
+uint32_t OS_AtomicOr(uint32_t *pt, uint32_t bits){
+  sync();
+  poll();
+  *pt = *pt | bits;
+  return *pt;
+}
+
+uint32_t OS_AtomicAndNot(uint32_t *pt, uint32_t bits){
+  sync();
+  poll();
+  *pt = *pt & ~bits;
+  return *pt;
+}
@@ -0,0 +1,118 @@
+//*****************************************************************************
+// host.h
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Host port of the OS and BSP, so user.c, os.c and the DSP modules run
+// unchanged on a PC, for regression tests and benchmarks on recorded sound.
+
+// Compiled with HOST defined, CortexM.h and hw_types.h route every register
+// access through Host_Reg() in hal.c, which models SysTick, the interrupt
+// control register, the DWT cycle counter and watchdog timer 0 on a
+// simulated clock. hal.c also stands in for osasm.s and the startup file:
+// each foreground thread and the idle thread run on a ucontext, and a
+// pending SysTick is taken, with a call to the real Scheduler(), at the
+// next register access, critical section or atomic operation once
+// interrupts are enabled, like an interrupt between two instructions.
+// Simulated time only passes while the idle thread waits for an interrupt,
+// or in Host_Busy, so the program runs as on a processor of infinite speed:
+// every job ends on the tick it started unless a test says how long it
+// takes, and the order of events does not depend on the host. The whole run is repeatable, bit for bit, from the same input.
+// bsp.c replaces BSP.c: the microphone plays WAV files, a sample every
+// 1/rate simulated seconds after BSP_Microphone_Start(rate) or one per
+// BSP_Microphone_Input call, the LCD draws into Host_Frame, and the buttons
+// are pressed at given simulated times. sim.c parses the options, runs
+// the program and reports when the sound runs out.
+
+#include <stdint.h>
+#ifndef __HOST_H
+#define __HOST_H  1
+
+#define HOST_LCDSIZE  128    // pixels on each side of the LCD
+#define HOST_PRESS    0.05   // seconds a scripted button press lasts
+#define HOST_MAXPRESSES 64   // scripted presses of each button
+
+//******** HAL, hal.c ********\\
+
+// ******** Host_Reg ************
+// Word standing for a processor register, used by CortexM.h and hw_types.h
+// Reads and writes take effect at the next host call, before any interrupt
+// Inputs:  register address
+// Outputs: pointer to the word to read or write
+volatile uint32_t *Host_Reg(uint32_t address);
+
+// ******** Host_Cycles ************
+// Simulated time
+// Inputs:  none
+// Outputs: bus cycles since the program started
+uint64_t Host_Cycles(void);
+
+// ******** Host_Work ************
+// Work done, for cost measurements, WORK_CYCCNT in CortexM.h
+// Host processor time of the whole program in bus cycles, so it measures
+// the host, not the board, and differs from run to run; simulated time and
+// DWT_CYCCNT are not affected
+// Inputs:  none
+// Outputs: bus cycles of host processor time, modulo 2^32 like DWT_CYCCNT
+uint32_t Host_Work(void);
+
+// ******** Host_Busy ************
+// Simulated work, the clock runs on while the caller computes, and a
+// SysTick that comes meanwhile is taken as on the board, so the thread can
+// be preempted; only the cycles it runs itself count towards the work
+// Inputs:  bus cycles of work
+// Outputs: none
+void Host_Busy(uint64_t cycles);
+
+//******** BSP, bsp.c ********\\
+
+extern uint16_t Host_Frame[HOST_LCDSIZE][HOST_LCDSIZE]; // LCD pixels, RGB565, [y][x]
+
+// ******** Host_MicOpen ************
+// Queue a sound file for the microphone, played in the order queued
+// Its sample rate is checked at BSP_Microphone_Start, which ends the
+// program if it differs from the rate started
+// Inputs:  name of a PCM WAV file, 8 or 16 bit, the first channel is used
+// Outputs: 1 if successful, 0 if it cannot be read
+int Host_MicOpen(const char *name);
+
+// ******** Host_MicSamples ************
+// Inputs:  none
+// Outputs: samples played so far
+uint64_t Host_MicSamples(void);
+
+// ******** Host_ButtonPress ************
+// Script a press of a button
+// Inputs:  1 or 2, seconds of simulated time when it is pressed
+// Outputs: 1 if successful, 0 if too many presses
+int Host_ButtonPress(int button, double seconds);
+
+// ******** Host_LCDSave ************
+// Inputs:  name of the binary PPM file to write
+// Outputs: 1 if successful, 0 if it cannot be written
+int Host_LCDSave(const char *name);
+
+// ******** Host_UartOpen ************
+// Inputs:  name of the file the trace dumps are appended to, 0 for none
+// Outputs: 1 if successful, 0 if it cannot be opened
+int Host_UartOpen(const char *name);
+
+// ******** Host_UartOut ************
+// Transmit one byte of a trace dump
+// Inputs:  byte
+// Outputs: none
+void Host_UartOut(uint32_t byte);
+
+//******** SIMULATION, sim.c ********\\
+
+// ******** Host_Tick ************
+// Called by hal.c on each SysTick, before the handler runs
+// Inputs:  none
+// Outputs: none
+void Host_Tick(void);
+
+// ******** Host_Exit ************
+// End the simulation, save the LCD and report, does not return
+// Inputs:  reason, exit status
+// Outputs: none
+void Host_Exit(const char *reason, int status);
+
+#endif
@@ -0,0 +1,172 @@
+//*****************************************************************************
+// sim.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Runs user.c on the host port of the OS and BSP, faster than real time,
+// with recorded sound for the microphone, see host.h.
+
+// Build, here, with DSP the CMSIS/DSP directory of a CMSIS_5 checkout:
+//   make DSP=$HOME/CMSIS_5/CMSIS/DSP
+// Usage:  soundsim [-o name] [-every s] [-trace file] [-b1 s] [-b2 s]
+//                  [-features file] [-class n] sound.wav [sound.wav ...]
+//         soundsim -o run/lcd -every 1 speech.wav music.wav
+//         soundsim -b1 2 -b1 4 -b2 5 -trace trace.bin tone.wav    modes on at 2 s and 4 s, dump at 5 s
+// The files are played back to back at the rate user.c starts the
+// microphone with, SAMPLERATE, so they must be recorded or resampled at
+// that rate; a file at another rate stops the simulation before it
+// starts. The simulation ends with the last
+// sample. The LCD is saved as name.ppm at the end and, with -every, as
+// name_0001.ppm and so on every s simulated seconds. -b1 and -b2 press
+// Button1 or Button2 for HOST_PRESS seconds, and trace dumps from Button2
+// are appended to the -trace file, for tools/trace2json.c. -features
+// appends the MFCCs of each analysed frame to file as a line for
+// tools/nbtrain.c, the class index -class n (default 0) then the
+// coefficients, so the classifier is trained on what the board computes.
+// The report gives the simulated and host time, the deadline misses and
+// worst job of each thread, the overruns of each event thread, and the
+// share of frames the activity detector found active with the analysis
+// work it saved, in host processor time, against analysing every pass as
+// long as an average pass that was not skipped, and the cost of the
+// features of the latest frame. The exit
+// status is 0 at the end of the sound, 2 if the watchdog would have reset
+// the board or a thread returned.
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "host.h"
+#include "os.h"
+#include "BSP.h"
+#include "mfcc.h"
+
+#define NUMTHREADS 3         // must match os.c
+#define NUMEVENTS  4         // must match os.c
+
+int User_Main(void);         // main() of user.c, renamed when it is compiled
+extern mfccType Mfcc;        // user.c, MFCCs of the latest analysed frame
+extern uint32_t mfccCycles;  // user.c, WORK_CYCCNT of the latest MFCC_Compute
+extern uint32_t classifyCycles; // user.c, and of the latest Classify_Run
+extern uint32_t yinCycles;   // user.c, and of the latest Yin_Compute
+extern uint32_t vadDuty;     // user.c, percent of frames found active
+extern uint32_t skippedPasses, analysedPasses;       // user.c, analysis passes
+extern uint64_t activeCycles, analysedCycles;        // user.c, their WORK_CYCCNT
+
+const char *Name = "lcd";    // LCD images
+double Every;                // seconds between LCD images, 0 for the last only
+uint64_t NextShot;           // Host_Cycles of the next image
+uint32_t Shots;
+struct timespec Start;       // host time when the simulation started
+FILE *Features;              // MFCC lines for nbtrain, 0 for none
+int Class;                   // class index written with them
+uint32_t FeaturePos;         // Mfcc.histPos when they were last written
+
+static void fail(const char *msg, const char *arg){
+  fprintf(stderr, "soundsim: %s %s\n", msg, arg);
+  exit(1);
+}
+
+void Host_Tick(void){
+  char name[1024];
+  int i;
+  if(Features && (Mfcc.histPos != FeaturePos)){ // a frame was analysed since the last tick
+    FeaturePos = Mfcc.histPos;
+    fprintf(Features, "%d", Class);
+    for(i = 0; i < MFCC_NUMCOEFFS; i++){
+      fprintf(Features, ",%.6g", Mfcc.coeffs[i]);
+    }
+    fprintf(Features, "\n");
+  }
+  if(NextShot == 0){
+    NextShot = (uint64_t)(Every*BSP_Clock_GetFreq());
+  }
+  if((Every > 0) && (Host_Cycles() >= NextShot)){
+    Shots++;
+    snprintf(name, sizeof(name), "%s_%04u.ppm", Name, Shots);
+    Host_LCDSave(name);
+    NextShot = NextShot + (uint64_t)(Every*BSP_Clock_GetFreq());
+  }
+}
+
+void Host_Exit(const char *reason, int status){
+  char name[1024];
+  struct timespec end;
+  double simulated, host, full;
+  uint32_t i, misses, worst, runs, overruns, passes;
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  host = (end.tv_sec - Start.tv_sec) + 1e-9*(end.tv_nsec - Start.tv_nsec);
+  simulated = (double)Host_Cycles()/BSP_Clock_GetFreq();
+  snprintf(name, sizeof(name), "%s.ppm", Name);
+  if(Host_LCDSave(name) == 0){
+    fprintf(stderr, "soundsim: cannot write %s\n", name);
+  }
+  printf("%s after %.3f s, %llu samples, %u ticks\n", reason, simulated,
+         (unsigned long long)Host_MicSamples(), OS_TickCount());
+  printf("host time %.3f s, %.1f times real time\n", host, (host > 0) ? simulated/host : 0);
+  for(i = 0; i < NUMTHREADS; i++){
+    if(OS_DeadlineStats(i, &misses, &worst)){
+      printf("thread %u: %u deadline misses, worst job %u ticks\n", i, misses, worst);
+    }
+  }
+  for(i = 0; i < NUMEVENTS; i++){
+    if(OS_EventStats(i, &runs, &overruns)){
+      printf("event %u: %u runs, %u overruns\n", i, runs, overruns);
+    }
+  }
+  passes = analysedPasses + skippedPasses;
+  if(analysedPasses){
+    full = (double)analysedCycles*passes/analysedPasses;
+    printf("VAD: %u%% of frames active, %u of %u passes skipped, %.1f%% less analysis work\n",
+           vadDuty, skippedPasses, passes, 100*(1 - activeCycles/full));
+  }
+  printf("MFCC_Compute: %u, Classify_Run: %u, Yin_Compute: %u cycles of host work in the latest frame\n",
+         mfccCycles, classifyCycles, yinCycles);
+  if(Features){
+    fclose(Features);
+  }
+  fflush(stdout);
+  exit(status);
+}
+
+int main(int argc, char **argv){
+  const char *trace = 0;
+  int i, files = 0;
+  for(i = 1; i < argc; i++){
+    if((strcmp(argv[i], "-o") == 0) && (i + 1 < argc)){
+      Name = argv[++i];
+    }else if((strcmp(argv[i], "-every") == 0) && (i + 1 < argc)){
+      Every = atof(argv[++i]);
+    }else if((strcmp(argv[i], "-trace") == 0) && (i + 1 < argc)){
+      trace = argv[++i];
+    }else if((strcmp(argv[i], "-features") == 0) && (i + 1 < argc)){
+      if((Features = fopen(argv[++i], "a")) == 0){
+        fail("cannot open", argv[i]);
+      }
+    }else if((strcmp(argv[i], "-class") == 0) && (i + 1 < argc)){
+      Class = atoi(argv[++i]);
+    }else if((strcmp(argv[i], "-b1") == 0) && (i + 1 < argc)){
+      if(Host_ButtonPress(1, atof(argv[++i])) == 0){
+        fail("too many presses of", "Button1");
+      }
+    }else if((strcmp(argv[i], "-b2") == 0) && (i + 1 < argc)){
+      if(Host_ButtonPress(2, atof(argv[++i])) == 0){
+        fail("too many presses of", "Button2");
+      }
+    }else if(argv[i][0] == '-'){
+      fail("unknown option", argv[i]);
+    }else if(Host_MicOpen(argv[i])){
+      files++;
+    }else{
+      fail("not a PCM WAV file, or too many files:", argv[i]);
+    }
+  }
+  if(files == 0){
+    fail("no sound files given", "");
+  }
+  if(Host_UartOpen(trace) == 0){
+    fail("cannot open", trace);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &Start);
+  return User_Main();        // ends in Host_Exit
+}
@@ -608,6 +608,87 @@ void BSP_Microphone_Input(uint16_t *mic){
   ADC0_ISC_R = 0x0008;             // 4) acknowledge completion
 }
 
+// ------------BSP_Microphone_Start------------
+// Sample the microphone at a fixed rate, each conversion
+// triggered by Timer2A and read by the sample sequencer 3
+// interrupt into a FIFO of MICFIFOSIZE samples, so the
+// samples are evenly spaced whenever they are collected.
+// Give it a priority 0 to 6 with lower numbers
+// signifying higher priority; it must be above the
+// tasks that call BSP_Microphone_Get().
+// BSP_Microphone_Input() must not be used once started.
+// Input:  freq is number of samples per second
+//           1 Hz to 125 kHz
+//         priority is a number 0 to 6
+// Output: none
+// Assumes: BSP_Microphone_Init() has been called
+#define MICFIFOSIZE 256            // power of 2, samples kept for BSP_Microphone_Get
+static uint16_t MicFifo[MICFIFOSIZE];
+static volatile uint32_t MicPut;   // samples converted, written by the interrupt
+static volatile uint32_t MicGet;   // samples read by BSP_Microphone_Get
+void BSP_Microphone_Start(uint32_t freq, uint8_t priority){long sr;
+  if((freq == 0) || (freq > 125000)){
+    return;                        // invalid input
+  }
+  if(priority > 6){
+    priority = 6;
+  }
+  sr = StartCritical();
+  MicPut = 0;
+  MicGet = 0;
+  // ***************** Timer2A initialization *****************
+  SYSCTL_RCGCTIMER_R |= 0x04;      // activate clock for Timer2
+  while((SYSCTL_PRTIMER_R&0x04) == 0){};// allow time for clock to stabilize
+  TIMER2_CTL_R &= ~TIMER_CTL_TAEN; // disable Timer2A during setup
+  TIMER2_CFG_R = TIMER_CFG_32_BIT_TIMER;// configure for 32-bit timer mode
+                                   // configure for periodic mode, default down-count settings
+  TIMER2_TAMR_R = TIMER_TAMR_TAMR_PERIOD;
+  TIMER2_TAILR_R = (ClockFrequency/freq - 1); // reload value
+  TIMER2_TAPR_R = 0;               // bus clock resolution
+  TIMER2_IMR_R = 0;                // no timer interrupts, only the ADC trigger
+  TIMER2_CTL_R |= TIMER_CTL_TAOTE; // time out triggers the ADC
+  // ***************** ADC0 sample sequencer 3 *****************
+  ADC0_ACTSS_R &= ~0x0008;         // disable sample sequencer 3
+  ADC0_EMUX_R = (ADC0_EMUX_R&~0xF000)|0x5000; // seq3 is timer trigger
+  ADC0_ISC_R = 0x0008;             // clear any completion from software triggers
+  ADC0_IM_R |= 0x0008;             // arm SS3 interrupt
+  ADC0_ACTSS_R |= 0x0008;          // enable sample sequencer 3
+//PRIn Bit   Interrupt
+//Bits 15:13 Interrupt [4n+1]   n=4 => (4n+1)=17
+  NVIC_PRI4_R = (NVIC_PRI4_R&0xFFFF00FF)|(priority<<13); // priority
+// vector number 33, interrupt number 17
+  NVIC_EN0_R = 1<<17;              // enable IRQ 17 in NVIC
+  TIMER2_CTL_R |= TIMER_CTL_TAEN;  // enable Timer2A 32-b
+  EndCritical(sr);
+}
+
+// a full FIFO drops the new sample, so BSP_Microphone_Get() reads a gap
+// rather than samples out of order
+void ADC0Seq3_Handler(void){
+  uint16_t mic = ADC0_SSFIFO3_R>>2;// read result
+  ADC0_ISC_R = 0x0008;             // acknowledge completion
+  if((MicPut - MicGet) < MICFIFOSIZE){
+    MicFifo[MicPut&(MICFIFOSIZE - 1)] = mic;
+    MicPut = MicPut + 1;
+  }
+}
+
+// ------------BSP_Microphone_Get------------
+// Take the oldest sample converted since
+// BSP_Microphone_Start(), in the same units as
+// BSP_Microphone_Input().
+// Input: mic is pointer to store sound measurement (0 to 1023)
+// Output: 1 if a sample was taken, 0 if there is none yet
+// Assumes: BSP_Microphone_Start() has been called
+int BSP_Microphone_Get(uint16_t *mic){
+  if(MicGet == MicPut){
+    return 0;
+  }
+  *mic = MicFifo[MicGet&(MICFIFOSIZE - 1)];
+  MicGet = MicGet + 1;
+  return 1;
+}
+
 /* ********************** */
 /*      LCD Section       */
 /* ********************** */
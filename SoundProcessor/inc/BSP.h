@@ -338,6 +338,30 @@ void BSP_Microphone_Init(void);
 // Assumes: BSP_Microphone_Init() has been called
 void BSP_Microphone_Input(uint16_t *mic);
 
+// ------------BSP_Microphone_Start------------
+// Sample the microphone at a fixed rate, each conversion
+// triggered by a timer and read by an interrupt into a
+// FIFO, so the samples are evenly spaced whenever they
+// are collected.  Give it a priority 0 to 6 with lower
+// numbers signifying higher priority; it must be above
+// the tasks that call BSP_Microphone_Get().
+// BSP_Microphone_Input() must not be used once started.
+// Input:  freq is number of samples per second
+//           1 Hz to 125 kHz
+//         priority is a number 0 to 6
+// Output: none
+// Assumes: BSP_Microphone_Init() has been called
+void BSP_Microphone_Start(uint32_t freq, uint8_t priority);
+
+// ------------BSP_Microphone_Get------------
+// Take the oldest sample converted since
+// BSP_Microphone_Start(), in the same units as
+// BSP_Microphone_Input().
+// Input: mic is pointer to store sound measurement (0 to 1023)
+// Output: 1 if a sample was taken, 0 if there is none yet
+// Assumes: BSP_Microphone_Start() has been called
+int BSP_Microphone_Get(uint16_t *mic);
+
 
 // ------------BSP_LCD_Init------------
 // Initialize the SPI and GPIO, which correspond with
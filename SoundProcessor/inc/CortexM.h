@@ -3,18 +3,39 @@
 // Daniel and Jonathan Valvano
 // February 7, 2016
 
-#define STCTRL          (*((volatile uint32_t *)0xE000E010))
-#define STRELOAD        (*((volatile uint32_t *)0xE000E014))
-#define STCURRENT       (*((volatile uint32_t *)0xE000E018))
-#define INTCTRL         (*((volatile uint32_t *)0xE000ED04))
-#define SYSPRI1         (*((volatile uint32_t *)0xE000ED18))
-#define SYSPRI2         (*((volatile uint32_t *)0xE000ED1C))
-#define SYSPRI3         (*((volatile uint32_t *)0xE000ED20))
-#define SYSHNDCTRL      (*((volatile uint32_t *)0xE000ED24))
-#define FAULTSTAT       (*((volatile uint32_t *)0xE000ED28))
-#define HFAULTSTAT      (*((volatile uint32_t *)0xE000ED2C))
-#define MMADDR          (*((volatile uint32_t *)0xE000ED34))
-#define FAULTADDR       (*((volatile uint32_t *)0xE000ED38))
+#ifdef HOST
+// host build, each register is a word of the simulation in host/hal.c, with
+// SysTick and the cycle counter following the simulated clock
+volatile uint32_t *Host_Reg(uint32_t address);
+#define CORTEXM_REG(a)  (*Host_Reg(a))
+#else
+#define CORTEXM_REG(a)  (*((volatile uint32_t *)(a)))
+#endif
+#define STCTRL          CORTEXM_REG(0xE000E010)
+#define STRELOAD        CORTEXM_REG(0xE000E014)
+#define STCURRENT       CORTEXM_REG(0xE000E018)
+#define INTCTRL         CORTEXM_REG(0xE000ED04)
+#define SYSPRI1         CORTEXM_REG(0xE000ED18)
+#define SYSPRI2         CORTEXM_REG(0xE000ED1C)
+#define SYSPRI3         CORTEXM_REG(0xE000ED20)
+#define SYSHNDCTRL      CORTEXM_REG(0xE000ED24)
+#define FAULTSTAT       CORTEXM_REG(0xE000ED28)
+#define HFAULTSTAT      CORTEXM_REG(0xE000ED2C)
+#define MMADDR          CORTEXM_REG(0xE000ED34)
+#define FAULTADDR       CORTEXM_REG(0xE000ED38)
+#define DEMCR           CORTEXM_REG(0xE000EDFC)
+#define DWT_CTRL        CORTEXM_REG(0xE0001000)
+#define DWT_CYCCNT      CORTEXM_REG(0xE0001004)
+#define DEMCR_TRCENA    0x01000000  // enable DWT
+#define DWT_CTRL_CYCCNTENA 0x00000001  // enable cycle counter
+#ifdef HOST
+// host build, DWT_CYCCNT only counts simulated time, which stands still
+// while a thread computes, so work is measured in host processor time
+uint32_t Host_Work(void);
+#define WORK_CYCCNT     Host_Work()
+#else
+#define WORK_CYCCNT     DWT_CYCCNT  // cycles of work, for cost measurements
+#endif
 
 // these functions are defined in the startup file
 
@@ -45,8 +45,14 @@
 // Macros for hardware access, both direct and via the bit-band region.
 //
 //*****************************************************************************
+#ifdef HOST
+volatile uint32_t *Host_Reg(uint32_t address); // host build, see host/hal.c
+#define HWREG(x)                                                              \
+        (*Host_Reg((uint32_t)(x)))
+#else
 #define HWREG(x)                                                              \
         (*((volatile uint32_t *)(x)))
+#endif
 #define HWREGH(x)                                                             \
         (*((volatile uint16_t *)(x)))
 #define HWREGB(x)                                                             \
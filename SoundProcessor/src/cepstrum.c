@@ -0,0 +1,63 @@
+//*****************************************************************************
+// cepstrum.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Real cepstrum by inverse rfft of the dB spectrum, liftering and
+// quefrency peak picking.
+
+#include <stdint.h>
+#include "cepstrum.h"
+#include "arm_math.h"
+
+void Cepstrum_Init(cepstrumType *c, float32_t fs, uint32_t length, float32_t maxSpacing){
+  c->fs = fs;
+  c->length = length;
+  c->qMin = (uint32_t)(fs/maxSpacing);
+  if(c->qMin < 2){
+    c->qMin = 2;
+  }
+  c->numPeaks = 0;
+}
+
+uint32_t Cepstrum_Compute(cepstrumType *c, arm_rfft_fast_instance_f32 *fft,
+                          const float32_t *dB, uint32_t numBins,
+                          float32_t *work, float32_t *out){
+  uint32_t half = c->length/2, k, q, j;
+  float32_t a, b, d, v;
+  // packed layout, DC and Nyquist are not in dB so repeat their neighbours
+  work[0] = dB[0];
+  work[1] = dB[numBins - 1];
+  for(k = 1; k < half; k++){
+    work[2*k] = (k <= numBins) ? dB[k - 1] : dB[numBins - 1];
+    work[2*k + 1] = 0;
+  }
+  arm_rfft_fast_f32(fft, work, out, 1);
+  // lifter, only the first half is used, the cepstrum is symmetric
+  for(q = 0; q < c->qMin; q++){
+    out[q] = 0;
+  }
+  // largest local maxima
+  c->numPeaks = 0;
+  for(q = c->qMin + 1; q < half; q++){
+    b = out[q];
+    if((b < CEPS_MINLEVEL) || (b <= out[q - 1]) || (b < out[q + 1])){
+      continue;
+    }
+    if((c->numPeaks == CEPS_MAXPEAKS) && (b <= c->level[CEPS_MAXPEAKS - 1])){
+      continue;
+    }
+    a = out[q - 1];
+    v = out[q + 1];
+    d = (a - 2*b + v < 0) ? 0.5f*(a - v)/(a - 2*b + v) : 0;
+    j = (c->numPeaks < CEPS_MAXPEAKS) ? c->numPeaks++ : CEPS_MAXPEAKS - 1;
+    while((j > 0) && (c->level[j - 1] < b)){ // insertion by level
+      c->level[j] = c->level[j - 1];
+      c->quefrency[j] = c->quefrency[j - 1];
+      c->spacing[j] = c->spacing[j - 1];
+      j--;
+    }
+    c->level[j] = b;
+    c->quefrency[j] = ((float32_t)q + d)/c->fs;
+    c->spacing[j] = c->fs/((float32_t)q + d);
+  }
+  return c->numPeaks;
+}
@@ -0,0 +1,60 @@
+//*****************************************************************************
+// cepstrum.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Real cepstrum of each frame, for echo delays and for the spacing of
+// harmonic and sideband families (gears, bearings).
+
+// The dB spectrum already left in magnitudeArr by Spectral_Compute() is
+// expanded into the packed rfft layout with zero imaginary parts, and the
+// inverse rfft of that (ifftFlag set) is the real cepstrum, in dB units
+// over quefrency in samples. The frame's rfft buffers are reused, so no
+// extra RAM is needed. A rectangular lifter keeps quefrencies qMin to
+// length/2, which removes the spectral envelope below qMin, and the
+// CEPS_MAXPEAKS largest local maxima left are refined by a parabola.
+// A peak at quefrency q samples is an echo delayed q/fs, or a family of
+// components spaced fs/q Hz apart.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __CEPSTRUM_H
+#define __CEPSTRUM_H  1
+
+#define CEPS_MAXPEAKS 4      // quefrency peaks reported
+#define CEPS_MINLEVEL 0.8f   // smallest peak reported in dB units, noise peaks reach about 0.55
+
+struct cepstrum{
+  float32_t fs;            // sample rate in Hz
+  uint32_t length;         // rfft length
+  uint32_t qMin;           // lowest quefrency kept by the lifter, samples
+  uint32_t numPeaks;       // peaks found in the latest frame, largest first
+  float32_t quefrency[CEPS_MAXPEAKS]; // in seconds
+  float32_t spacing[CEPS_MAXPEAKS];   // 1/quefrency in Hz
+  float32_t level[CEPS_MAXPEAKS];     // cepstrum at the peak, dB units
+};
+typedef struct cepstrum cepstrumType;
+
+// ******** Cepstrum_Init ************
+// Initialize cepstral analysis
+// Inputs:  pointer to cepstrum
+//          sample rate in Hz
+//          rfft length
+//          highest spacing of interest in Hz, sets the lifter's low edge
+// Outputs: none
+void Cepstrum_Init(cepstrumType *c, float32_t fs, uint32_t length, float32_t maxSpacing);
+
+// ******** Cepstrum_Compute ************
+// Liftered cepstrum and its peaks
+// Inputs:  pointer to cepstrum
+//          rfft instance of the given length
+//          spectrum in dB, element k-1 is bin k, same layout as magnitudeArr
+//          number of dB elements, length/2 - 1
+//          work buffer of length, e.g. SoundBufferOut once its power
+//          spectrum has been used, overwritten
+//          output buffer of length, element q is the liftered cepstrum at
+//          quefrency q for q up to length/2
+// Outputs: number of peaks found
+uint32_t Cepstrum_Compute(cepstrumType *c, arm_rfft_fast_instance_f32 *fft,
+                          const float32_t *dB, uint32_t numBins,
+                          float32_t *work, float32_t *out);
+
+#endif
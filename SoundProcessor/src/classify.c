@@ -0,0 +1,46 @@
+//*****************************************************************************
+// classify.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Sound event classifier, Gaussian naive Bayes from CMSIS-DSP.
+
+#include <stdint.h>
+#include "classify.h"
+#include "arm_math.h"
+
+// fails to compile if the classifier state grows past its RAM budget, or
+// the model format past its flash budget
+typedef char classifyRamCheck[(sizeof(classifyType) <= CLASSIFY_RAMBUDGET) ? 1 : -1];
+typedef char classifyFlashCheck[(sizeof(classModelType) <= CLASSIFY_FLASHBUDGET) ? 1 : -1];
+
+int Classify_Init(classifyType *c, const classModelType *model, uint32_t dimension){
+  c->model = 0;
+  if((model->magic != CLASSIFY_MAGIC) || (model->numClasses == 0) ||
+     (model->numClasses > CLASSIFY_MAXCLASSES) ||
+     (model->dimension != dimension) || (dimension > CLASSIFY_MAXDIM)){
+    return 0;
+  }
+  c->nb.vectorDimension = model->dimension;
+  c->nb.numberOfClasses = model->numClasses;
+  c->nb.theta = model->theta;
+  c->nb.sigma = model->sigma;
+  c->nb.classPriors = model->priors;
+  c->nb.epsilon = model->epsilon;
+  c->model = model;
+  c->result = 0;
+  return 1;
+}
+
+uint32_t Classify_Run(classifyType *c, const float32_t *features){
+  if(c->model == 0){
+    return 0;
+  }
+  c->result = arm_gaussian_naive_bayes_predict_f32(&c->nb, features, c->scratch);
+  return c->result;
+}
+
+const char *Classify_Name(classifyType *c, uint32_t index){
+  if((c->model == 0) || (index >= c->model->numClasses)){
+    return "none";
+  }
+  return c->model->names[index];
+}
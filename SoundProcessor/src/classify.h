@@ -0,0 +1,72 @@
+//*****************************************************************************
+// classify.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Sound event classifier, Gaussian naive Bayes from CMSIS-DSP run on
+// per-frame features (MFCCs).
+
+// The model (class means, variances and priors) is a const classModelType
+// in flash, produced by tools/nbtrain.c. The CMSIS instance points straight
+// at the flash arrays, so the RAM used is sizeof(classifyType) no matter how
+// large the model is. classify.c fails to compile if that is more than
+// CLASSIFY_RAMBUDGET bytes, or the largest model more than
+// CLASSIFY_FLASHBUDGET bytes of flash.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __CLASSIFY_H
+#define __CLASSIFY_H  1
+
+#define CLASSIFY_MAGIC      0x4E424D31  // "NBM1", model format version 1
+#define CLASSIFY_MAXCLASSES 8           // maximum number of event classes
+#define CLASSIFY_MAXDIM     26          // maximum feature vector length
+#define CLASSIFY_NAMELEN    12          // characters in a class name, with null
+#define CLASSIFY_RAMBUDGET  96          // bytes of RAM allowed for the classifier
+#define CLASSIFY_FLASHBUDGET 2048       // bytes of flash allowed for the model
+
+// flash resident model, arrays are class major, theta[class*dimension + i]
+struct classModel{
+  uint32_t magic;        // CLASSIFY_MAGIC
+  uint32_t numClasses;   // 0 means no model has been trained yet
+  uint32_t dimension;    // feature vector length
+  float32_t epsilon;     // added to every variance
+  float32_t theta[CLASSIFY_MAXCLASSES*CLASSIFY_MAXDIM]; // means
+  float32_t sigma[CLASSIFY_MAXCLASSES*CLASSIFY_MAXDIM]; // variances
+  float32_t priors[CLASSIFY_MAXCLASSES];
+  char names[CLASSIFY_MAXCLASSES][CLASSIFY_NAMELEN];
+};
+typedef struct classModel classModelType;
+
+struct classify{
+  arm_gaussian_naive_bayes_instance_f32 nb;
+  const classModelType *model;
+  float32_t scratch[CLASSIFY_MAXCLASSES];  // per class log likelihoods
+  uint32_t result;                         // latest class index
+};
+typedef struct classify classifyType;
+
+// model linked into flash, generated by tools/nbtrain.c
+extern const classModelType ClassModel;
+
+// ******** Classify_Init ************
+// Check a model and attach the classifier to it
+// Inputs:  pointer to classifier
+//          pointer to flash resident model
+//          length of the feature vectors that will be passed in
+// Outputs: 1 if successful, 0 if the model is missing or does not match
+int Classify_Init(classifyType *c, const classModelType *model, uint32_t dimension);
+
+// ******** Classify_Run ************
+// Classify one feature vector
+// Inputs:  pointer to classifier
+//          feature vector, dimension elements
+// Outputs: index of the most likely class
+uint32_t Classify_Run(classifyType *c, const float32_t *features);
+
+// ******** Classify_Name ************
+// Name of a class in the attached model
+// Inputs:  pointer to classifier
+//          class index
+// Outputs: pointer to null terminated name
+const char *Classify_Name(classifyType *c, uint32_t index);
+
+#endif
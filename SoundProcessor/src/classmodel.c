@@ -0,0 +1,27 @@
+//*****************************************************************************
+// classmodel.c
+// Generated by tools/nbtrain.c from 2458 feature vectors, do not edit
+
+#include <stdint.h>
+#include "classify.h"
+
+const classModelType ClassModel = {
+  CLASSIFY_MAGIC,
+  2, // classes
+  13, // dimension
+  1.66449862e-07f, // epsilon
+  { // theta
+    6.40220003e+01f, 4.34945719e-01f, -7.68596919e+00f, -9.13651601e-01f, 2.22635442e+00f, -4.04811450e-02f, -1.18726995e+00f, 4.31267428e-01f, 4.33258392e-01f, -5.37095588e-01f, -2.02112372e-01f, 4.08275012e-01f, -6.44776126e-02f,
+    7.76820642e+01f, 6.04899060e+00f, 1.29686729e+00f, 1.12207052e+00f, 4.62445834e-01f, 4.28457141e-01f, 1.71831343e-01f, 1.51789719e-01f, 1.03699826e-02f, -8.64939228e-03f, -1.06731881e-01f, -1.26400055e-01f, -1.95283719e-01f,
+  },
+  { // sigma
+    1.29643003e+02f, 2.44147154e+01f, 1.10925192e+01f, 1.15242939e+01f, 7.37002117e+00f, 7.45676164e+00f, 5.03303761e+00f, 5.11814876e+00f, 3.58920149e+00f, 3.25238588e+00f, 2.61700067e+00f, 2.06903301e+00f, 1.98139104e+00f,
+    1.66449862e+02f, 3.98660021e+00f, 1.29268980e+00f, 6.49064093e-01f, 8.30033194e-01f, 5.31607562e-01f, 5.08636605e-01f, 3.97212768e-01f, 3.88728748e-01f, 3.52158663e-01f, 3.45873304e-01f, 3.10336216e-01f, 2.84087363e-01f,
+  },
+  { // priors
+    5.00000000e-01f, 5.00000000e-01f,
+  },
+  { // names
+    "whistle", "buzz",
+  }
+};
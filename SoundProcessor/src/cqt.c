@@ -0,0 +1,56 @@
+//*****************************************************************************
+// cqt.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Constant-Q transform from the rfft output and sparse spectral kernels.
+
+#include <stdint.h>
+#include "cqt.h"
+#include "arm_math.h"
+
+int Cqt_Init(cqtType *c, const cqtKernelType *kernel, float32_t fs, uint32_t length){
+  uint32_t i;
+  c->kernel = 0;
+  c->peak = 0;
+  if((kernel->magic != CQT_MAGIC) || (kernel->fs != fs) || (kernel->length != length) ||
+     (kernel->numBins == 0) || (kernel->numBins > CQT_MAXBINS)){
+    return 0;
+  }
+  for(i = 0; i < kernel->numBins; i++){ // runs must stay clear of DC and Nyquist
+    if((kernel->bins[i].start == 0) ||
+       (kernel->bins[i].start + kernel->bins[i].count > length/2)){
+      return 0;
+    }
+  }
+  c->kernel = kernel;
+  return 1;
+}
+
+void Cqt_Compute(cqtType *c, const float32_t *spectrum, float32_t *dB){
+  const cqtKernelType *k = c->kernel;
+  const cqtBinType *b;
+  const float32_t *x, *w;
+  float32_t re, im, p, largest = 0;
+  uint32_t i, j;
+  for(i = 0; i < k->numBins; i++){
+    b = &k->bins[i];
+    x = &spectrum[2*b->start];   // bin j is at 2j, 2j+1 in the packed layout
+    w = &k->coeffs[2*b->offset];
+    re = 0;
+    im = 0;
+    for(j = 0; j < b->count; j++){
+      re += x[0]*w[0] - x[1]*w[1];
+      im += x[0]*w[1] + x[1]*w[0];
+      x += 2;
+      w += 2;
+    }
+    p = re*re + im*im;
+    if(p > largest){
+      largest = p;
+      c->peak = i;
+    }
+    dB[i] = (p > 0) ? 10*log10f(p) : CQT_MINDB;
+    if(dB[i] < CQT_MINDB){
+      dB[i] = CQT_MINDB;
+    }
+  }
+}
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// cqt.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Constant-Q transform, logarithmically spaced bins with bandwidth
+// proportional to frequency, by the spectral kernel method.
+
+// Each constant-Q bin is the inner product of the frame with a windowed
+// complex exponential of length Q*fs/f, centred in the frame. By Parseval
+// that equals the product of the frame's FFT with the conjugate FFT of the
+// exponential (its spectral kernel), which is near zero away from f. The
+// kernels are computed on the host by tools/cqtkernel.c, thresholded, and
+// kept in flash as one contiguous run of FFT bins per constant-Q bin, so a
+// frame costs a few complex multiply-adds per bin on top of the rfft call_FFT
+// already does. The kernels are scaled so a tone reads the same dB as the
+// peak of the plain spectrum.
+// Bins whose kernel would be longer than the frame are cut to the frame
+// length, so below Q*fs/length Hz the bandwidth stops shrinking.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __CQT_H
+#define __CQT_H  1
+
+#define CQT_MAGIC   0x31545143  // "CQT1", kernel format version 1
+#define CQT_MAXBINS 128         // constant-Q bins supported
+#define CQT_MINDB  -100.0f      // floor for empty bins
+
+// one constant-Q bin
+struct cqtBin{
+  uint16_t start;        // first FFT bin of the kernel
+  uint16_t count;        // FFT bins in the kernel
+  uint32_t offset;       // first complex coefficient in the kernel table
+  float32_t freq;        // centre frequency in Hz
+};
+typedef struct cqtBin cqtBinType;
+
+// flash resident kernels, generated by tools/cqtkernel.c
+struct cqtKernel{
+  uint32_t magic;        // CQT_MAGIC
+  float32_t fs;          // sample rate in Hz
+  uint32_t length;       // FFT length
+  uint32_t binsPerOctave;
+  uint32_t numBins;
+  const cqtBinType *bins;
+  const float32_t *coeffs; // interleaved real, imag
+};
+typedef struct cqtKernel cqtKernelType;
+
+struct cqt{
+  const cqtKernelType *kernel;
+  uint32_t peak;         // bin with the largest level in the latest frame
+};
+typedef struct cqt cqtType;
+
+// kernels linked into flash, generated by tools/cqtkernel.c
+extern const cqtKernelType CqtKernel;
+
+// ******** Cqt_Init ************
+// Check the kernels and attach them
+// Inputs:  pointer to transform
+//          pointer to flash resident kernels
+//          sample rate in Hz
+//          FFT length
+// Outputs: 1 if successful, 0 if the kernels do not match
+int Cqt_Init(cqtType *c, const cqtKernelType *kernel, float32_t fs, uint32_t length);
+
+// ******** Cqt_Compute ************
+// Constant-Q levels of one frame
+// Inputs:  pointer to transform
+//          rfft output in packed form, before it is turned into power
+//          levels in dB, numBins elements, lowest frequency first
+// Outputs: none
+void Cqt_Compute(cqtType *c, const float32_t *spectrum, float32_t *dB);
+
+#endif
@@ -0,0 +1,1354 @@
+//*****************************************************************************
+// cqt_kernel.c
+// Generated by tools/cqtkernel.c, do not edit
+//
+// 96 bins, 24 per octave from 1000.0 Hz, Q 34.13, worst error -48.8 dB
+
+#include <stdint.h>
+#include "cqt.h"
+
+static const float32_t CqtKernel_Coeffs[4934] = {
+  -5.007300973e-01f, -1.536225551e-03f,  1.000000000e+00f,  5.125520031e-15f,
+  -5.007300973e-01f,  1.536225551e-03f, -2.295742161e-04f,  1.993024023e-03f,
+  -4.168754385e-04f,  3.719402244e-03f, -8.985306486e-04f,  8.245225996e-03f,
+  -2.658170881e-03f,  2.510728501e-02f, -1.912844554e-02f,  1.861266196e-01f,
+   8.591949195e-02f, -8.620246053e-01f, -7.989132404e-02f,  8.272529244e-01f,
+   1.439189818e-02f, -1.539593339e-01f,  2.092095790e-03f, -2.314657345e-02f,
+   6.830135244e-04f, -7.824423723e-03f,  3.016312548e-04f, -3.582234727e-03f,
+   1.571728790e-04f, -1.937701367e-03f,  2.229630714e-03f,  3.637212503e-04f,
+   9.094475769e-03f,  1.454958576e-03f, -5.307441950e-01f, -8.324071765e-02f,
+   9.868928194e-01f,  1.516812891e-01f, -4.592991471e-01f, -6.915063411e-02f,
+  -7.038013078e-03f, -1.037549344e-03f, -3.592754365e-04f,  1.977866050e-03f,
+  -6.608969998e-04f,  3.702907357e-03f, -1.446384238e-03f,  8.250127546e-03f,
+  -4.368267022e-03f,  2.537388355e-02f, -3.307614475e-02f,  1.957182139e-01f,
+   1.435272545e-01f, -8.654308915e-01f, -1.314717233e-01f,  8.080915213e-01f,
+   2.275824919e-02f, -1.426433772e-01f,  3.466164693e-03f, -2.216190100e-02f,
+   1.158871688e-03f, -7.561453152e-03f,  5.222077016e-04f, -3.478558036e-03f,
+   2.774273744e-04f, -1.887437887e-03f,  7.580070756e-03f,  1.018632553e-03f,
+  -5.267092586e-01f, -6.913632900e-02f,  9.908373356e-01f,  1.269672066e-01f,
+  -4.667733610e-01f, -5.835796893e-02f, -5.943134427e-03f, -7.245243760e-04f,
+  -1.235830132e-04f,  1.992875012e-03f, -2.186185011e-04f,  3.709595650e-03f,
+  -4.574708873e-04f,  8.190304972e-03f, -1.305861515e-03f,  2.474246174e-02f,
+  -8.840165101e-03f,  1.778628826e-01f,  3.992191702e-02f, -8.561964035e-01f,
+  -3.658922017e-02f,  8.401107192e-01f,  6.597578526e-03f, -1.629857868e-01f,
+   8.915089420e-04f, -2.383276634e-02f,  2.745073289e-04f, -7.994984277e-03f,
+   1.139845917e-04f, -3.645910881e-03f,  5.546078319e-05f, -1.967182383e-03f,
+  -4.015443847e-03f,  3.202626249e-04f, -4.786689281e-01f,  3.965578601e-02f,
+   9.958494902e-01f, -8.557909727e-02f, -5.191796422e-01f,  4.622111842e-02f,
+   5.115909036e-03f, -4.712793161e-04f,  4.529855214e-04f,  1.778106438e-03f,
+   8.414500044e-04f,  3.261094214e-03f,  1.838308875e-03f,  7.035196293e-03f,
+   5.377112422e-03f,  2.032306232e-02f,  3.334527835e-02f,  1.244843602e-01f,
+  -2.089325041e-01f, -7.705193758e-01f,  2.365812063e-01f,  8.620058298e-01f,
+  -5.813235417e-02f, -2.092927694e-01f, -7.127400022e-03f, -2.535867132e-02f,
+  -2.306889510e-03f, -8.112086914e-03f, -1.038970193e-03f, -3.611349966e-03f,
+  -5.584816099e-04f, -1.919044880e-03f, -1.945681637e-03f,  1.027647406e-03f,
+  -4.669441376e-03f,  2.484602854e-03f, -1.683303155e-02f,  9.023204446e-03f,
+  -3.380739689e-01f,  1.825591326e-01f,  8.642893434e-01f, -4.701446593e-01f,
+  -5.435193181e-01f,  2.978209555e-01f,  3.071308509e-02f, -1.695193350e-02f,
+   6.748590153e-03f, -3.751908429e-03f,  2.576062456e-03f, -1.442537177e-03f,
+   1.558360178e-03f,  1.610179199e-03f,  3.259525634e-03f,  3.347300924e-03f,
+   8.851685561e-03f,  9.034431539e-03f,  4.431880265e-02f,  4.495703429e-02f,
+  -4.837165475e-01f, -4.876807630e-01f,  6.783017516e-01f,  6.796773076e-01f,
+  -2.271304578e-01f, -2.261988521e-01f, -1.745505445e-02f, -1.727712154e-02f,
+  -5.133642815e-03f, -5.050225649e-03f, -2.199989045e-03f, -2.150999615e-03f,
+  -8.613382233e-04f,  1.719831023e-03f, -1.623523422e-03f,  3.266675398e-03f,
+  -3.672648221e-03f,  7.446936797e-03f, -1.173644979e-02f,  2.398290671e-02f,
+  -1.099216938e-01f,  2.263764888e-01f,  3.994992673e-01f, -8.292071819e-01f,
+  -3.281748891e-01f,  6.865438819e-01f,  4.436713830e-02f, -9.355287999e-02f,
+   7.780720480e-03f, -1.653734036e-02f,  2.738371259e-03f, -5.866860971e-03f,
+   1.275753020e-03f, -2.755278954e-03f,  3.214900149e-03f,  1.888670959e-04f,
+  -5.124976635e-01f, -2.853044681e-02f,  9.984397292e-01f,  5.251040310e-02f,
+  -4.876052141e-01f, -2.414450422e-02f, -2.393158386e-03f, -1.111418096e-04f,
+   1.179131796e-03f,  2.900707070e-03f,  2.541499911e-03f,  6.197609473e-03f,
+   7.272607647e-03f,  1.758087613e-02f,  4.234055430e-02f,  1.014720127e-01f,
+  -2.990675271e-01f, -7.105934024e-01f,  3.570524752e-01f,  8.411403894e-01f,
+  -9.540513903e-02f, -2.228510380e-01f, -1.058229804e-02f, -2.451042831e-02f,
+  -3.340214025e-03f, -7.671749685e-03f, -1.483346103e-03f, -3.378567519e-03f,
+  -7.894197479e-04f, -1.783152577e-03f, -2.082188847e-03f,  2.620202489e-03f,
+  -4.802893847e-03f,  6.082122680e-03f, -1.594903134e-02f,  2.032487839e-02f,
+  -1.808566898e-01f,  2.319389880e-01f,  5.799480677e-01f, -7.484764457e-01f,
+  -4.362871647e-01f,  5.666509867e-01f,  4.692283645e-02f, -6.133185700e-02f,
+   8.953781798e-03f, -1.177800167e-02f,  3.244089196e-03f, -4.294630606e-03f,
+   1.536721946e-03f, -2.047392540e-03f,  5.074504297e-03f,  4.638182290e-04f,
+  -5.190424323e-01f, -4.583609104e-02f,  9.959181547e-01f,  8.487004042e-02f,
+  -4.788658619e-01f, -3.932850808e-02f, -3.981413320e-03f, -3.146931413e-04f,
+   1.438406878e-03f,  2.418192802e-03f,  3.061652416e-03f,  5.111372564e-03f,
+   8.573269472e-03f,  1.421381161e-02f,  4.684156924e-02f,  7.712367177e-02f,
+  -3.854571581e-01f, -6.302809119e-01f,  4.897317886e-01f,  7.952935100e-01f,
+  -1.434027702e-01f, -2.312847972e-01f, -1.401449461e-02f, -2.244897000e-02f,
+  -4.304337315e-03f, -6.847998127e-03f, -1.884543221e-03f, -2.977902768e-03f,
+  -6.536280853e-04f,  1.873393427e-03f, -1.221145736e-03f,  3.534810618e-03f,
+  -2.727252664e-03f,  7.973668166e-03f, -8.511804044e-03f,  2.513755485e-02f,
+  -7.213826478e-02f,  2.152141780e-01f,  2.840175331e-01f, -8.560321331e-01f,
+  -2.457620651e-01f,  7.484041452e-01f,  3.748381883e-02f, -1.153397560e-01f,
+   6.202397402e-03f, -1.928621158e-02f,  2.139866585e-03f, -6.724582054e-03f,
+   9.851380019e-04f, -3.129009390e-03f, -1.823813887e-03f,  8.484559366e-04f,
+  -4.400378559e-03f,  2.063544234e-03f, -1.603981480e-02f,  7.581940852e-03f,
+  -3.572386801e-01f,  1.702077836e-01f,  8.896993399e-01f, -4.272548854e-01f,
+  -5.470842123e-01f,  2.647914588e-01f,  2.766876668e-02f, -1.349674817e-02f,
+   6.175897084e-03f, -3.036076901e-03f,  2.372355433e-03f, -1.175303129e-03f,
+   4.103311803e-03f,  1.250432688e-03f,  1.749712415e-02f,  5.273417570e-03f,
+  -5.456424356e-01f, -1.626255065e-01f,  9.540752172e-01f,  2.811723053e-01f,
+  -4.156686664e-01f, -1.211155578e-01f, -1.204238180e-02f, -3.468805458e-03f,
+  -3.179626307e-03f, -9.053355316e-04f,  1.509634312e-03f,  2.183043631e-03f,
+   3.196284175e-03f,  4.591886885e-03f,  8.867518976e-03f,  1.265637949e-02f,
+   4.716375470e-02f,  6.687806547e-02f, -4.189445674e-01f, -5.902091861e-01f,
+   5.478122234e-01f,  7.667632103e-01f, -1.670192182e-01f, -2.322640866e-01f,
+  -1.530884765e-02f, -2.115193009e-02f, -4.643355496e-03f, -6.374365184e-03f,
+  -2.020218642e-03f, -2.755538328e-03f,  2.096482785e-05f,  1.974668121e-03f,
+   5.012747351e-05f,  3.662869101e-03f,  1.347487560e-04f,  8.042791858e-03f,
+   4.764850892e-04f,  2.403702028e-02f,  3.798925318e-03f,  1.659474969e-01f,
+  -2.190783806e-02f, -8.438383341e-01f,  2.478377707e-02f,  8.536589742e-01f,
+  -5.619026721e-03f, -1.750298887e-01f, -8.650395903e-04f, -2.459268086e-02f,
+  -3.121742629e-04f, -8.162106387e-03f, -1.529557921e-04f, -3.701773705e-03f,
+  -8.835863264e-05f, -1.990364399e-03f, -9.190852288e-04f,  1.658339286e-03f,
+  -1.736938371e-03f,  3.156825667e-03f, -3.944715951e-03f,  7.221755572e-03f,
+  -1.270164363e-02f,  2.342396043e-02f, -1.231800020e-01f,  2.288372219e-01f,
+   4.364323616e-01f, -8.167749047e-01f, -3.523809910e-01f,  6.643700004e-01f,
+   4.567579553e-02f, -8.675792813e-02f,  8.153132163e-03f, -1.560222916e-02f,
+   2.886773553e-03f, -5.565803032e-03f,  1.349591766e-03f, -2.621709835e-03f,
+  -2.165468177e-03f,  1.571980538e-03f, -5.123655777e-03f,  3.743476933e-03f,
+  -1.793046482e-02f,  1.318503171e-02f, -2.832659483e-01f,  2.096394598e-01f,
+   7.807333469e-01f, -5.815207958e-01f, -5.226007700e-01f,  3.917520642e-01f,
+   3.843058273e-02f, -2.899292298e-02f,  8.068042807e-03f, -6.125649437e-03f,
+   3.026020713e-03f, -2.312171273e-03f, -3.112922888e-03f,  8.621776942e-04f,
+  -1.181177702e-02f,  3.310526488e-03f, -4.181462228e-01f,  1.185800806e-01f,
+   9.563283324e-01f, -2.743732631e-01f, -5.451443195e-01f,  1.582151651e-01f,
+   1.703851484e-02f, -5.001750775e-03f,  4.004675429e-03f, -1.188951777e-03f,
+  -5.007300973e-01f, -1.536225551e-03f,  1.000000000e+00f,  1.038020666e-14f,
+  -5.007300973e-01f,  1.536225551e-03f,  2.837105654e-03f,  5.893700290e-04f,
+   1.175092999e-02f,  2.403512364e-03f, -5.367947817e-01f, -1.080802530e-01f,
+   9.784770608e-01f,  1.938885152e-01f, -4.459005892e-01f, -8.693583310e-02f,
+  -8.807274513e-03f, -1.689095865e-03f, -2.266800730e-03f, -4.275304382e-04f,
+   4.354011267e-03f,  1.414942322e-03f,  1.867180504e-02f,  6.004588213e-03f,
+  -5.467541814e-01f, -1.739793420e-01f,  9.480612278e-01f,  2.984768152e-01f,
+  -4.092685282e-01f, -1.274707019e-01f, -1.261236332e-02f, -3.885837039e-03f,
+  -3.345787525e-03f, -1.019600080e-03f, -3.235668642e-03f,  1.509121852e-03f,
+  -7.460092194e-03f,  3.535293508e-03f, -2.862276509e-02f,  1.377985813e-02f,
+   5.334324837e-01f, -2.608541250e-01f, -8.897147179e-01f,  4.418650270e-01f,
+   3.946930468e-01f, -1.990474761e-01f,  7.288428489e-03f, -3.731894074e-03f,
+   2.496563364e-03f, -1.325193909e-03f,  4.524501972e-03f, -2.437339397e-03f,
+   9.965933859e-03f, -5.447785370e-03f,  3.510325029e-02f, -1.946956292e-02f,
+  -5.195286870e-01f,  2.923325598e-01f,  8.651565909e-01f, -4.938268661e-01f,
+  -4.156708419e-01f,  2.406561822e-01f,  3.676485270e-03f, -2.158760326e-03f,
+   2.899335232e-03f, -1.726443646e-03f,  1.936704619e-03f, -1.169390045e-03f,
+  -3.011152847e-03f,  1.479897066e-03f, -5.486498121e-03f,  2.738382900e-03f,
+  -1.164849661e-02f,  5.903471727e-03f, -3.673195839e-02f,  1.889996044e-02f,
+   5.129219890e-01f, -2.679105997e-01f, -8.831161261e-01f,  4.681906104e-01f,
+   4.745156169e-01f, -2.553101480e-01f, -2.371460199e-02f,  1.294775214e-02f,
+  -8.917518891e-03f,  4.940075334e-03f, -4.569509067e-03f,  2.568158088e-03f,
+  -2.649903996e-03f,  1.510770293e-03f,  1.888090395e-03f, -6.761811092e-04f,
+   3.381585237e-03f, -1.222763909e-03f,  6.195013411e-03f, -2.261600224e-03f,
+   1.244165562e-02f, -4.585355055e-03f,  3.275893256e-02f, -1.218754239e-02f,
+  -5.072050095e-01f,  1.904726475e-01f,  9.336394668e-01f, -3.538853228e-01f,
+  -5.745853782e-01f,  2.198084146e-01f,  6.068352610e-02f, -2.342823520e-02f,
+   1.714030840e-02f, -6.677895784e-03f,  7.262396626e-03f, -2.855136758e-03f,
+   3.499663668e-03f, -1.388268196e-03f, -3.439625725e-03f,  1.305211685e-03f,
+  -6.197381765e-03f,  2.373455325e-03f, -1.122783031e-02f,  4.339547362e-03f,
+  -2.112972364e-02f,  8.241218515e-03f,  4.528660774e-01f, -1.782338470e-01f,
+  -9.164006710e-01f,  3.639174104e-01f,  6.549667120e-01f, -2.624269426e-01f,
+  -1.155567244e-01f,  4.671230912e-02f, -2.346828021e-02f,  9.570618160e-03f,
+  -7.560509723e-03f,  3.110344289e-03f, -2.498304006e-03f,  1.036759233e-03f,
+   3.198469291e-03f, -1.824012259e-03f,  5.440855864e-03f, -3.147190670e-03f,
+   8.167020977e-03f, -4.791222978e-03f,  6.173329893e-03f, -3.672714578e-03f,
+  -3.557485938e-01f,  2.146127224e-01f,  8.141412735e-01f, -4.979865849e-01f,
+  -6.822444797e-01f,  4.230833054e-01f,  1.794297397e-01f, -1.128007695e-01f,
+   2.132277563e-02f, -1.358808391e-02f,  3.469038988e-03f, -2.240716247e-03f,
+  -1.766860485e-03f,  6.787282182e-04f, -3.383864416e-03f,  1.311817672e-03f,
+  -5.189505871e-03f,  2.030143747e-03f, -5.491406191e-03f,  2.167696832e-03f,
+   7.336653303e-03f, -2.922143787e-03f,  3.089731634e-01f, -1.241617501e-01f,
+  -8.306572437e-01f,  3.367655873e-01f,  8.287835717e-01f, -3.389702737e-01f,
+  -3.066431880e-01f,  1.265157759e-01f, -7.523504552e-03f,  3.131115343e-03f,
+   5.356153939e-03f, -2.248415491e-03f,  5.102172028e-03f, -2.160234144e-03f,
+   3.332357854e-03f, -1.422975562e-03f,  1.742193825e-03f, -7.502754452e-04f,
+   3.237214172e-03f, -1.237940276e-03f,  4.084783606e-03f, -1.576440060e-03f,
+   1.454007928e-03f, -5.662764888e-04f, -1.846283674e-02f,  7.255831268e-03f,
+  -2.270512283e-01f,  9.003548324e-02f,  7.492983937e-01f, -2.997922897e-01f,
+  -8.967634439e-01f,  3.619882464e-01f,  4.455094934e-01f, -1.814262122e-01f,
+  -3.664395213e-02f,  1.505386084e-02f, -1.774792001e-02f,  7.354820147e-03f,
+  -7.777002174e-03f,  3.250818234e-03f, -2.609350253e-03f,  1.100135152e-03f,
+  -2.699143253e-03f,  1.544553670e-03f, -2.332328353e-03f,  1.353712520e-03f,
+   2.480628900e-03f, -1.460209489e-03f,  2.241349965e-02f, -1.337944809e-02f,
+   1.343649328e-01f, -8.132976294e-02f, -5.849871635e-01f,  3.590097725e-01f,
+   8.487019539e-01f, -5.280491114e-01f, -5.486387014e-01f,  3.460419476e-01f,
+   1.111400425e-01f, -7.105612755e-02f,  2.240094356e-02f, -1.451618783e-02f,
+   3.778144950e-03f, -2.481350442e-03f, -1.432462479e-03f,  9.534219280e-04f,
+  -2.287942450e-03f,  1.543155522e-03f, -1.658787718e-03f,  1.133677782e-03f,
+   1.886255108e-03f, -6.845702883e-04f,  2.370908391e-03f, -8.687045192e-04f,
+   7.011595299e-04f, -2.593485988e-04f, -5.997971166e-03f,  2.239504363e-03f,
+  -2.398946136e-02f,  9.041068144e-03f, -7.570757717e-02f,  2.879798412e-02f,
+   5.055354238e-01f, -1.940752715e-01f, -9.105350971e-01f,  3.527638316e-01f,
+   7.569915056e-01f, -2.959514260e-01f, -2.586854994e-01f,  1.020510569e-01f,
+  -9.125145152e-03f,  3.632248146e-03f,  8.080306463e-03f, -3.245105268e-03f,
+   6.836023647e-03f, -2.769778250e-03f,  3.283500206e-03f, -1.342130476e-03f,
+  -1.798618818e-03f,  6.441505393e-04f, -1.550495042e-03f,  5.606613122e-04f,
+   1.193146221e-03f, -4.355871934e-04f,  7.774302270e-03f, -2.865259768e-03f,
+   1.808797568e-02f, -6.729520857e-03f,  2.125824988e-02f, -7.983333431e-03f,
+  -3.601135612e-01f,  1.364993155e-01f,  8.301873803e-01f, -3.175948560e-01f,
+  -8.777052164e-01f,  3.388636708e-01f,  4.394240677e-01f, -1.712034047e-01f,
+  -5.206129327e-02f,  2.046771534e-02f, -2.251620777e-02f,  8.932020515e-03f,
+  -6.452300586e-03f,  2.582520712e-03f,  5.747982650e-04f, -2.321103530e-04f,
+   2.439628821e-03f, -9.938670555e-04f,  1.856683870e-03f, -7.630342152e-04f,
+  -2.521669026e-03f,  1.475499594e-03f, -6.842276081e-03f,  4.060170148e-03f,
+  -8.129782043e-03f,  4.891865421e-03f,  1.118620764e-02f, -6.824819371e-03f,
+   1.999548078e-01f, -1.236844137e-01f, -6.272459030e-01f,  3.933320642e-01f,
+   8.431233764e-01f, -5.359396338e-01f, -5.769606233e-01f,  3.717408478e-01f,
+   1.598652750e-01f, -1.043962762e-01f,  1.687041484e-02f, -1.116508525e-02f,
+  -4.537400790e-03f,  3.043116536e-03f, -5.889443681e-03f,  4.002505913e-03f,
+  -2.838041401e-03f,  1.954315929e-03f,  3.483443055e-03f, -1.318943105e-03f,
+   5.214180797e-03f, -1.992567442e-03f, -1.503748208e-04f,  5.799415885e-05f,
+  -2.454598434e-02f,  9.553113021e-03f, -1.034644544e-01f,  4.063353315e-02f,
+   5.119672418e-01f, -2.028797269e-01f, -8.939410448e-01f,  3.574234843e-01f,
+   8.132740259e-01f, -3.280679882e-01f, -3.684141338e-01f,  1.499310434e-01f,
+   3.509800881e-02f, -1.440927200e-02f,  2.178366855e-02f, -9.021345526e-03f,
+   6.027203985e-03f, -2.517757006e-03f, -1.628577942e-03f,  6.861852598e-04f,
+  -3.050026018e-03f,  1.296131173e-03f, -3.210909432e-03f,  1.300377073e-03f,
+  -1.831482048e-03f,  7.482753717e-04f,  6.186846178e-03f, -2.549892059e-03f,
+   2.079090662e-02f, -8.643632755e-03f,  2.349811606e-02f, -9.853790514e-03f,
+  -3.228461146e-01f,  1.365496963e-01f,  7.623029947e-01f, -3.251812756e-01f,
+  -9.076457024e-01f,  3.904768527e-01f,  5.911184549e-01f, -2.564561963e-01f,
+  -1.661304086e-01f,  7.268194109e-02f, -1.689907722e-02f,  7.455187850e-03f,
+   7.953473367e-03f, -3.537939629e-03f,  7.435016800e-03f, -3.334676148e-03f,
+   2.077166922e-03f, -9.392944048e-04f,  1.890707994e-03f, -6.136320881e-04f,
+   2.124446677e-03f, -6.967037916e-04f, -1.363305142e-03f,  4.517275665e-04f,
+  -7.948762737e-03f,  2.660892904e-03f, -9.697778150e-03f,  3.279506462e-03f,
+   1.673690043e-02f, -5.717212800e-03f,  1.661524028e-01f, -5.732637271e-02f,
+  -5.875275135e-01f,  2.047296464e-01f,  9.224749207e-01f, -3.246224523e-01f,
+  -8.177277446e-01f,  2.905839980e-01f,  3.892045319e-01f, -1.396522820e-01f,
+  -5.295038968e-02f,  1.918294095e-02f, -2.464268729e-02f,  9.013208561e-03f,
+  -2.551299054e-03f,  9.420370334e-04f,  4.772630055e-03f, -1.778894919e-03f,
+   3.465461545e-03f, -1.303798752e-03f,  3.123652423e-03f, -1.568186446e-03f,
+   5.168377887e-03f, -2.634541132e-03f, -1.696887659e-03f,  8.781342767e-04f,
+  -2.328273468e-02f,  1.223044470e-02f, -4.559116066e-02f,  2.430717833e-02f,
+   3.426642120e-01f, -1.854024380e-01f, -7.354026437e-01f,  4.037509859e-01f,
+   8.661094904e-01f, -4.824514091e-01f, -5.982073545e-01f,  3.380471468e-01f,
+   2.051060796e-01f, -1.175717190e-01f,  1.966736512e-03f, -1.143470290e-03f,
+  -1.544670667e-02f,  9.108065628e-03f, -6.572684273e-03f,  3.930096049e-03f,
+   1.320704701e-03f, -8.007490542e-04f,  3.004071303e-03f, -1.846684725e-03f,
+  -2.997150877e-03f,  1.826983527e-03f, -9.785133880e-04f,  6.047418574e-04f,
+   6.835943554e-03f, -4.282944370e-03f,  1.264025830e-02f, -8.027962409e-03f,
+  -1.044443622e-02f,  6.723661907e-03f, -1.541272402e-01f,  1.005631909e-01f,
+   5.061519146e-01f, -3.346939981e-01f, -7.996696234e-01f,  5.358641744e-01f,
+   7.558230758e-01f, -5.132303238e-01f, -4.194261730e-01f,  2.885810137e-01f,
+   9.836186469e-02f, -6.856971234e-02f,  1.893253624e-02f, -1.337155700e-02f,
+  -6.490580272e-03f,  4.644080065e-03f, -6.771044806e-03f,  4.907849710e-03f,
+  -8.129550260e-04f,  5.968963378e-04f,  2.208844060e-03f, -1.642755233e-03f,
+  -2.235468710e-03f,  1.365382224e-03f, -6.018328480e-03f,  3.726777155e-03f,
+  -4.413718125e-05f,  2.770752144e-05f,  2.234678343e-02f, -1.422029454e-02f,
+   3.812913969e-02f, -2.459332719e-02f, -2.932363749e-01f,  1.916956902e-01f,
+   6.528552175e-01f, -4.325280786e-01f, -8.301799893e-01f,  5.573686361e-01f,
+   6.585596204e-01f, -4.480323195e-01f, -3.004743755e-01f,  2.071275562e-01f,
+   4.245254770e-02f, -2.964993380e-02f,  2.176192403e-02f, -1.539860107e-02f,
+  -7.691410719e-04f,  5.513527431e-04f, -5.942066666e-03f,  4.314964171e-03f,
+  -1.936938846e-03f,  1.424784772e-03f,  1.621452975e-03f, -1.208120026e-03f,
+   3.374411957e-03f, -1.631923369e-03f,  1.933547086e-03f, -9.497791762e-04f,
+  -7.057215553e-03f,  3.520494560e-03f, -1.259301323e-02f,  6.378825288e-03f,
+   1.569249853e-02f, -8.070200682e-03f,  1.241909042e-01f, -6.483443826e-02f,
+  -4.555279911e-01f,  2.413788289e-01f,  7.938345075e-01f, -4.269024134e-01f,
+  -8.594445586e-01f,  4.690068662e-01f,  5.932340622e-01f, -3.284732699e-01f,
+  -2.275747657e-01f,  1.278387308e-01f,  1.313259639e-02f, -7.483531721e-03f,
+   2.096442133e-02f, -1.211745664e-02f,  2.648438094e-03f, -1.552557107e-03f,
+  -5.267089233e-03f,  3.131234553e-03f, -2.601698041e-03f,  1.568369917e-03f,
+   1.346953679e-03f, -8.232882246e-04f,  1.693391125e-03f, -1.049364801e-03f,
+  -1.809478854e-03f,  1.306188293e-03f,  2.011638135e-03f, -1.470977673e-03f,
+   5.461977795e-03f, -4.045649432e-03f, -1.647624071e-03f,  1.236111624e-03f,
+  -1.961074769e-02f,  1.490167622e-02f, -1.153951045e-02f,  8.880775422e-03f,
+   1.969996840e-01f, -1.535442621e-01f, -5.129677057e-01f,  4.048981071e-01f,
+   7.547741532e-01f, -6.033152342e-01f, -7.228859663e-01f,  5.851314664e-01f,
+   4.456726015e-01f, -3.652933836e-01f, -1.457867473e-01f,  1.209964752e-01f,
+  -3.338510636e-03f,  2.805587370e-03f,  1.567734778e-02f, -1.333977003e-02f,
+   4.022778012e-03f, -3.465738613e-03f, -3.858009353e-03f,  3.365248442e-03f,
+  -2.504523378e-03f,  2.211841522e-03f,  9.875091491e-04f, -8.829515427e-04f,
+   1.483849017e-03f, -1.343213022e-03f, -3.469097195e-03f,  1.336745801e-03f,
+  -1.097676693e-03f,  4.268396006e-04f,  7.829179056e-03f, -3.072118154e-03f,
+   7.261760067e-03f, -2.875206759e-03f, -2.400844917e-02f,  9.591165930e-03f,
+  -6.065125763e-02f,  2.444568463e-02f,  3.326158822e-01f, -1.352495998e-01f,
+  -7.018823028e-01f,  2.879147232e-01f,  9.183610678e-01f, -3.800108433e-01f,
+  -8.083005548e-01f,  3.373768032e-01f,  4.620979428e-01f, -1.945420057e-01f,
+  -1.349039227e-01f,  5.728206038e-02f, -1.200083550e-02f,  5.139233079e-03f,
+   1.669856720e-02f, -7.211693563e-03f,  5.595094524e-03f, -2.436775481e-03f,
+  -4.416585434e-03f,  1.939652953e-03f, -3.054768546e-03f,  1.352771884e-03f,
+  -2.949154004e-03f,  1.137614250e-03f, -4.693138879e-03f,  1.826904016e-03f,
+   5.757589824e-03f, -2.261629095e-03f,  1.599122770e-02f, -6.338186096e-03f,
+  -1.548514795e-02f,  6.192637607e-03f, -1.138608530e-01f,  4.593957588e-02f,
+   4.186067581e-01f, -1.703909636e-01f, -7.679452896e-01f,  3.153366148e-01f,
+   9.238795042e-01f, -3.826834261e-01f, -7.659959793e-01f,  3.200426996e-01f,
+   4.164842963e-01f, -1.755150706e-01f, -1.129959673e-01f,  4.802759737e-02f,
+  -1.532850880e-02f,  6.570796948e-03f,  1.578927971e-02f, -6.825731136e-03f,
+   5.670444109e-03f, -2.472017426e-03f, -4.610366654e-03f,  2.026734175e-03f,
+  -2.889781492e-03f,  1.280952012e-03f,  3.220326267e-03f, -9.024321334e-04f,
+  -1.032278524e-03f,  2.926940797e-04f, -7.318401244e-03f,  2.099351259e-03f,
+   1.353870495e-03f, -3.928696970e-04f,  2.265606448e-02f, -6.649824791e-03f,
+  -3.197008336e-04f,  9.490228695e-05f, -1.699452698e-01f,  5.101562291e-02f,
+   5.008727312e-01f, -1.520329416e-01f, -8.363927007e-01f,  2.566803992e-01f,
+   9.525380731e-01f, -2.955248356e-01f, -7.637323141e-01f,  2.395189703e-01f,
+   4.075814486e-01f, -1.291989833e-01f, -1.095096543e-01f,  3.508348390e-02f,
+  -1.603603549e-02f,  5.191748030e-03f,  1.701501571e-02f, -5.566427950e-03f,
+   5.223356653e-03f, -1.726568560e-03f, -5.513377953e-03f,  1.841216697e-03f,
+  -2.511148341e-03f,  8.471810725e-04f,  2.357767895e-03f, -8.035006467e-04f,
+  -1.797346398e-03f,  8.916008519e-04f, -6.035104743e-04f,  3.040089796e-04f,
+   3.350289539e-03f, -1.713509788e-03f,  1.279010903e-03f, -6.640838110e-04f,
+  -7.458922919e-03f,  3.931089770e-03f, -3.424938302e-03f,  1.831991132e-03f,
+   2.315762267e-02f, -1.257030852e-02f,  1.532992069e-02f, -8.443500847e-03f,
+  -1.923882067e-01f,  1.075085029e-01f,  4.962597489e-01f, -2.813247144e-01f,
+  -7.792442441e-01f,  4.480858743e-01f,  8.585319519e-01f, -5.007130504e-01f,
+  -6.788215041e-01f,  4.015043676e-01f,  3.642483652e-01f, -2.184708863e-01f,
+  -1.023207158e-01f,  6.222733110e-02f, -1.218560152e-02f,  7.513600867e-03f,
+   1.684891433e-02f, -1.053221617e-02f,  3.358245129e-03f, -2.127999440e-03f,
+  -5.787037779e-03f,  3.716999898e-03f, -1.418407192e-03f,  9.233818855e-04f,
+   2.652498893e-03f, -1.750040799e-03f,  2.755576046e-03f, -1.969258767e-03f,
+   2.891981974e-03f, -2.093666699e-03f, -6.490359548e-03f,  4.759700969e-03f,
+  -6.627046969e-03f,  4.922755528e-03f,  2.128331922e-02f, -1.601342857e-02f,
+   2.526680194e-02f, -1.925450377e-02f, -1.956232488e-01f,  1.509805173e-01f,
+   4.678404033e-01f, -3.656780422e-01f, -7.112358212e-01f,  5.629874468e-01f,
+   7.751103640e-01f, -6.213219762e-01f, -6.172345877e-01f,  5.010217428e-01f,
+   3.414913118e-01f, -2.806887925e-01f, -1.052071974e-01f,  8.756222576e-02f,
+  -6.261413451e-03f,  5.276639480e-03f,  1.726705395e-02f, -1.473348588e-02f,
+   9.440828580e-04f, -8.156223339e-04f, -5.968475714e-03f,  5.220647901e-03f,
+  -9.389638581e-05f,  8.315397281e-05f,  2.743517281e-03f, -2.459840383e-03f,
+  -9.882594168e-05f,  8.970736235e-05f, -1.473962562e-03f,  1.354550244e-03f,
+  -2.790682018e-03f,  7.651190972e-04f,  2.444081707e-03f, -6.781608099e-04f,
+   5.077649374e-03f, -1.425690018e-03f, -6.787260063e-03f,  1.928194542e-03f,
+  -1.121257991e-02f,  3.222593572e-03f,  2.487765625e-02f, -7.232757285e-03f,
+   3.954257071e-02f, -1.162801962e-02f, -2.484150380e-01f,  7.387853414e-02f,
+   5.721561313e-01f, -1.720713675e-01f, -8.635028601e-01f,  2.625830472e-01f,
+   9.522024393e-01f, -2.927501798e-01f, -7.822718620e-01f,  2.431351542e-01f,
+   4.597318172e-01f, -1.444357932e-01f, -1.628815830e-01f,  5.172273144e-02f,
+   4.768214654e-03f, -1.530256821e-03f,  2.450455911e-02f, -7.947219536e-03f,
+  -3.481013933e-03f,  1.140763168e-03f, -7.996763103e-03f,  2.647815505e-03f,
+   2.288110321e-03f, -7.654156070e-04f,  3.412584309e-03f, -1.153226476e-03f,
+  -2.664580708e-03f,  2.038907958e-03f,  1.427105512e-03f, -1.105954871e-03f,
+   4.823706113e-03f, -3.785797395e-03f, -4.955179989e-03f,  3.938353155e-03f,
+  -1.017324999e-02f,  8.188005537e-03f,  1.982253417e-02f, -1.615571044e-02f,
+   3.186038136e-02f, -2.629375458e-02f, -1.929963827e-01f,  1.612770855e-01f,
+   4.417595267e-01f, -3.737828135e-01f, -6.713628173e-01f,  5.751609802e-01f,
+   7.550726533e-01f, -6.549518108e-01f, -6.430945396e-01f,  5.647736788e-01f,
+   4.026837349e-01f, -3.580421507e-01f, -1.633726805e-01f,  1.470659673e-01f,
+   1.996990480e-02f, -1.819971204e-02f,  1.952181198e-02f, -1.801184937e-02f,
+  -7.449931931e-03f,  6.958807819e-03f, -5.296194926e-03f,  5.008254200e-03f,
+   3.786384827e-03f, -3.624794772e-03f,  1.740331296e-03f, -1.686646021e-03f,
+  -2.177351154e-03f,  2.136248862e-03f,  1.736185164e-03f, -9.979337920e-04f,
+   2.287178795e-04f, -1.333373802e-04f, -3.109481419e-03f,  1.838413649e-03f,
+   9.929962689e-04f, -5.953403888e-04f,  5.685077514e-03f, -3.456025617e-03f,
+  -5.005224142e-03f,  3.084953874e-03f, -1.138168387e-02f,  7.111798972e-03f,
+   2.176166512e-02f, -1.378406677e-02f,  2.987366170e-02f, -1.918014139e-02f,
+  -1.934164613e-01f,  1.258641034e-01f,  4.529324174e-01f, -2.987138629e-01f,
+  -7.075316906e-01f,  4.728798866e-01f,  8.267037272e-01f, -5.598974824e-01f,
+  -7.435064316e-01f,  5.102334023e-01f,  5.056598783e-01f, -3.515937626e-01f,
+  -2.384514064e-01f,  1.679790616e-01f,  5.347947776e-02f, -3.816718981e-02f,
+   1.730608195e-02f, -1.251197234e-02f, -1.495646127e-02f,  1.095360611e-02f,
+  -2.486397047e-03f,  1.844498329e-03f,  6.267705932e-03f, -4.709504545e-03f,
+  -3.168598050e-04f,  2.411419991e-04f, -2.981405705e-03f,  2.297984669e-03f,
+  -3.471236676e-03f,  1.254595350e-03f,  8.722307393e-04f, -3.182757937e-04f,
+   6.282935850e-03f, -2.314501675e-03f, -5.718541797e-03f,  2.126538428e-03f,
+  -1.142652892e-02f,  4.289101809e-03f,  2.472367883e-02f, -9.367004037e-03f,
+   2.165915258e-02f, -8.282030001e-03f, -1.828466356e-01f,  7.056067884e-02f,
+   4.542988837e-01f, -1.769175678e-01f, -7.443262339e-01f,  2.924959362e-01f,
+   9.166190624e-01f, -3.634517193e-01f, -8.801498413e-01f,  3.521198332e-01f,
+   6.548274159e-01f, -2.643089294e-01f, -3.567683399e-01f,  1.452773660e-01f,
+   1.160440892e-01f, -4.766914994e-02f,  3.723134287e-03f, -1.542773796e-03f,
+  -2.344873361e-02f,  9.800969623e-03f,  4.469767213e-03f, -1.884377445e-03f,
+   7.498560473e-03f, -3.188394243e-03f, -3.992464859e-03f,  1.712081605e-03f,
+  -2.441259101e-03f,  1.055759494e-03f,  2.813930856e-03f, -1.227188390e-03f,
+   4.892616416e-04f, -2.151616936e-04f, -1.806801767e-03f,  8.011980099e-04f,
+  -3.276972799e-03f,  1.729629119e-03f,  8.983172593e-04f, -4.812141415e-04f,
+   5.636727903e-03f, -3.064163262e-03f, -5.905824248e-03f,  3.257550066e-03f,
+  -8.566353470e-03f,  4.793839529e-03f,  2.319594659e-02f, -1.316829212e-02f,
+   6.982684601e-03f, -4.020908382e-03f, -1.318802834e-01f,  7.702329010e-02f,
+   3.590819240e-01f, -2.126835436e-01f, -6.244801879e-01f,  3.750733733e-01f,
+   8.152862787e-01f, -4.965071678e-01f, -8.379406333e-01f,  5.173785090e-01f,
+   6.811724305e-01f, -4.263785481e-01f, -4.236035943e-01f,  2.687854171e-01f,
+   1.798426062e-01f, -1.156677902e-01f, -2.892264165e-02f,  1.885379665e-02f,
+  -2.095267177e-02f,  1.384234708e-02f,  1.324915048e-02f, -8.870283142e-03f,
+   3.235065844e-03f, -2.194737317e-03f, -6.462562364e-03f,  4.442486912e-03f,
+   6.955243298e-04f, -4.844275827e-04f,  3.023438621e-03f, -2.133472357e-03f,
+  -3.061353462e-03f,  1.978917047e-03f,  1.276444993e-03f, -8.362675435e-04f,
+   4.704566672e-03f, -3.123638220e-03f, -6.360822823e-03f,  4.279789981e-03f,
+  -5.022010300e-03f,  3.423939925e-03f,  2.090845816e-02f, -1.444382872e-02f,
+  -6.197137292e-03f,  4.337472375e-03f, -8.489244431e-02f,  6.019696221e-02f,
+   2.712523639e-01f, -1.948564351e-01f, -5.137444139e-01f,  3.738528490e-01f,
+   7.216842175e-01f, -5.319746733e-01f, -8.012890220e-01f,  5.982764959e-01f,
+   7.143824100e-01f, -5.402468443e-01f, -5.033231974e-01f,  3.855119944e-01f,
+   2.628930509e-01f, -2.039300948e-01f, -8.122427016e-02f,  6.380899996e-02f,
+  -6.118402351e-03f,  4.867563490e-03f,  1.975274459e-02f, -1.591340266e-02f,
+  -4.636076279e-03f,  3.782105166e-03f, -5.928342696e-03f,  4.897224717e-03f,
+   4.307404626e-03f, -3.602909390e-03f,  1.183588523e-03f, -1.002414734e-03f,
+  -2.763044555e-03f,  2.369367750e-03f, -2.929307986e-03f,  1.897271024e-03f,
+   1.848341315e-03f, -1.213307725e-03f,  3.716178937e-03f, -2.472173423e-03f,
+  -6.902908906e-03f,  4.653484561e-03f, -1.423042733e-03f,  9.720740491e-04f,
+   1.801924780e-02f, -1.247170754e-02f, -1.607563347e-02f,  1.127298456e-02f,
+  -4.678384587e-02f,  3.323709592e-02f,  1.990720779e-01f, -1.432747543e-01f,
+  -4.233881831e-01f,  3.086790442e-01f,  6.495483518e-01f, -4.796969593e-01f,
+  -7.857277989e-01f,  5.877512097e-01f,  7.708788514e-01f, -5.840545893e-01f,
+  -6.122428775e-01f,  4.698052108e-01f,  3.805619478e-01f, -2.957522869e-01f,
+  -1.667249203e-01f,  1.312183887e-01f,  3.147729859e-02f, -2.508804388e-02f,
+   1.808000170e-02f, -1.459243149e-02f, -1.499581896e-02f,  1.225588750e-02f,
+  -5.129846977e-04f,  4.245323362e-04f,  6.463169586e-03f, -5.415905267e-03f,
+  -2.603823785e-03f,  2.209247788e-03f, -2.112790244e-03f,  1.815037685e-03f,
+   2.420294564e-03f, -2.105153399e-03f,  5.261962360e-05f, -4.633832577e-05f,
+  -1.490220428e-03f,  1.328653540e-03f, -2.816207707e-03f,  1.477429294e-03f,
+   2.585516311e-03f, -1.376701170e-03f,  2.534386003e-03f, -1.369501464e-03f,
+  -7.313997950e-03f,  4.010427278e-03f,  2.280347049e-03f, -1.268625492e-03f,
+   1.407429017e-02f, -7.943425328e-03f, -2.254672535e-02f,  1.290825475e-02f,
+  -1.563210785e-02f,  9.077364579e-03f,  1.370058358e-01f, -8.068569005e-02f,
+  -3.442307711e-01f,  2.055800110e-01f,  5.882639885e-01f, -3.562355340e-01f,
+  -7.829996347e-01f,  4.807525873e-01f,  8.485953212e-01f, -5.282245874e-01f,
+  -7.568352222e-01f,  4.775747955e-01f,  5.476812720e-01f, -3.503123522e-01f,
+  -3.055113256e-01f,  1.980656087e-01f,  1.117946729e-01f, -7.345562428e-02f,
+  -6.043452304e-03f,  4.024208058e-03f, -2.210780233e-02f,  1.491772570e-02f,
+   1.105790492e-02f, -7.560720202e-03f,  3.525942331e-03f, -2.442707540e-03f,
+  -6.577393971e-03f,  4.616680555e-03f,  1.551461988e-03f, -1.103244256e-03f,
+   2.683784813e-03f, -1.933342195e-03f, -2.297348576e-03f,  1.676468644e-03f,
+  -3.437147534e-04f,  2.540693094e-04f,  1.609078608e-03f, -1.204746775e-03f,
+   1.903094701e-03f, -6.431206712e-04f, -5.897782394e-04f,  2.013243648e-04f,
+  -2.431852510e-03f,  8.384664543e-04f,  3.356508678e-03f, -1.168808085e-03f,
+   7.910868735e-04f, -2.781976073e-04f, -6.920749787e-03f,  2.457670169e-03f,
+   5.945195910e-03f, -2.131797373e-03f,  8.006962948e-03f, -2.898849547e-03f,
+  -2.414609492e-02f,  8.825760335e-03f,  9.757354856e-03f, -3.600432537e-03f,
+   7.668243349e-02f, -2.856316604e-02f, -2.569730580e-01f,  9.661778063e-02f,
+   5.071415901e-01f, -1.924550533e-01f, -7.552579045e-01f,  2.892665565e-01f,
+   9.108669758e-01f, -3.520736098e-01f, -9.113950133e-01f,  3.554954231e-01f,
+   7.567282319e-01f, -2.978446782e-01f, -5.092178583e-01f,  2.022322267e-01f,
+   2.591480315e-01f, -1.038403735e-01f, -7.842770964e-02f,  3.170549870e-02f,
+  -8.776010014e-03f,  3.579188604e-03f,  2.391924337e-02f, -9.840868413e-03f,
+  -8.222425357e-03f,  3.412408289e-03f, -5.682080518e-03f,  2.378594596e-03f,
+   6.845383905e-03f, -2.890282543e-03f, -8.909413591e-04f,  3.794012882e-04f,
+  -3.236852121e-03f,  1.390138059e-03f,  2.411393682e-03f, -1.044400851e-03f,
+   5.219965242e-04f, -2.279867622e-04f, -1.839523437e-03f,  8.101579733e-04f,
+   3.150436096e-03f, -2.056669444e-03f, -9.945755592e-04f,  6.580179324e-04f,
+  -4.390587099e-03f,  2.943733474e-03f,  6.833042949e-03f, -4.642339423e-03f,
+   6.663348177e-04f, -4.587058211e-04f, -1.596780121e-02f,  1.113727968e-02f,
+   2.012584917e-02f, -1.422180887e-02f,  1.895652898e-02f, -1.357067470e-02f,
+  -1.291016936e-01f,  9.362526238e-02f,  3.112572730e-01f, -2.286528349e-01f,
+  -5.273195505e-01f,  3.923787773e-01f,  7.100613117e-01f, -5.351573825e-01f,
+  -7.930912375e-01f,  6.054012775e-01f,  7.444662452e-01f, -5.755475163e-01f,
+  -5.835132003e-01f,  4.568622708e-01f,  3.703415990e-01f, -2.936424613e-01f,
+  -1.747923046e-01f,  1.403475106e-01f,  4.399753362e-02f, -3.577354178e-02f,
+   1.312064379e-02f, -1.080254372e-02f, -1.868938841e-02f,  1.558081713e-02f,
+   4.934181459e-03f, -4.165070597e-03f,  5.225018598e-03f, -4.465764854e-03f,
+  -5.384120159e-03f,  4.659218714e-03f,  5.362440133e-04f, -4.698309349e-04f,
+   2.647252055e-03f, -2.348261420e-03f, -1.994949998e-03f,  1.791625516e-03f,
+  -3.216148471e-04f,  2.924208820e-04f,  1.474681660e-03f, -1.357442117e-03f,
+   3.326743376e-03f, -7.864927175e-04f, -2.742999000e-03f,  6.573789287e-04f,
+  -2.436196897e-03f,  5.917609087e-04f,  7.801868487e-03f, -1.920468872e-03f,
+  -5.040435120e-03f,  1.257141586e-03f, -9.600200690e-03f,  2.425707877e-03f,
+   2.499951981e-02f, -6.398351863e-03f, -1.204989478e-02f,  3.123459406e-03f,
+  -6.561043113e-02f,  1.722189970e-02f,  2.294308692e-01f, -6.097566336e-02f,
+  -4.647097588e-01f,  1.250332147e-01f,  7.155673504e-01f, -1.948843002e-01f,
+  -9.035099149e-01f,  2.490503788e-01f,  9.623097181e-01f, -2.684377730e-01f,
+  -8.703237772e-01f,  2.456585020e-01f,  6.613848209e-01f, -1.888758391e-01f,
+  -4.077621996e-01f,  1.178014427e-01f,  1.853841096e-01f, -5.417375639e-02f,
+  -4.140348360e-02f,  1.223710366e-02f, -1.895504817e-02f,  5.665594712e-03f,
+   2.255907096e-02f, -6.818286609e-03f, -5.608732812e-03f,  1.713988371e-03f,
+  -6.581262220e-03f,  2.033283934e-03f,  6.917306222e-03f, -2.160374541e-03f,
+  -1.031392254e-03f,  3.255949414e-04f, -3.221836640e-03f,  1.027965220e-03f,
+   2.835139167e-03f, -9.141777991e-04f, -1.890486688e-03f,  6.544395583e-04f,
+   5.091745988e-04f, -1.780148013e-04f,  2.278147964e-03f, -8.043255075e-04f,
+  -3.497280646e-03f,  1.246834057e-03f,  5.155082908e-04f, -1.855711162e-04f,
+   5.329498556e-03f, -1.936986810e-03f, -7.745218463e-03f,  2.841902198e-03f,
+  -1.423927097e-05f,  5.274345767e-06f,  1.641109958e-02f, -6.136131007e-03f,
+  -2.459358238e-02f,  9.281671606e-03f, -5.725478288e-03f,  2.180898795e-03f,
+   1.046810150e-01f, -4.024235532e-02f, -2.822783589e-01f,  1.095110029e-01f,
+   5.137284398e-01f, -2.011184543e-01f, -7.411810160e-01f,  2.927889824e-01f,
+   8.944215178e-01f, -3.564997315e-01f, -9.214712977e-01f,  3.705614507e-01f,
+   8.129246831e-01f, -3.298113048e-01f, -6.064195037e-01f,  2.481996119e-01f,
+   3.687217534e-01f, -1.522354037e-01f, -1.655665785e-01f,  6.895332783e-02f,
+   3.565026820e-02f, -1.497573592e-02f,  1.862315647e-02f, -7.890401408e-03f,
+  -2.179874852e-02f,  9.314845316e-03f,  6.027547643e-03f, -2.597535262e-03f,
+   5.906721111e-03f, -2.566981362e-03f, -6.989403628e-03f,  3.063027747e-03f,
+   1.710386015e-03f, -7.558211219e-04f,  2.762210788e-03f, -1.230766415e-03f,
+  -3.053783905e-03f,  1.371927909e-03f, -3.264206927e-03f,  1.243383507e-03f,
+   2.656759229e-03f, -1.021342352e-03f,  1.943377662e-03f, -7.539473590e-04f,
+  -7.122755516e-03f,  2.788495738e-03f,  6.139701232e-03f, -2.425388200e-03f,
+   5.249925889e-03f, -2.092539798e-03f, -2.102800272e-02f,  8.456292562e-03f,
+   2.098889463e-02f, -8.515465073e-03f,  2.420899644e-02f, -9.908507578e-03f,
+  -1.387847513e-01f,  5.730098858e-02f,  3.247180283e-01f, -1.352360398e-01f,
+  -5.519158244e-01f,  2.318471074e-01f,  7.635208368e-01f, -3.234968781e-01f,
+  -8.963499665e-01f,  3.830232322e-01f,  9.074338078e-01f, -3.910561800e-01f,
+  -7.931786776e-01f,  3.447074294e-01f,  5.909594297e-01f, -2.589833438e-01f,
+  -3.623058498e-01f,  1.601045132e-01f,  1.666899472e-01f, -7.427309453e-02f,
+  -3.937122971e-02f,  1.768785715e-02f, -1.658277400e-02f,  7.511179429e-03f,
+   2.260199748e-02f, -1.032127626e-02f, -8.105817251e-03f,  3.731644712e-03f,
+  -4.681897350e-03f,  2.172820270e-03f,  7.410730235e-03f, -3.466915572e-03f,
+  -2.959471196e-03f,  1.395593514e-03f, -1.997227548e-03f,  9.493305115e-04f,
+   3.334016539e-03f, -1.597296679e-03f, -1.388668665e-03f,  6.705443957e-04f,
+  -1.045557321e-03f,  5.088282633e-04f,  1.780763152e-03f, -8.733890136e-04f,
+   1.897517592e-03f, -5.629536463e-04f, -4.841567134e-04f,  1.452567230e-04f,
+  -2.195571316e-03f,  6.660644431e-04f,  3.594157752e-03f, -1.102402573e-03f,
+  -1.290633460e-03f,  4.002001951e-04f, -4.161574878e-03f,  1.304431469e-03f,
+   8.004372939e-03f, -2.535939449e-03f, -3.874815535e-03f,  1.240709913e-03f,
+  -9.954785928e-03f,  3.221212653e-03f,  2.410812303e-02f, -7.882799022e-03f,
+  -1.652092673e-02f,  5.458121654e-03f, -4.076944292e-02f,  1.360812970e-02f,
+   1.676697731e-01f, -5.653754622e-02f, -3.613156080e-01f,  1.230699345e-01f,
+   5.892115235e-01f, -2.027145028e-01f, -7.960098982e-01f,  2.765962481e-01f,
+   9.228205085e-01f, -3.238366246e-01f, -9.307726026e-01f,  3.298378587e-01f,
+   8.174407482e-01f, -2.925023437e-01f, -6.178570390e-01f,  2.232265323e-01f,
+   3.896070123e-01f, -1.421145648e-01f, -1.895653605e-01f,  6.980629265e-02f,
+   5.359631032e-02f, -1.992345601e-02f,  1.189880539e-02f, -4.464762285e-03f,
+  -2.459022403e-02f,  9.313098155e-03f,  1.209464576e-02f, -4.623103887e-03f,
+   2.386915963e-03f, -9.207867552e-04f, -7.848866284e-03f,  3.055508016e-03f,
+   4.832614679e-03f, -1.898396295e-03f,  6.277758512e-04f, -2.488351311e-04f,
+  -3.423416289e-03f,  1.369126956e-03f,  2.462804550e-03f, -9.937245632e-04f,
+   2.261741087e-03f, -2.096609212e-03f, -2.548652003e-03f,  2.391815651e-03f,
+  -2.770635001e-05f,  2.632297037e-05f,  4.181061871e-03f, -4.021399189e-03f,
+  -5.983231589e-03f,  5.825845059e-03f,  1.360706869e-03f, -1.341276919e-03f,
+   9.514302947e-03f, -9.494249709e-03f, -1.850190386e-02f,  1.869088039e-02f,
+   9.547594935e-03f, -9.764222428e-03f,  3.589406982e-02f, -3.716192394e-02f,
+  -1.295135617e-01f,  1.357452869e-01f,  2.672119737e-01f, -2.835323513e-01f,
+  -4.257296920e-01f,  4.573215842e-01f,  5.678576827e-01f, -6.175512671e-01f,
+  -6.550317407e-01f,  7.211856842e-01f,  6.620530486e-01f, -7.379639149e-01f,
+  -5.871416330e-01f,  6.625977159e-01f,  4.525349736e-01f, -5.170493126e-01f,
+  -2.954041958e-01f,  3.417259753e-01f,  1.535076946e-01f, -1.797971129e-01f,
+  -5.224706978e-02f,  6.196068600e-02f, -1.455846359e-03f,  1.748166978e-03f,
+   1.686765999e-02f, -2.050914243e-02f, -1.130538061e-02f,  1.391926594e-02f,
+   9.957248112e-04f, -1.241432037e-03f,  4.754768685e-03f, -6.003165618e-03f,
+  -4.363963380e-03f,  5.579756107e-03f,  9.440222057e-04f, -1.222408027e-03f,
+   1.780406572e-03f, -2.334913006e-03f, -2.120917896e-03f,  2.817159984e-03f,
+   7.265088498e-04f, -9.774270002e-04f,  7.477163454e-04f, -1.018958748e-03f,
+  -1.164168702e-03f,  1.607065205e-03f, -1.778534031e-03f,  9.341914556e-04f,
+   9.598305332e-04f, -5.116985994e-04f,  1.231160364e-03f, -6.660814397e-04f,
+  -3.126212629e-03f,  1.716220868e-03f,  2.560197376e-03f, -1.426004106e-03f,
+   1.199407619e-03f, -6.777337985e-04f, -5.922836252e-03f,  3.394854022e-03f,
+   6.892192177e-03f, -4.006852396e-03f, -5.757492181e-05f,  3.394619489e-05f,
+  -1.324411854e-02f,  7.918650284e-03f,  2.275169268e-02f, -1.379343215e-02f,
+  -9.918879718e-03f,  6.096959580e-03f, -4.594836757e-02f,  2.863358147e-02f,
+   1.577266902e-01f, -9.963913262e-02f, -3.210720122e-01f,  2.055947036e-01f,
+   5.107012987e-01f, -3.314575851e-01f, -6.854498982e-01f,  4.508751631e-01f,
+   8.011581302e-01f, -5.340571404e-01f, -8.264127970e-01f,  5.582463741e-01f,
+   7.543464303e-01f, -5.163339376e-01f, -6.051962972e-01f,  4.197201729e-01f,
+   4.184904397e-01f, -2.940537632e-01f, -2.384533733e-01f,  1.697450876e-01f,
+   9.910228848e-02f, -7.146707922e-02f, -1.515618805e-02f,  1.107179374e-02f,
+  -1.832745038e-02f,  1.356168836e-02f,  1.891363785e-02f, -1.417586580e-02f,
+  -6.735850126e-03f,  5.113400519e-03f, -3.667054232e-03f,  2.819412854e-03f,
+   6.624270696e-03f, -5.158047657e-03f, -3.687081859e-03f,  2.907494782e-03f,
+  -6.371522904e-04f,  5.088059697e-04f,  2.847160678e-03f, -2.302387729e-03f,
+  -2.211883431e-03f,  1.811223221e-03f,  3.650815459e-03f, -7.225364097e-04f,
+  -2.432113979e-03f,  4.891006392e-04f, -2.059231047e-03f,  4.206907470e-04f,
+   7.079414558e-03f, -1.468929579e-03f, -7.578367367e-03f,  1.596725429e-03f,
+  -4.555271880e-04f,  9.743790724e-05f,  1.527981181e-02f, -3.317428520e-03f,
+  -2.594356425e-02f,  5.716057029e-03f,  1.290828455e-02f, -2.885591239e-03f,
+   4.597706348e-02f, -1.042618044e-02f, -1.656013578e-01f,  3.808784112e-02f,
+   3.438430130e-01f, -8.019440621e-02f, -5.568671227e-01f,  1.316806227e-01f,
+   7.628076673e-01f, -1.828516573e-01f, -9.136137366e-01f,  2.219673842e-01f,
+   9.709347486e-01f, -2.390508056e-01f, -9.196638465e-01f,  2.294223607e-01f,
+   7.734084129e-01f, -1.954593956e-01f, -5.695294142e-01f,  1.457944810e-01f,
+   3.559023142e-01f, -9.227219969e-02f, -1.750162691e-01f,  4.594868794e-02f,
+   5.182138085e-02f, -1.377524156e-02f,  1.040479541e-02f, -2.800024580e-03f,
+  -2.575309202e-02f,  7.015191484e-03f,  1.612919942e-02f, -4.446825013e-03f,
+  -1.324208686e-03f,  3.694598563e-04f, -7.196129300e-03f,  2.031567041e-03f,
+   7.193236612e-03f, -2.054598648e-03f, -2.397077391e-03f,  6.926365313e-04f,
+  -2.164388075e-03f,  6.326019065e-04f,  3.597059287e-03f, -1.063328586e-03f,
+  -2.063909546e-03f,  6.170049892e-04f,  1.982562477e-03f, -9.513072437e-04f,
+  -3.374411026e-03f,  1.631922903e-03f,  2.128826454e-03f, -1.037607668e-03f,
+   1.933546737e-03f, -9.497790015e-04f, -6.422560662e-03f,  3.179326653e-03f,
+   7.057215087e-03f, -3.520494327e-03f, -3.534744901e-04f,  1.776872668e-04f,
+  -1.259301230e-02f,  6.378824823e-03f,  2.322203480e-02f, -1.185247954e-02f,
+  -1.569249853e-02f,  8.070200682e-03f, -2.876211144e-02f,  1.490328182e-02f,
+   1.241909042e-01f, -6.483443826e-02f, -2.718616426e-01f,  1.429897100e-01f,
+   4.555279911e-01f, -2.413788289e-01f, -6.429098248e-01f,  3.432005942e-01f,
+   7.938345075e-01f, -4.269024134e-01f, -8.725252151e-01f,  4.726768434e-01f,
+   8.594445586e-01f, -4.690068662e-01f, -7.579786777e-01f,  4.166590273e-01f,
+   5.932340622e-01f, -3.284732699e-01f, -4.034566581e-01f,  2.250137031e-01f,
+   2.275747657e-01f, -1.278387308e-01f, -9.376116097e-02f,  5.304883793e-02f,
+   1.313259639e-02f, -7.483531255e-03f,  1.976579241e-02f, -1.134389173e-02f,
+  -2.096442133e-02f,  1.211745664e-02f,  8.852822706e-03f, -5.153238773e-03f,
+   2.648438094e-03f, -1.552556991e-03f, -7.211280521e-03f,  4.257149063e-03f,
+   5.267088767e-03f, -3.131234087e-03f, -7.202157867e-04f,  4.311574157e-04f,
+  -2.601697342e-03f,  1.568369451e-03f,  3.059095005e-03f, -1.856919844e-03f,
+  -1.346953097e-03f,  8.232878754e-04f, -7.242827560e-04f,  4.457557516e-04f,
+   1.693390077e-03f, -1.049364102e-03f, -1.987327356e-03f,  1.284088125e-03f,
+   3.144472837e-03f, -2.059222665e-03f, -1.948029501e-03f,  1.292855362e-03f,
+  -1.693921862e-03f,  1.139244065e-03f,  5.760325119e-03f, -3.925641999e-03f,
+  -6.668071728e-03f,  4.604437388e-03f,  1.365898410e-03f, -9.556104196e-04f,
+   9.701048024e-03f, -6.876095198e-03f, -2.021492086e-02f,  1.451548841e-02f,
+   1.782285981e-02f, -1.296433154e-02f,  1.288827881e-02f, -9.496389888e-03f,
+  -8.473957330e-02f,  6.324402988e-02f,  2.015530020e-01f, -1.523603350e-01f,
+  -3.537122607e-01f,  2.708088756e-01f,  5.180372000e-01f, -4.016848803e-01f,
+  -6.627810001e-01f,  5.204620361e-01f,  7.564619184e-01f, -6.015670896e-01f,
+  -7.775043249e-01f,  6.261268258e-01f,  7.211194634e-01f, -5.880504847e-01f,
+  -6.007999778e-01f,  4.961025417e-01f,  4.438748062e-01f, -3.711276948e-01f,
+  -2.828696370e-01f,  2.394741029e-01f,  1.459500492e-01f, -1.251050085e-01f,
+  -4.986079782e-02f,  4.327307642e-02f, -2.473787405e-03f,  2.173699439e-03f,
+   1.952586509e-02f, -1.737070829e-02f, -1.559748873e-02f,  1.404831652e-02f,
+   4.714402836e-03f, -4.298844840e-03f,  3.690195037e-03f, -3.406620817e-03f,
+  -6.150812376e-03f,  5.748454481e-03f,  3.883101512e-03f, -3.673982574e-03f,
+  -1.301561279e-04f,  1.246691681e-04f, -2.331961645e-03f,  2.261252841e-03f,
+   2.497409470e-03f, -2.451594919e-03f,  1.752717420e-03f, -1.382644754e-03f,
+  -2.915361430e-03f,  2.328967210e-03f,  2.073350595e-03f, -1.677261782e-03f,
+   1.009692671e-03f, -8.271040278e-04f, -4.828775767e-03f,  4.005321302e-03f,
+   6.429297850e-03f, -5.399839021e-03f, -2.931766212e-03f,  2.493169857e-03f,
+  -6.120640785e-03f,  5.270039663e-03f,  1.663110219e-02f, -1.449848246e-02f,
+  -1.930682175e-02f,  1.704071276e-02f,  1.390905236e-03f, -1.242915867e-03f,
+   4.928644747e-02f, -4.458938539e-02f, -1.391201764e-01f,  1.274228394e-01f,
+   2.643802464e-01f, -2.451509535e-01f, -4.096927941e-01f,  3.845965266e-01f,
+   5.504730344e-01f, -5.231441855e-01f, -6.589561701e-01f,  6.339818835e-01f,
+   7.119937539e-01f, -6.934720278e-01f, -6.979454756e-01f,  6.881846786e-01f,
+   6.202009320e-01f, -6.190784574e-01f, -4.960596263e-01f,  5.012758970e-01f,
+   3.514093459e-01f, -3.594898582e-01f, -2.131577432e-01f,  2.207528353e-01f,
+   1.020860001e-01f, -1.070299894e-01f, -2.844333090e-02f,  3.018957563e-02f,
+  -8.604902774e-03f,  9.246207774e-03f,  1.807434857e-02f, -1.966193318e-02f,
+  -1.238584425e-02f,  1.364082284e-02f,  2.713889349e-03f, -3.025971586e-03f,
+   3.962041810e-03f, -4.472565372e-03f, -5.485391710e-03f,  6.269287784e-03f,
+   3.232480027e-03f, -3.740487155e-03f,  4.523527241e-05f, -5.299818440e-05f,
+  -2.123115584e-03f,  2.518601250e-03f,  2.241017530e-03f, -2.691810019e-03f,
+   2.820785157e-03f, -2.286138013e-03f, -2.399323042e-03f,  1.969073666e-03f,
+  -2.026776492e-04f,  1.684250165e-04f,  3.946376964e-03f, -3.320583608e-03f,
+  -6.353706121e-03f,  5.413107108e-03f,  4.586185794e-03f, -3.956071101e-03f,
+   2.645106288e-03f, -2.310142154e-03f, -1.307404879e-02f,  1.156058628e-02f,
+   1.980977133e-02f, -1.773435064e-02f, -1.208141632e-02f,  1.094995812e-02f,
+  -2.194728330e-02f,  2.013852447e-02f,  9.092475474e-02f, -8.446477354e-02f,
+  -1.960305572e-01f,  1.843567640e-01f,  3.283747137e-01f, -3.126387000e-01f,
+  -4.693964422e-01f,  4.524258077e-01f,  5.945894718e-01f, -5.801722407e-01f,
+  -6.796437502e-01f,  6.713540554e-01f,  7.071067691e-01f, -7.071067691e-01f,
+  -6.713540554e-01f,  6.796437502e-01f,  5.801722407e-01f, -5.945894718e-01f,
+  -4.524258077e-01f,  4.693964422e-01f,  3.126387000e-01f, -3.283747137e-01f,
+  -1.843567640e-01f,  1.960305572e-01f,  8.446477354e-02f, -9.092475474e-02f,
+  -2.013852447e-02f,  2.194728330e-02f, -1.094995812e-02f,  1.208141632e-02f,
+   1.773435064e-02f, -1.980977133e-02f, -1.156058628e-02f,  1.307404879e-02f,
+   2.310142154e-03f, -2.645106288e-03f,  3.956071101e-03f, -4.586185794e-03f,
+  -5.413107108e-03f,  6.353706121e-03f,  3.320583608e-03f, -3.946376964e-03f,
+  -1.684250165e-04f,  2.026776492e-04f, -1.969073666e-03f,  2.399323042e-03f,
+   2.286138013e-03f, -2.820785157e-03f, -2.804251388e-03f,  1.901006675e-03f,
+   2.897904022e-03f, -1.990555320e-03f, -7.876090240e-04f,  5.481477128e-04f,
+  -2.949042944e-03f,  2.079403726e-03f,  6.252756808e-03f, -4.466581624e-03f,
+  -6.278847810e-03f,  4.543662071e-03f,  9.581446648e-04f, -7.023552898e-04f,
+   9.071244858e-03f, -6.735512987e-03f, -1.900603250e-02f,  1.429396216e-02f,
+   1.977058128e-02f, -1.505976915e-02f,  2.351520379e-04f, -1.814122661e-04f,
+  -5.171531811e-02f,  4.040530324e-02f,  1.403194219e-01f, -1.110251695e-01f,
+  -2.631758451e-01f,  2.108716965e-01f,  4.075399041e-01f, -3.306709230e-01f,
+  -5.524010658e-01f,  4.538579285e-01f,  6.729163527e-01f, -5.598257184e-01f,
+  -7.465119362e-01f,  6.288435459e-01f,  7.588167191e-01f, -6.472101808e-01f,
+  -7.075466514e-01f,  6.110202074e-01f,  6.030842662e-01f, -5.273036957e-01f,
+  -4.655790329e-01f,  4.121446013e-01f,  3.195355833e-01f, -2.863787413e-01f,
+  -1.876335740e-01f,  1.702512205e-01f,  8.567158878e-02f, -7.869882137e-02f,
+  -2.001715638e-02f,  1.861572638e-02f, -1.199553255e-02f,  1.129375957e-02f,
+   1.927844808e-02f, -1.837505028e-02f, -1.306454651e-02f,  1.260622498e-02f,
+   3.266835818e-03f, -3.191170515e-03f,  3.804306965e-03f, -3.762085456e-03f,
+  -5.958741531e-03f,  5.965369288e-03f,  4.163307603e-03f, -4.219403490e-03f,
+  -8.351933793e-04f,  8.569002384e-04f, -1.783803920e-03f,  1.852774876e-03f,
+   2.590809483e-03f, -2.724243095e-03f, -1.752997632e-03f,  1.866077888e-03f,
+   2.157903946e-04f, -2.325534297e-04f,  1.002257923e-03f, -1.093496103e-03f,
+  -1.341008232e-03f,  1.481228392e-03f,  1.797344303e-03f, -8.915998042e-04f,
+  -1.104640542e-03f,  5.522030406e-04f, -6.035099505e-04f,  3.040087468e-04f,
+   2.507764380e-03f, -1.272908179e-03f, -3.350287909e-03f,  1.713508973e-03f,
+   2.098297467e-03f, -1.081311144e-03f,  1.279010554e-03f, -6.640836364e-04f,
+  -5.347100087e-03f,  2.797164023e-03f,  7.458921988e-03f, -3.931088839e-03f,
+  -4.883638583e-03f,  2.593008336e-03f, -3.424938070e-03f,  1.831991016e-03f,
+   1.505002566e-02f, -8.109703660e-03f, -2.315762080e-02f,  1.257030759e-02f,
+   1.707788371e-02f, -9.338079952e-03f,  1.532992069e-02f, -8.443500847e-03f,
+  -8.395183086e-02f,  4.657573253e-02f,  1.923882067e-01f, -1.075085029e-01f,
+  -3.349997997e-01f,  1.885523349e-01f,  4.962597489e-01f, -2.813247144e-01f,
+  -6.530041099e-01f,  3.728333414e-01f,  7.792442441e-01f, -4.480858743e-01f,
+  -8.523070216e-01f,  4.935844839e-01f,  8.585319519e-01f, -5.007130504e-01f,
+  -7.968026996e-01f,  4.679932594e-01f,  6.788215041e-01f, -4.015043676e-01f,
+  -5.260463357e-01f,  3.133244812e-01f,  3.642483652e-01f, -2.184708863e-01f,
+  -2.173479646e-01f,  1.312705278e-01f,  1.023207083e-01f, -6.222733110e-02f,
+  -2.650892362e-02f,  1.623327658e-02f, -1.218560152e-02f,  7.513600402e-03f,
+   2.268633991e-02f, -1.408456545e-02f, -1.684891433e-02f,  1.053221617e-02f,
+   5.660320166e-03f, -3.562450642e-03f,  3.358244663e-03f, -2.127999207e-03f,
+  -7.024055347e-03f,  4.481153097e-03f,  5.787036847e-03f, -3.716998966e-03f,
+  -2.086126013e-03f,  1.348971855e-03f, -1.418406609e-03f,  9.233815363e-04f,
+   3.077287460e-03f, -2.016780432e-03f, -2.652497264e-03f,  1.750039752e-03f,
+  -1.955967164e-03f,  3.496781574e-04f,  1.582622528e-03f, -2.879468375e-04f,
+  -4.515489491e-05f,  8.358809282e-06f, -2.057503210e-03f,  3.874053073e-04f,
+   3.555157920e-03f, -6.806976162e-04f, -3.223493928e-03f,  6.274528569e-04f,
+   5.229397211e-04f, -1.034563174e-04f,  3.781626234e-03f, -7.602053229e-04f,
+  -7.514140103e-03f,  1.534537296e-03f,  7.759631611e-03f, -1.609486295e-03f,
+  -2.288165502e-03f,  4.819331516e-04f, -8.660576306e-03f,  1.851856592e-03f,
+   2.090944909e-02f, -4.538110923e-03f, -2.593594603e-02f,  5.712417886e-03f,
+   1.203730609e-02f, -2.689976478e-03f,  3.290850669e-02f, -7.460140157e-03f,
+  -1.176640391e-01f,  2.705346234e-02f,  2.439083755e-01f, -5.686813593e-02f,
+  -4.038226008e-01f,  9.545992315e-02f,  5.799976587e-01f, -1.389862895e-01f,
+  -7.480494976e-01f,  1.816855371e-01f,  8.814948797e-01f, -2.169626951e-01f,
+  -9.576862454e-01f,  2.388342023e-01f,  9.631842971e-01f, -2.433465570e-01f,
+  -8.970358968e-01f,  2.295643240e-01f,  7.710013986e-01f, -1.998325884e-01f,
+  -6.066666842e-01f,  1.592272222e-01f,  4.302871525e-01f, -1.143463999e-01f,
+  -2.668433785e-01f,  7.178933173e-02f,  1.349428445e-01f, -3.674823791e-02f,
+  -4.384924844e-02f,  1.208584849e-02f, -6.804028060e-03f,  1.897823997e-03f,
+   2.489167079e-02f, -7.025326136e-03f, -2.220694534e-02f,  6.341220811e-03f,
+   1.064357068e-02f, -3.074632725e-03f,  7.395918365e-04f, -2.161081793e-04f,
+  -7.118251175e-03f,  2.103671897e-03f,  7.707953453e-03f, -2.303684596e-03f,
+  -4.426854663e-03f,  1.337866997e-03f,  1.357174915e-04f, -4.147085201e-05f,
+   2.851586556e-03f, -8.809264982e-04f, -3.553006798e-03f,  1.109564910e-03f,
+   2.320918953e-03f, -7.326198393e-04f, -2.900017425e-04f,  9.252109157e-05f,
+  -1.350678853e-03f,  4.354857374e-04f,  1.910865773e-03f, -6.225794205e-04f,
+  -2.411966911e-03f,  1.714070560e-03f,  3.051199019e-03f, -2.196643269e-03f,
+  -1.977137057e-03f,  1.441897359e-03f, -8.267306839e-04f,  6.107284571e-04f,
+   4.329480231e-03f, -3.239554819e-03f, -6.599672139e-03f,  5.001696758e-03f,
+   5.506028887e-03f, -4.226295743e-03f,  1.489978895e-04f, -1.158269733e-04f,
+  -9.409360588e-03f,  7.407655474e-03f,  1.834242605e-02f, -1.462353207e-02f,
+  -2.006905712e-02f,  1.620249636e-02f,  5.891243462e-03f, -4.816227593e-03f,
+   3.258608654e-02f, -2.697514184e-02f, -1.008177847e-01f,  8.450599760e-02f,
+   1.989130527e-01f, -1.688187718e-01f, -3.202594519e-01f,  2.752045095e-01f,
+   4.517612457e-01f, -3.930507600e-01f, -5.758460760e-01f,  5.072510242e-01f,
+   6.738712788e-01f, -6.009826064e-01f, -7.301118970e-01f,  6.592274904e-01f,
+   7.352907062e-01f, -6.721391082e-01f, -6.886957288e-01f,  6.373467445e-01f,
+   5.983074307e-01f, -5.605520606e-01f, -4.789113402e-01f,  4.542402625e-01f,
+   3.487287760e-01f, -3.348526359e-01f, -2.254875004e-01f,  2.191902399e-01f,
+   1.229596734e-01f, -1.210019514e-01f, -4.879571870e-02f,  4.861175269e-02f,
+   4.057359416e-03f, -4.091972020e-03f,  1.565195993e-02f, -1.598041691e-02f,
+  -1.798664033e-02f,  1.859092712e-02f,  1.133788750e-02f, -1.186360884e-02f,
+  -2.714530099e-03f,  2.875517588e-03f, -3.489129711e-03f,  3.741786117e-03f,
+   5.698862951e-03f, -6.187213585e-03f, -4.528954159e-03f,  4.978004843e-03f,
+   1.713447971e-03f, -1.906711375e-03f,  9.562725318e-04f, -1.077356515e-03f,
+  -2.351981355e-03f,  2.682768740e-03f,  2.246853430e-03f, -2.594802994e-03f,
+  -3.380179638e-03f,  6.832451909e-04f,  3.507732879e-03f, -7.202361594e-04f,
+  -1.544694533e-03f,  3.221111838e-04f, -2.194068162e-03f,  4.645519657e-04f,
+   6.232795306e-03f, -1.339667477e-03f, -8.237752132e-03f,  1.797067933e-03f,
+   5.892363377e-03f, -1.304371399e-03f,  1.824863954e-03f, -4.098405479e-04f,
+  -1.334411185e-02f,  3.039946780e-03f,  2.369150147e-02f, -5.473715253e-03f,
+  -2.461599186e-02f,  5.766919348e-03f,  5.888875108e-03f, -1.398690394e-03f,
+   4.234291241e-02f, -1.019437052e-02f, -1.266454458e-01f,  3.090220131e-02f,
+   2.475993484e-01f, -6.122108921e-02f, -3.981507421e-01f,  9.974340349e-02f,
+   5.636562705e-01f, -1.430445313e-01f, -7.238507867e-01f,  1.860642731e-01f,
+   8.564363718e-01f, -2.229484618e-01f, -9.415091872e-01f,  2.481814474e-01f,
+   9.657499194e-01f, -2.577426136e-01f, -9.253149629e-01f,  2.499947250e-01f,
+   8.266764879e-01f, -2.260689288e-01f, -6.851931810e-01f,  1.896391362e-01f,
+   5.217874050e-01f, -1.461386532e-01f, -3.585909009e-01f,  1.016191617e-01f,
+   2.146547735e-01f, -6.154192984e-02f, -1.027406827e-01f,  2.979736216e-02f,
+   2.785925940e-02f, -8.172623813e-03f,  1.229037903e-02f, -3.646419616e-03f,
+  -2.533494495e-02f,  7.601243909e-03f,  2.141117118e-02f, -6.495662034e-03f,
+  -1.035675500e-02f,  3.176734783e-03f, -3.841550206e-04f,  1.191228148e-04f,
+   6.744849961e-03f, -2.114218194e-03f, -7.891296409e-03f,  2.500194125e-03f,
+   5.252238829e-03f, -1.681811758e-03f, -1.203106833e-03f,  3.893186513e-04f,
+  -2.118929289e-03f,  6.928623770e-04f,  3.540016944e-03f, -1.169573516e-03f,
+  -3.008329775e-03f,  1.004158519e-03f,  1.736181905e-03f, -9.979320457e-04f,
+  -1.161500695e-03f,  6.723627448e-04f, -2.287175885e-04f,  1.333372056e-04f,
+   1.929805148e-03f, -1.132979873e-03f, -3.109478625e-03f,  1.838412136e-03f,
+   2.932387637e-03f, -1.745874062e-03f, -9.929956868e-04f,  5.953400396e-04f,
+  -2.314569894e-03f,  1.397347078e-03f,  5.685075652e-03f, -3.456024453e-03f,
+  -7.192923222e-03f,  4.402942024e-03f,  5.005222745e-03f, -3.084953176e-03f,
+   1.625695033e-03f, -1.008887310e-03f, -1.138168294e-02f,  7.111798041e-03f,
+   2.027685381e-02f, -1.275657304e-02f, -2.176166512e-02f,  1.378406677e-02f,
+   7.698667701e-03f, -4.909576848e-03f,  2.987366170e-02f, -1.918013953e-02f,
+  -9.653951973e-02f,  6.240150332e-02f,  1.934164613e-01f, -1.258641034e-01f,
+  -3.157858849e-01f,  2.068768293e-01f,  4.529324174e-01f, -2.987138629e-01f,
+  -5.894032121e-01f,  3.913178742e-01f,  7.075316906e-01f, -4.728798866e-01f,
+  -7.907154560e-01f,  5.319926143e-01f,  8.267037272e-01f, -5.598974824e-01f,
+  -8.101058602e-01f,  5.522892475e-01f,  7.435064316e-01f, -5.102334023e-01f,
+  -6.369102001e-01f,  4.399617314e-01f,  5.056598783e-01f, -3.515937626e-01f,
+  -3.673449159e-01f,  2.570964992e-01f,  2.384514064e-01f, -1.679790616e-01f,
+  -1.315298229e-01f,  9.326235950e-02f,  5.347947776e-02f, -3.816718981e-02f,
+  -5.225399975e-03f,  3.753509140e-03f, -1.730608009e-02f,  1.251197141e-02f,
+   2.131803893e-02f, -1.551235188e-02f, -1.495645940e-02f,  1.095360518e-02f,
+   5.381233059e-03f, -3.966454417e-03f,  2.486396581e-03f, -1.844498096e-03f,
+  -6.367964204e-03f,  4.754341207e-03f,  6.267704070e-03f, -4.709503148e-03f,
+  -3.622729331e-03f,  2.739519812e-03f,  3.168596595e-04f, -2.411418827e-04f,
+   2.126560314e-03f, -1.628717757e-03f, -2.981403377e-03f,  2.297982806e-03f,
+   2.350547351e-03f, -1.823259285e-03f,  1.943025738e-03f, -1.725607668e-03f,
+  -2.760647098e-03f,  2.482205629e-03f,  2.381264931e-03f, -2.167658880e-03f,
+  -5.815840559e-04f,  5.359767238e-04f, -2.225292847e-03f,  2.076182049e-03f,
+   4.952325951e-03f, -4.677650519e-03f, -6.093547679e-03f,  5.826735403e-03f,
+   4.267612007e-03f, -4.131175578e-03f,  1.062928699e-03f, -1.041656011e-03f,
+  -8.902541362e-03f,  8.832107298e-03f,  1.631155238e-02f, -1.638231426e-02f,
+  -1.848762855e-02f,  1.879711263e-02f,  9.444959462e-03f, -9.721673094e-03f,
+   1.676671393e-02f, -1.747116074e-02f, -6.453330815e-02f,  6.807588786e-02f,
+   1.351974458e-01f, -1.443833113e-01f, -2.260308415e-01f,  2.443765998e-01f,
+   3.299913406e-01f, -3.611960113e-01f, -4.364293814e-01f,  4.836251438e-01f,
+   5.326785445e-01f, -5.976148248e-01f, -6.062345505e-01f,  6.885978580e-01f,
+   6.470598578e-01f, -7.441263199e-01f, -6.494981050e-01f,  7.562521100e-01f,
+   6.133585572e-01f, -7.231023312e-01f, -5.439222455e-01f,  6.492765546e-01f,
+   4.508757591e-01f, -5.449657440e-01f, -3.464297950e-01f,  4.239939451e-01f,
+   2.430607378e-01f, -3.012346327e-01f, -1.513814181e-01f,  1.899865419e-01f,
+   7.858421654e-02f, -9.987598658e-02f, -2.773459256e-02f,  3.569763154e-02f,
+  -2.029813360e-03f,  2.645956585e-03f,  1.455565449e-02f, -1.921699755e-02f,
+  -1.530114841e-02f,  2.046087384e-02f,  9.907942265e-03f, -1.341992244e-02f,
+  -3.048526356e-03f,  4.182577599e-03f, -2.240385860e-03f,  3.113769460e-03f,
+   4.684528802e-03f, -6.595721003e-03f, -4.450072069e-03f,  6.347756833e-03f,
+   2.560556866e-03f, -3.700579749e-03f, -2.690063557e-04f,  3.939184244e-04f,
+  -1.434485312e-03f,  2.128510270e-03f,  2.078483114e-03f, -3.125292249e-03f,
+  -1.719738240e-03f,  2.620599698e-03f,  1.607925748e-03f, -2.064244123e-03f,
+  -2.259047702e-03f,  2.937148558e-03f,  1.984735718e-03f, -2.613524674e-03f,
+  -6.113376003e-04f,  8.153562085e-04f, -1.572709647e-03f,  2.124599414e-03f,
+   3.785441164e-03f, -5.179980304e-03f, -4.919941071e-03f,  6.819876377e-03f,
+   3.912382293e-03f, -5.493963603e-03f, -2.383023239e-04f,  3.390194906e-04f,
+  -5.595706403e-03f,  8.065441623e-03f,  1.172820479e-02f, -1.712804288e-02f,
+  -1.493445411e-02f,  2.210017852e-02f,  1.101607736e-02f, -1.651931182e-02f,
+   4.429257475e-03f, -6.731066853e-03f, -3.498789668e-02f,  5.388768390e-02f,
+   8.238059282e-02f, -1.286018491e-01f, -1.456449777e-01f,  2.304631770e-01f,
+   2.207863480e-01f, -3.541574776e-01f, -3.010415435e-01f,  4.895583689e-01f,
+   3.777628839e-01f, -6.228569150e-01f, -4.417791069e-01f,  7.385902405e-01f,
+   4.849664569e-01f, -8.222035170e-01f, -5.017004013e-01f,  8.626261950e-01f,
+   4.898743629e-01f, -8.543114662e-01f, -4.512638748e-01f,  7.982884645e-01f,
+   3.911619782e-01f, -7.019878030e-01f, -3.173738420e-01f,  5.778768659e-01f,
+   2.387997806e-01f, -4.412032068e-01f, -1.639157683e-01f,  3.073385358e-01f,
+   9.946627170e-02f, -1.892851442e-01f, -4.961583018e-02f,  9.584292769e-02f,
+   1.568378508e-02f, -3.075717203e-02f,  3.553546499e-03f, -7.075740956e-03f,
+  -1.113238651e-02f,  2.250988595e-02f,  1.095949765e-02f, -2.250679396e-02f,
+  -6.892287638e-03f,  1.437769923e-02f,  2.033757279e-03f, -4.310181830e-03f,
+   1.646487624e-03f, -3.545644460e-03f, -3.350060433e-03f,  7.331653498e-03f,
+   3.215400735e-03f, -7.152730599e-03f, -1.932277693e-03f,  4.369898699e-03f,
+   3.380123235e-04f, -7.772843237e-04f,  8.968064794e-04f, -2.097369870e-03f,
+  -1.433916972e-03f,  3.411266720e-03f,  1.279603457e-03f, -3.097220324e-03f,
+  -6.829649792e-04f,  1.682260190e-03f, -1.713357233e-05f,  4.295732288e-05f,
+   5.340531934e-04f, -1.363228308e-03f, -7.208233001e-04f,  1.873750240e-03f,
+   1.317257760e-03f, -2.095039003e-03f, -1.921332325e-03f,  3.097813344e-03f,
+   1.802419312e-03f, -2.946294844e-03f, -7.883392391e-04f,  1.306588179e-03f,
+  -9.499070584e-04f,  1.596433576e-03f,  2.857793821e-03f, -4.870630335e-03f,
+  -4.098011646e-03f,  7.083598524e-03f,  3.798331600e-03f, -6.659527775e-03f,
+  -1.404716633e-03f,  2.498354297e-03f, -2.946339082e-03f,  5.316298455e-03f,
+   8.148083463e-03f, -1.491734851e-02f, -1.204476040e-02f,  2.237658389e-02f,
+   1.162597537e-02f, -2.191977948e-02f, -3.503250424e-03f,  6.704133470e-03f,
+  -1.539756265e-02f,  2.991187014e-02f,  4.706221446e-02f, -9.281998128e-02f,
+  -9.170743078e-02f,  1.836582869e-01f,  1.473685503e-01f, -2.997155190e-01f,
+  -2.098854333e-01f,  4.335596263e-01f,  2.733348608e-01f, -5.735741854e-01f,
+  -3.308578134e-01f,  7.053948641e-01f,  3.757364154e-01f, -8.140315413e-01f,
+  -4.025110602e-01f,  8.862906098e-01f,  4.079116583e-01f, -9.130207896e-01f,
+  -3.914108574e-01f,  8.907223344e-01f,  3.552881479e-01f, -8.221795559e-01f,
+  -3.041968048e-01f,  7.159810662e-01f,  2.443317175e-01f, -5.850262642e-01f,
+  -1.823766083e-01f,  4.443284869e-01f,  1.244458258e-01f, -3.085668087e-01f,
+  -7.522478700e-02f,  1.898722649e-01f,  3.745534644e-02f, -9.626041353e-02f,
+  -1.182846818e-02f,  3.096002154e-02f, -2.745500999e-03f,  7.320535835e-03f,
+   8.593888022e-03f, -2.334927581e-02f, -8.615144528e-03f,  2.385762893e-02f,
+   5.642719567e-03f, -1.593152992e-02f, -1.962894108e-03f,  5.651951768e-03f,
+  -9.442375158e-04f,  2.773633227e-03f,  2.433379879e-03f, -7.294291165e-03f,
+  -2.538389759e-03f,  7.767514326e-03f,  1.711577293e-03f, -5.348379258e-03f,
+  -5.449695163e-04f,  1.739633852e-03f, -4.545786651e-04f,  1.482926658e-03f,
+   9.946878999e-04f, -3.317378229e-03f, -1.023975434e-03f,  3.492815420e-03f,
+   6.775753573e-04f, -2.364887856e-03f,  1.130938297e-03f, -1.852383022e-03f,
+  -1.800317783e-03f,  2.989866771e-03f,  1.865075901e-03f, -3.140863962e-03f,
+  -1.117193489e-03f,  1.907970174e-03f, -3.749811440e-04f,  6.495090784e-04f,
+   2.207862679e-03f, -3.879038850e-03f, -3.692727070e-03f,  6.581436843e-03f,
+   4.028960597e-03f, -7.285086904e-03f, -2.578675747e-03f,  4.731024150e-03f,
+  -8.154712268e-04f,  1.518217381e-03f,  5.553376395e-03f, -1.049303822e-02f,
+  -1.013185456e-02f,  1.943147369e-02f,  1.220240444e-02f, -2.375694364e-02f,
+  -8.863395080e-03f,  1.751988567e-02f, -2.838017885e-03f,  5.696289241e-03f,
+   2.527615055e-02f, -5.152231455e-02f, -5.961482599e-02f,  1.234270260e-01f,
+   1.053163335e-01f, -2.215080559e-01f, -1.599187553e-01f,  3.417430520e-01f,
+   2.191615701e-01f, -4.759291112e-01f, -2.774687707e-01f,  6.124113202e-01f,
+   3.287218213e-01f, -7.375392914e-01f, -3.671876192e-01f,  8.376281261e-01f,
+   3.884284198e-01f, -9.010788202e-01f, -3.900179267e-01f,  9.202586412e-01f,
+   3.719244897e-01f, -8.927744031e-01f, -3.364891708e-01f,  8.218849897e-01f,
+   2.880086005e-01f, -7.159674168e-01f, -2.320110351e-01f,  5.871413946e-01f,
+   1.743718088e-01f, -4.493231475e-01f, -1.204389557e-01f,  3.160851300e-01f,
+   7.432705909e-02f, -1.987233162e-01f, -3.849245608e-02f,  1.048713699e-01f,
+   1.363743097e-02f, -3.787150234e-02f,  1.078822534e-03f, -3.054587636e-03f,
+  -7.602893747e-03f,  2.195498720e-02f,  8.439092897e-03f, -2.486200258e-02f,
+  -6.112399977e-03f,  1.837715507e-02f,  2.743536839e-03f, -8.420725353e-03f,
+   2.023845154e-04f, -6.343668210e-04f, -1.979307039e-03f,  6.338111591e-03f,
+   2.464158693e-03f, -8.064270020e-03f, -1.958737383e-03f,  6.553840358e-03f,
+   9.577370365e-04f, -3.277712036e-03f,  5.602632882e-05f, -1.962057722e-04f,
+  -7.483392837e-04f,  2.682949184e-03f,  9.873765521e-04f, -3.625768004e-03f,
+  -8.238330483e-04f,  3.100123256e-03f, -1.851232955e-03f,  2.585870214e-03f,
+   2.171968808e-03f, -3.073556582e-03f, -1.675753621e-03f,  2.402504906e-03f,
+   3.181068751e-04f, -4.620823602e-04f,  1.618911745e-03f, -2.382804640e-03f,
+  -3.529525362e-03f,  5.264151841e-03f,  4.602636676e-03f, -6.956561934e-03f,
+  -4.051057156e-03f,  6.205294281e-03f,  1.413060236e-03f, -2.193775261e-03f,
+   3.141491674e-03f, -4.943532869e-03f, -8.584052324e-03f,  1.369297691e-02f,
+   1.295903139e-02f, -2.095642500e-02f, -1.352835912e-02f,  2.218019776e-02f,
+   7.139797788e-03f, -1.186915394e-02f,  9.222643450e-03f, -1.554683782e-02f,
+  -3.779726848e-02f,  6.461606920e-02f,  7.943715900e-02f, -1.377335042e-01f,
+  -1.331701130e-01f,  2.342081815e-01f,  1.960383356e-01f, -3.497526646e-01f,
+  -2.632822394e-01f,  4.765551984e-01f,  3.288658857e-01f, -6.039913297e-01f,
+  -3.862723112e-01f,  7.199063301e-01f,  4.294371009e-01f, -8.122778535e-01f,
+  -4.536562264e-01f,  8.709806204e-01f,  4.563027620e-01f, -8.893385530e-01f,
+  -4.372211397e-01f,  8.651778102e-01f,  3.987282813e-01f, -8.011822701e-01f,
+  -3.452259004e-01f,  7.044816613e-01f,  2.825010717e-01f, -5.855481625e-01f,
+  -2.168484330e-01f,  4.566058815e-01f,  1.541744918e-01f, -3.298444748e-01f,
+  -9.923890978e-02f,  2.157552689e-01f,  5.515154079e-02f, -1.218691245e-01f,
+  -2.318680100e-02f,  5.208467320e-02f,  2.912134863e-03f, -6.651092321e-03f,
+   7.431081962e-03f, -1.725949533e-02f, -1.039629616e-02f,  2.456034161e-02f,
+   8.767601103e-03f, -2.107194439e-02f, -5.069974344e-03f,  1.239907369e-02f,
+   1.230550581e-03f, -3.062934615e-03f,  1.574617811e-03f, -3.989944234e-03f,
+  -2.896953607e-03f,  7.474619430e-03f,  2.857981483e-03f, -7.510507479e-03f,
+  -1.920765382e-03f,  5.142295733e-03f,  6.551779807e-04f, -1.787433284e-03f,
+   4.503809323e-04f, -1.252442598e-03f, -1.100146445e-03f,  3.119320842e-03f,
+   1.219067024e-03f, -3.525317414e-03f, -9.129512473e-04f,  2.693482675e-03f,
+   3.889235377e-04f, -1.171027776e-03f,  1.322289754e-04f, -4.064549867e-04f,
+  -4.855944135e-04f,  1.524386695e-03f,  5.983492592e-04f, -1.918984111e-03f,
+   1.473968034e-03f, -1.366826240e-03f, -1.187523594e-03f,  1.114833285e-03f,
+   3.808223410e-04f, -3.619331983e-04f,  7.673657965e-04f, -7.383179036e-04f,
+  -1.909143408e-03f,  1.859567477e-03f,  2.609779825e-03f, -2.573403995e-03f,
+  -2.480321331e-03f,  2.475949703e-03f,  1.328842482e-03f, -1.342879608e-03f,
+   7.144465344e-04f, -7.309095818e-04f, -3.145497525e-03f,  3.257730277e-03f,
+   5.144579802e-03f, -5.393986590e-03f, -5.757419858e-03f,  6.111180410e-03f,
+   4.180848598e-03f, -4.492652137e-03f, -1.018276162e-04f,  1.107770513e-04f,
+  -5.986590404e-03f,  6.593487691e-03f,  1.257895492e-02f, -1.402613427e-02f,
+  -1.713759080e-02f,  1.934675686e-02f,  1.630591229e-02f, -1.863701828e-02f,
+  -6.355614401e-03f,  7.354797330e-03f, -1.618420891e-02f,  1.896252297e-02f,
+   5.381591618e-02f, -6.384361535e-02f, -1.074115932e-01f,  1.290242374e-01f,
+   1.757385880e-01f, -2.137533575e-01f, -2.552877665e-01f,  3.144232631e-01f,
+   3.404711783e-01f, -4.246370196e-01f, -4.241892099e-01f,  5.357533097e-01f,
+   4.986966252e-01f, -6.378598809e-01f, -5.566354394e-01f,  7.210412025e-01f,
+   5.920653343e-01f, -7.767422795e-01f, -6.013163328e-01f,  7.990004420e-01f,
+   5.835159421e-01f, -7.853315473e-01f, -5.407005548e-01f,  7.371129990e-01f,
+   4.774945080e-01f, -6.593926549e-01f, -4.004166126e-01f,  5.601558685e-01f,
+   3.169393837e-01f, -4.491772652e-01f, -2.344640046e-01f,  3.366566300e-01f,
+   1.593816727e-01f, -2.318700403e-01f, -9.636702389e-02f,  1.420550942e-01f,
+   4.799814895e-02f, -7.169733196e-02f, -1.473302953e-02f,  2.230230905e-02f,
+  -4.793533590e-03f,  7.353992201e-03f,  1.324128918e-02f, -2.058916911e-02f,
+  -1.392429322e-02f,  2.194601297e-02f,  1.018411014e-02f, -1.627097279e-02f,
+  -4.882082343e-03f,  7.907493971e-03f,  7.887666288e-05f, -1.295275724e-04f,
+   3.076235997e-03f, -5.122139119e-03f, -4.267546814e-03f,  7.205554750e-03f,
+   3.800566308e-03f, -6.507823709e-03f, -2.325874055e-03f,  4.039376508e-03f,
+   5.691449041e-04f, -1.002618228e-03f,  8.779733325e-04f, -1.569004264e-03f,
+  -1.675756532e-03f,  3.038301831e-03f,  1.759160194e-03f, -3.236319171e-03f,
+  -1.283831662e-03f,  2.396792639e-03f,  5.275648437e-04f, -9.996017907e-04f,
+   2.170696243e-04f, -4.174775677e-04f, -7.288943161e-04f,  1.423107227e-03f,
+   9.049839573e-04f, -1.793952659e-03f,  2.618834144e-03f, -1.698193024e-03f,
+  -3.150430275e-03f,  2.056665719e-03f,  2.650340321e-03f, -1.741816406e-03f,
+  -9.945742786e-04f,  6.580170593e-04f, -1.569358865e-03f,  1.045234851e-03f,
+   4.390583374e-03f, -2.943730913e-03f, -6.501663942e-03f,  4.388108850e-03f,
+   6.833039224e-03f, -4.642337095e-03f, -4.532332066e-03f,  3.099612426e-03f,
+  -6.663345848e-04f,  4.587056465e-04f,  8.102439344e-03f, -5.614446476e-03f,
+  -1.596779935e-02f,  1.113727782e-02f,  2.128360048e-02f, -1.494223438e-02f,
+  -2.012584731e-02f,  1.422180701e-02f,  8.103881031e-03f, -5.763916764e-03f,
+   1.895652711e-02f, -1.357067376e-02f, -6.422415376e-02f,  4.627571627e-02f,
+   1.291016936e-01f, -9.362525493e-02f, -2.126399577e-01f,  1.552053541e-01f,
+   3.112572730e-01f, -2.286528349e-01f, -4.188505113e-01f,  3.096748888e-01f,
+   5.273195505e-01f, -3.923787773e-01f, -6.274540424e-01f,  4.698866010e-01f,
+   7.100613117e-01f, -5.351573825e-01f, -7.671661377e-01f,  5.818951130e-01f,
+   7.930912375e-01f, -6.054012775e-01f, -7.852421403e-01f,  6.032315493e-01f,
+   7.444662452e-01f, -5.755475163e-01f, -6.749265790e-01f,  5.251024961e-01f,
+   5.835132003e-01f, -4.568622708e-01f, -4.788907766e-01f,  3.773235977e-01f,
+   3.703415990e-01f, -2.936424613e-01f, -2.665903866e-01f,  2.127138525e-01f,
+   1.747923046e-01f, -1.403475106e-01f, -9.982923418e-02f,  8.066172898e-02f,
+   4.399753362e-02f, -3.577354178e-02f, -7.099209353e-03f,  5.808498710e-03f,
+  -1.312064286e-02f,  1.080254279e-02f,  2.030015178e-02f, -1.681837067e-02f,
+  -1.868938468e-02f,  1.558081526e-02f,  1.242058631e-02f, -1.041944977e-02f,
+  -4.934180062e-03f,  4.165069200e-03f, -1.368395169e-03f,  1.162306173e-03f,
+   5.225015804e-03f, -4.465762526e-03f, -6.394545082e-03f,  5.499384832e-03f,
+   5.384115968e-03f, -4.659215454e-03f, -3.104624106e-03f,  2.703329083e-03f,
+   5.362434313e-04f, -4.698304110e-04f,  1.531387679e-03f, -1.350054634e-03f,
+  -2.647247631e-03f,  2.348257694e-03f,  2.728929510e-03f, -2.435714938e-03f,
+  -1.994945342e-03f,  1.791621442e-03f,  8.373164455e-04f, -7.566311397e-04f,
+   3.216138575e-04f, -2.924199507e-04f, -1.149328426e-03f,  1.051459461e-03f,
+   1.474675490e-03f, -1.357436413e-03f, -1.978674904e-03f,  3.544638457e-04f,
+   1.644229749e-03f, -2.997598785e-04f, -6.723149563e-04f,  1.247022738e-04f,
+  -7.610657485e-04f,  1.435805752e-04f,  2.286403673e-03f, -4.386151268e-04f,
+  -3.411315614e-03f,  6.652713637e-04f,  3.646156518e-03f, -7.226885064e-04f,
+  -2.660616068e-03f,  5.358374328e-04f,  4.331417731e-04f, -8.861664537e-05f,
+   2.651846036e-03f, -5.510238698e-04f, -5.800541490e-03f,  1.223863568e-03f,
+   7.926985621e-03f, -1.697943662e-03f, -7.893425412e-03f,  1.716099563e-03f,
+   4.846531432e-03f, -1.069260412e-03f,  1.406701398e-03f, -3.148807155e-04f,
+  -1.006083563e-02f,  2.284486080e-03f,  1.909664087e-02f, -4.397873301e-03f,
+  -2.526359633e-02f,  5.899772979e-03f,  2.430759929e-02f, -5.755218677e-03f,
+  -1.144935377e-02f,  2.747942694e-03f, -1.793030091e-02f,  4.361646716e-03f,
+   6.748878956e-02f, -1.663649827e-02f, -1.391296834e-01f,  3.474964574e-02f,
+   2.323604673e-01f, -5.879330635e-02f, -3.439303935e-01f,  8.814702928e-02f,
+   4.678425193e-01f, -1.214356720e-01f, -5.957779884e-01f,  1.565958112e-01f,
+   7.179032564e-01f, -1.910521090e-01f, -8.239635825e-01f,  2.219865620e-01f,
+   9.045125842e-01f, -2.466664165e-01f, -9.520984292e-01f,  2.627842426e-01f,
+   9.622254968e-01f, -2.687590420e-01f, -9.339432716e-01f,  2.639510036e-01f,
+   8.699694872e-01f, -2.487554848e-01f, -7.763289213e-01f,  2.245590389e-01f,
+   6.615648866e-01f, -1.935641170e-01f, -5.356473327e-01f,  1.585081220e-01f,
+   4.087454677e-01f, -1.223205477e-01f, -2.900490761e-01f,  8.777008951e-02f,
+   1.868047863e-01f, -5.715410039e-02f, -1.036935449e-01f,  3.207392991e-02f,
+   4.261115938e-02f, -1.332362741e-02f, -2.847503638e-03f,  8.999548154e-04f,
+  -1.840378903e-02f,  5.878688302e-03f,  2.531922609e-02f, -8.173362352e-03f,
+  -2.264001779e-02f,  7.385253441e-03f,  1.492179185e-02f, -4.918242805e-03f,
+  -5.948367063e-03f,  1.980842324e-03f, -1.623154152e-03f,  5.460578250e-04f,
+   6.367296446e-03f, -2.163839294e-03f, -7.972270250e-03f,  2.736579860e-03f,
+   6.961177569e-03f, -2.413408132e-03f, -4.333022516e-03f,  1.517146244e-03f,
+   1.205095323e-03f, -4.261019058e-04f,  1.476362580e-03f, -5.271187983e-04f,
+  -3.115611151e-03f,  1.123183174e-03f,  3.524802160e-03f, -1.282930141e-03f,
+  -2.874143887e-03f,  1.056105713e-03f, -1.722301007e-03f,  1.841810998e-03f,
+   2.411720110e-03f, -2.610999858e-03f, -2.483275020e-03f,  2.721785568e-03f,
+   1.754916855e-03f, -1.947335550e-03f, -2.435900096e-04f,  2.736565075e-04f,
+  -1.786579029e-03f,  2.032067860e-03f,  3.832623363e-03f, -4.413573537e-03f,
+  -5.229518749e-03f,  6.097383797e-03f,  5.293478258e-03f, -6.249147002e-03f,
+  -3.514023265e-03f,  4.200423136e-03f, -2.374270844e-04f,  2.873686899e-04f,
+   5.524531472e-03f, -6.770771928e-03f, -1.123305503e-02f,  1.394080464e-02f,
+   1.556587778e-02f, -1.956254616e-02f, -1.616866514e-02f,  2.057800256e-02f,
+   1.038699690e-02f, -1.338790730e-02f,  4.369107075e-03f, -5.703301635e-03f,
+  -3.020053543e-02f,  3.992800415e-02f,  6.829856336e-02f, -9.145826846e-02f,
+  -1.185994819e-01f,  1.608654857e-01f,  1.795800179e-01f, -2.467334270e-01f,
+  -2.482415736e-01f,  3.455067575e-01f,  3.203038573e-01f, -4.516266286e-01f,
+  -3.905960619e-01f,  5.579622984e-01f,  4.536003768e-01f, -6.565008759e-01f,
+  -5.040769577e-01f,  7.392140031e-01f,  5.376831889e-01f, -7.989852428e-01f,
+  -5.514976978e-01f,  8.304694891e-01f,  5.443735719e-01f, -8.307580352e-01f,
+  -5.170691013e-01f,  7.997508049e-01f,  4.721383154e-01f, -7.401781082e-01f,
+  -4.136003554e-01f,  6.572677493e-01f,  3.464383483e-01f, -5.581058860e-01f,
+  -2.760032415e-01f,  4.507857561e-01f,  2.074081600e-01f, -3.434667587e-01f,
+  -1.449975073e-01f,  2.434788048e-01f,  9.195727855e-02f, -1.565917283e-01f,
+  -5.010902509e-02f,  8.654111624e-02f,  1.989839599e-02f, -3.485713899e-02f,
+  -5.596768460e-04f,  9.945416823e-04f, -9.587195702e-03f,  1.728365943e-02f,
+   1.276578195e-02f, -2.335060015e-02f, -1.136171073e-02f,  2.108874545e-02f,
+   7.587601896e-03f, -1.429287251e-02f, -3.236408345e-03f,  6.187848747e-03f,
+  -4.546823911e-04f,  8.824724937e-04f,  2.828724217e-03f, -5.573879927e-03f,
+  -3.739145119e-03f,  7.481222041e-03f,  3.415558953e-03f, -6.939954590e-03f,
+  -2.300894121e-03f,  4.748425446e-03f,  8.939232212e-04f, -1.874032663e-03f,
+   3.761188709e-04f, -8.011137834e-04f, -1.227172441e-03f,  2.656056779e-03f,
+   1.550595975e-03f, -3.410878358e-03f, -1.392934239e-03f,  3.114653518e-03f,
+   9.074238478e-04f, -2.062905580e-03f, -2.925883455e-04f,  6.763906567e-04f,
+  -2.656842989e-04f,  6.246865960e-04f,  6.363450666e-04f, -1.522061415e-03f,
+  -7.633771165e-04f,  1.857858035e-03f,  2.415113850e-03f, -7.981271483e-04f,
+  -3.364015371e-03f,  1.123171882e-03f,  3.506999929e-03f, -1.182882348e-03f,
+  -2.588575240e-03f,  8.819595096e-04f,  5.961452844e-04f, -2.051574556e-04f,
+   2.170095220e-03f, -7.542707608e-04f, -5.091743544e-03f,  1.787289861e-03f,
+   7.309143431e-03f, -2.590849763e-03f, -7.883870974e-03f,  2.821828006e-03f,
+   6.031818688e-03f, -2.179832663e-03f, -1.393762766e-03f,  5.085303565e-04f,
+  -5.704147276e-03f,  2.101075836e-03f,  1.405480504e-02f, -5.225997418e-03f,
+  -2.149186470e-02f,  8.066456765e-03f,  2.496822737e-02f, -9.458720684e-03f,
+  -2.080845647e-02f,  7.955959067e-03f,  5.123659037e-03f, -1.977031585e-03f,
+   2.565284818e-02f, -9.989017621e-03f, -7.417742163e-02f,  2.914649807e-02f,
+   1.416414678e-01f, -5.615736172e-02f, -2.273410112e-01f,  9.094322473e-02f,
+   3.284512460e-01f, -1.325607151e-01f, -4.400620461e-01f,  1.791780442e-01f,
+   5.554952621e-01f, -2.281677127e-01f, -6.668828726e-01f,  2.763139606e-01f,
+   7.659441233e-01f, -3.201155066e-01f, -8.448672295e-01f,  3.561489880e-01f,
+   8.971800208e-01f, -3.814469576e-01f, -9.184925556e-01f,  3.938398659e-01f,
+   9.070088863e-01f, -3.922144473e-01f, -8.637363911e-01f,  3.766518831e-01f,
+   7.923635244e-01f, -3.484252393e-01f, -6.988239884e-01f,  3.098551631e-01f,
+   5.906084776e-01f, -2.640440762e-01f, -4.759202898e-01f,  2.145246565e-01f,
+   3.627900779e-01f, -1.648713797e-01f, -2.582652271e-01f,  1.183269843e-01f,
+   1.677756906e-01f, -7.749188691e-02f, -9.474565834e-02f,  4.411411658e-02f,
+   4.048267752e-02f, -1.900030486e-02f, -4.333775491e-03f,  2.050279872e-03f,
+  -1.593878679e-02f,  7.600464392e-03f,  2.363662235e-02f, -1.136033982e-02f,
+  -2.254727669e-02f,  1.092205290e-02f,  1.639612764e-02f, -8.004593663e-03f,
+  -8.400570601e-03f,  4.133123439e-03f,  9.746797732e-04f, -4.832671839e-04f,
+   4.396579228e-03f, -2.196748741e-03f, -7.123300806e-03f,  3.586505773e-03f,
+   7.350028027e-03f, -3.728970420e-03f, -5.716979969e-03f,  2.922546817e-03f,
+   3.096493892e-03f, -1.594943460e-03f, -3.533523413e-04f,  1.833787392e-04f,
+  -1.834727474e-03f,  9.593220893e-04f,  3.077024361e-03f, -1.620920957e-03f,
+  -3.288454842e-03f,  1.745208167e-03f,  2.640444087e-03f, -1.411703299e-03f,
+  -1.675224165e-03f,  1.732049277e-03f,  2.387012821e-03f, -2.498480026e-03f,
+  -2.571874298e-03f,  2.725258004e-03f,  2.051702235e-03f, -2.200963208e-03f,
+  -7.975452463e-04f,  8.661616594e-04f, -1.025979873e-03f,  1.128062373e-03f,
+   3.053572727e-03f, -3.399064299e-03f, -4.759670701e-03f,  5.364038981e-03f,
+   5.548505578e-03f, -6.330862176e-03f, -4.885995295e-03f,  5.644433666e-03f,
+   2.455731621e-03f, -2.872356446e-03f,  1.686642296e-03f, -1.997473184e-03f,
+  -6.990646478e-03f,  8.382761851e-03f,  1.234896295e-02f, -1.499423012e-02f,
+  -1.611916348e-02f,  1.981860958e-02f,  1.624088921e-02f, -2.022047341e-02f,
+  -1.044546813e-02f,  1.316967513e-02f, -3.460948588e-03f,  4.418996628e-03f,
+   2.727419138e-02f, -3.526780382e-02f, -6.207266822e-02f,  8.129100502e-02f,
+   1.079498455e-01f, -1.431852132e-01f, -1.638434827e-01f,  2.201196700e-01f,
+   2.274960577e-01f, -3.095833063e-01f, -2.955639064e-01f,  4.074276388e-01f,
+   3.638722301e-01f, -5.081195831e-01f, -4.277920723e-01f,  6.051892042e-01f,
+   4.826962650e-01f, -6.918283105e-01f, -5.244388580e-01f,  7.615717649e-01f,
+   5.497974753e-01f, -8.089786768e-01f, -5.568211079e-01f,  8.302257657e-01f,
+   5.450381637e-01f, -8.235359788e-01f, -5.154983401e-01f,  7.893840075e-01f,
+   4.706445932e-01f, -7.304505110e-01f, -4.140325487e-01f,  6.513306499e-01f,
+   3.499374092e-01f, -5.580338836e-01f, -2.828994989e-01f,  4.573416412e-01f,
+   2.172673047e-01f, -3.561047316e-01f, -1.567938626e-01f,  2.605704069e-01f,
+   1.043323204e-01f, -1.758193970e-01f, -6.166022271e-02f,  1.053769365e-01f,
+   2.944301441e-02f, -5.103375018e-02f, -7.327649277e-03f,  1.288303919e-02f,
+  -5.859259982e-03f,  1.045009121e-02f,  1.184603758e-02f, -2.143487521e-02f,
+  -1.262561139e-02f,  2.318031713e-02f,  1.018116623e-02f, -1.896853559e-02f,
+  -6.261414848e-03f,  1.183941402e-02f,  2.227728721e-03f, -4.275583196e-03f,
+   1.017961069e-03f, -1.983331516e-03f, -3.028536914e-03f,  5.990814883e-03f,
+   3.745032009e-03f, -7.522413507e-03f, -3.389514750e-03f,  6.914325524e-03f,
+   2.341628307e-03f, -4.851823207e-03f, -1.021214877e-03f,  2.149538603e-03f,
+  -2.055603982e-04f,  4.396200238e-04f,  1.086246688e-03f, -2.360736951e-03f,
+  -1.505577238e-03f,  3.325653728e-03f,  1.476435107e-03f, -3.315275768e-03f,
+  -1.107283053e-03f,  2.527984791e-03f,  2.113207243e-03f, -1.779731974e-04f,
+  -3.241311060e-03f,  2.829988662e-04f,  3.745633177e-03f, -3.386134340e-04f,
+  -3.339439631e-03f,  3.122245544e-04f,  1.900673145e-03f, -1.835893781e-04f,
+   4.562550166e-04f, -4.548373545e-05f, -3.346706275e-03f,  3.440035507e-04f,
+   6.136590149e-03f, -6.498039002e-04f, -8.026510477e-03f,  8.748369874e-04f,
+   8.197398856e-03f, -9.189193370e-04f, -6.003570277e-03f,  6.916502025e-04f,
+   1.187523711e-03f, -1.405033836e-04f,  5.918012466e-03f, -7.186143193e-04f,
+  -1.423933171e-02f,  1.773404656e-03f,  2.189879306e-02f, -2.795587759e-03f,
+  -2.626754530e-02f,  3.435233375e-03f,  2.414734662e-02f, -3.233337542e-03f,
+  -1.207635552e-02f,  1.654757652e-03f, -1.326638367e-02f,  1.859303215e-03f,
+   5.460141599e-02f, -7.823348977e-03f, -1.135917082e-01f,  1.663134620e-02f,
+   1.904515177e-01f, -2.848174609e-02f, -2.836824954e-01f,  4.331450164e-02f,
+   3.899857402e-01f, -6.077051163e-02f, -5.043793917e-01f,  8.018194884e-02f,
+   6.205244660e-01f, -1.005985215e-01f, -7.312343121e-01f,  1.208501458e-01f,
+   8.291174769e-01f, -1.396416873e-01f, -9.072826505e-01f,  1.556703746e-01f,
+   9.600236416e-01f, -1.677532345e-01f, -9.834020734e-01f,  1.749491990e-01f,
+   9.756560326e-01f, -1.766608655e-01f, -9.373839498e-01f,  1.727027893e-01f,
+   8.714803457e-01f, -1.633267701e-01f, -7.828328609e-01f,  1.492005736e-01f,
+   6.778166890e-01f, -1.313418001e-01f, -5.636510253e-01f,  1.110149622e-01f,
+   4.476946592e-01f, -8.960422128e-02f, -3.367651105e-01f,  6.847736984e-02f,
+   2.365577519e-01f, -4.885756597e-02f, -1.512268037e-01f,  3.171775490e-02f,
+   8.316536248e-02f, -1.770934276e-02f, -3.299444541e-02f,  7.131766528e-03f,
+  -2.557501721e-04f,  5.610236985e-05f,  1.881240308e-02f, -4.187297076e-03f,
+  -2.573052049e-02f,  5.810051691e-03f,  2.443035878e-02f, -5.595298018e-03f,
+  -1.826278120e-02f,  4.241744522e-03f,  1.015323400e-02f, -2.391061047e-03f,
+  -2.358579542e-03f,  5.630824016e-04f, -3.648420563e-03f,  8.828563150e-04f,
+   7.171622012e-03f, -1.758719678e-03f, -8.182218298e-03f,  2.033183817e-03f,
+   7.140289992e-03f, -1.797553618e-03f, -4.784981254e-03f,  1.220232109e-03f,
+   1.929933205e-03f, -4.984688712e-04f,  7.060190546e-04f, -1.846650703e-04f,
+  -2.613193588e-03f,  6.920747692e-04f,  3.542744322e-03f, -9.498965810e-04f,
+  -3.499404062e-03f,  9.497934370e-04f,  2.688149689e-03f, -7.384682540e-04f,
+  -1.433252590e-03f,  3.984653740e-04f,  8.979788981e-05f, -2.526218304e-05f,
+   1.034363173e-03f, -2.944173466e-04f, -1.733207493e-03f,  4.990870948e-04f,
+   1.927186386e-03f, -5.613528774e-04f,  1.778518781e-03f, -9.341834229e-04f,
+  -1.589081949e-03f,  8.409103611e-04f,  9.598240140e-04f, -5.116951070e-04f,
+   3.851136353e-05f, -2.068290632e-05f, -1.231153845e-03f,  6.660778890e-04f,
+   2.359773498e-03f, -1.286057290e-03f, -3.126199823e-03f,  1.716213999e-03f,
+   3.254305571e-03f, -1.799556077e-03f, -2.560189692e-03f,  1.425999799e-03f,
+   1.017178758e-03f, -5.706541124e-04f,  1.199404942e-03f, -6.777322851e-04f,
+  -3.701671492e-03f,  2.106664469e-03f,  5.922826938e-03f, -3.394848667e-03f,
+  -7.198650390e-03f,  4.155518021e-03f,  6.892184727e-03f, -4.006848205e-03f,
+  -4.548363388e-03f,  2.662945539e-03f,  5.757488179e-05f, -3.394616942e-05f,
+   6.198128220e-03f, -3.680090886e-03f, -1.324411202e-02f,  7.918647490e-03f,
+   1.948276907e-02f, -1.173002552e-02f, -2.275168709e-02f,  1.379342843e-02f,
+   2.047747746e-02f, -1.250074338e-02f, -9.918878786e-03f,  6.096958648e-03f,
+  -1.152130216e-02f,  7.130734157e-03f,  4.594836384e-02f, -2.863357961e-02f,
+  -9.463404119e-02f,  5.937681720e-02f,  1.577266902e-01f, -9.963913262e-02f,
+  -2.340567559e-01f,  1.488649696e-01f,  3.210720122e-01f, -2.055947036e-01f,
+  -4.149230719e-01f,  2.674895823e-01f,  5.107012987e-01f, -3.314575851e-01f,
+  -6.028123498e-01f,  3.938735723e-01f,  6.854498982e-01f, -4.508751631e-01f,
+  -7.531199455e-01f,  4.987041652e-01f,  8.011581302e-01f, -5.340571404e-01f,
+  -8.261799216e-01f,  5.544053912e-01f,  8.264127970e-01f, -5.582463741e-01f,
+  -8.018700480e-01f,  5.452577472e-01f,  7.543464303e-01f, -5.163339376e-01f,
+  -6.872362494e-01f,  4.735012054e-01f,  6.051962972e-01f, -4.197201729e-01f,
+  -5.136935711e-01f,  3.585995436e-01f,  4.184904397e-01f, -2.940537632e-01f,
+  -3.251264095e-01f,  2.299443930e-01f,  2.384533733e-01f, -1.697450876e-01f,
+  -1.622718126e-01f,  1.162663624e-01f,  9.910228103e-02f, -7.146707177e-02f,
+  -5.010668188e-02f,  3.636835143e-02f,  1.515618712e-02f, -1.107179187e-02f,
+   6.975430530e-03f, -5.128537305e-03f, -1.832744665e-02f,  1.356168650e-02f,
+   2.141932771e-02f, -1.595149934e-02f, -1.891363040e-02f,  1.417586021e-02f,
+   1.331491582e-02f, -1.004354004e-02f, -6.735846400e-03f,  5.113397725e-03f,
+   7.494428428e-04f, -5.725588999e-04f,  3.667051205e-03f, -2.819410525e-03f,
+  -6.103976164e-03f,  4.722906277e-03f,  6.624262314e-03f, -5.158041138e-03f,
+  -5.625725724e-03f,  4.408312496e-03f,  3.687075106e-03f, -2.907489426e-03f,
+  -1.422278699e-03f,  1.128649921e-03f, -6.371506606e-04f,  5.088046310e-04f,
+   2.119713463e-03f, -1.703400281e-03f, -2.847150899e-03f,  2.302379813e-03f,
+   2.826731186e-03f, -2.300246386e-03f, -2.211873420e-03f,  1.811214956e-03f,
+   1.243922976e-03f, -1.024990226e-03f, -1.888119150e-04f,  1.565557031e-04f,
+  -7.191405166e-04f,  6.000168505e-04f,  1.317347749e-03f, -1.106005395e-03f,
+  -1.534381998e-03f,  1.296267146e-03f, -1.552024507e-03f,  1.429835684e-03f,
+   2.337524202e-03f, -2.180161420e-03f, -2.722150879e-03f,  2.570307581e-03f,
+   2.529869322e-03f, -2.418285934e-03f, -1.677575754e-03f,  1.623399323e-03f,
+   2.136641124e-04f, -2.093178773e-04f,  1.662409864e-03f, -1.648705336e-03f,
+  -3.607287072e-03f,  3.621723270e-03f,  5.171855446e-03f, -5.256671924e-03f,
+  -5.869952962e-03f,  6.039903965e-03f,  5.271838512e-03f, -5.491492338e-03f,
+  -3.111522878e-03f,  3.281230805e-03f, -6.070518866e-04f,  6.480799639e-04f,
+   5.522210617e-03f, -5.968415178e-03f, -1.086216606e-02f,  1.188531984e-02f,
+   1.544226985e-02f, -1.710644923e-02f, -1.772075146e-02f,  1.987430267e-02f,
+   1.591452397e-02f, -1.807057671e-02f, -8.168308996e-03f,  9.390475228e-03f,
+  -7.237866521e-03f,  8.424656466e-03f,  3.166471422e-02f, -3.731758520e-02f,
+  -6.589962542e-02f,  7.863721997e-02f,  1.099802181e-01f, -1.328859031e-01f,
+  -1.630808115e-01f,  1.995257437e-01f,  2.234812528e-01f, -2.768741846e-01f,
+  -2.886286974e-01f,  3.621100783e-01f,  3.552923799e-01f, -4.514005184e-01f,
+  -4.197995961e-01f,  5.401440263e-01f,  4.783319533e-01f, -6.233119965e-01f,
+  -5.272511244e-01f,  6.958574653e-01f,  5.634208918e-01f, -7.531500459e-01f,
+  -5.844901204e-01f,  7.913919091e-01f,  5.891061425e-01f, -8.079693317e-01f,
+  -5.770347714e-01f,  8.017007113e-01f,  5.491750836e-01f, -7.729531527e-01f,
+  -5.074672103e-01f,  7.236133218e-01f,  4.547050297e-01f, -6.569158435e-01f,
+  -3.942748904e-01f,  5.771474838e-01f,  3.298503160e-01f, -4.892599881e-01f,
+  -2.650753260e-01f,  3.984334171e-01f,  2.032699138e-01f, -3.096370697e-01f,
+  -1.471867561e-01f,  2.272337526e-01f,  9.884056449e-02f, -1.546662897e-01f,
+  -5.942261964e-02f,  9.425447881e-02f,  2.930214815e-02f, -4.711661115e-02f,
+  -8.106353693e-03f,  1.321479678e-02f, -5.137199536e-03f,  8.491002955e-03f,
+   1.181784179e-02f, -1.980646886e-02f, -1.354314201e-02f,  2.301784977e-02f,
+   1.194802206e-02f, -2.059488371e-02f, -8.531748317e-03f,  1.491634641e-02f,
+   4.537187517e-03f, -8.046682924e-03f, -8.798267227e-04f,  1.582994009e-03f,
+  -1.872995635e-03f,  3.419154556e-03f,  3.478451632e-03f, -6.443433929e-03f,
+  -3.960717004e-03f,  7.445707452e-03f,  3.532849252e-03f, -6.740796845e-03f,
+  -2.511902479e-03f,  4.865168128e-03f,  1.239766250e-03f, -2.437815769e-03f,
+  -1.936111585e-05f,  3.865595500e-05f, -9.279767983e-04f,  1.881521661e-03f,
+   1.482100924e-03f, -3.052102868e-03f, -1.622496289e-03f,  3.394063096e-03f,
+   1.410206431e-03f, -2.997101750e-03f, -9.595474112e-04f,  2.072230680e-03f,
+  -1.108427648e-03f,  1.674952568e-03f,  9.997417219e-04f, -1.531047048e-03f,
+  -6.516921567e-04f,  1.011533197e-03f,  1.008460531e-04f, -1.586595026e-04f,
+   5.669304519e-04f, -9.041498415e-04f, -1.226013992e-03f,  1.982186921e-03f,
+   1.730138320e-03f, -2.835992491e-03f, -1.938921167e-03f,  3.222532570e-03f,
+   1.747930539e-03f, -2.945869463e-03f, -1.117164386e-03f,  1.909410348e-03f,
+   9.228633280e-05f, -1.599759125e-04f,  1.186656998e-03f, -2.086512977e-03f,
+  -2.492980100e-03f,  4.446709063e-03f,  3.539331956e-03f, -6.404895801e-03f,
+  -4.020895809e-03f,  7.383002434e-03f,  3.671851475e-03f, -6.841715425e-03f,
+  -2.328402130e-03f,  4.403111525e-03f, -1.036147660e-05f,  1.988836266e-05f,
+   3.133424558e-03f, -6.105596665e-03f, -6.589907221e-03f,  1.303699333e-02f,
+   9.689677507e-03f, -1.946509629e-02f, -1.153687388e-02f,  2.353674546e-02f,
+   1.109666005e-02f, -2.299459279e-02f, -7.291048300e-03f,  1.534846704e-02f,
+  -8.847134886e-04f,  1.892291359e-03f,  1.423723903e-02f, -3.094515949e-02f,
+  -3.325589001e-02f,  7.346676290e-02f,  5.801427364e-02f, -1.302833855e-01f,
+  -8.810584247e-02f,  2.011731416e-01f,  1.226238608e-01f, -2.847301364e-01f,
+  -1.601913869e-01f,  3.783344924e-01f,  1.990413964e-01f, -4.782409966e-01f,
+  -2.371411175e-01f,  5.797869563e-01f,  2.723495662e-01f, -6.777063012e-01f,
+  -3.025928736e-01f,  7.665231824e-01f,  3.260394037e-01f, -8.409901857e-01f,
+  -3.412572145e-01f,  8.965267539e-01f,  3.473364711e-01f, -9.296144247e-01f,
+  -3.439650238e-01f,  9.381076097e-01f,  3.314491808e-01f, -9.214265347e-01f,
+  -3.106784225e-01f,  8.806117773e-01f,  2.830384970e-01f, -8.182346821e-01f,
+  -2.502830625e-01f,  7.381720543e-01f,  2.143783271e-01f, -6.452694535e-01f,
+  -1.773366928e-01f,  5.449281931e-01f,  1.410570741e-01f, -4.426583946e-01f,
+  -1.071867645e-01f,  3.436430395e-01f,  7.701730728e-02f, -2.523560822e-01f,
+  -5.142186955e-02f,  1.722687036e-01f,  3.083687648e-02f, -1.056681648e-01f,
+  -1.528552640e-02f,  5.359941348e-02f,  4.436410032e-03f, -1.592637599e-02f,
+   2.312556608e-03f, -8.503403515e-03f, -5.736596882e-03f,  2.161672339e-02f,
+   6.684795488e-03f, -2.582794242e-02f, -5.989740137e-03f,  2.374208905e-02f,
+   4.394431598e-03f, -1.788046584e-02f, -2.501700772e-03f,  1.045554038e-02f,
+   7.480706554e-04f, -3.213464515e-03f,  5.991802900e-04f, -2.647336340e-03f,
+  -1.425558003e-03f,  6.482995115e-03f,  1.739055850e-03f, -8.146686479e-03f,
+  -1.632363535e-03f,  7.883504964e-03f,  1.243776875e-03f, -6.198130548e-03f,
+  -7.220625994e-04f,  3.716331441e-03f,  1.990471646e-04f, -1.059131115e-03f,
+   2.280604094e-04f, -1.255915384e-03f, -5.043334095e-04f,  2.877667313e-03f,
+   6.159751792e-04f, -3.646116937e-03f, -5.825835979e-04f,  3.582144156e-03f,
+   4.455880553e-04f, -2.850059187e-03f, -7.632160559e-04f,  1.858393429e-03f,
+   6.617467734e-04f, -1.639882568e-03f, -4.081924562e-04f,  1.029708656e-03f,
+   3.220658982e-05f, -8.272258856e-05f,  4.077024059e-04f, -1.066493103e-03f,
+  -8.313002763e-04f,  2.215223620e-03f,  1.148907701e-03f, -3.119633067e-03f,
+  -1.277313451e-03f,  3.535029013e-03f,  1.156956889e-03f, -3.264471423e-03f,
+  -7.674724911e-04f,  2.208446385e-03f,  1.385724172e-04f, -4.067828704e-04f,
+   6.463896716e-04f, -1.936337678e-03f, -1.455981517e-03f,  4.452339839e-03f,
+   2.125948202e-03f, -6.638684776e-03f, -2.483249176e-03f,  7.921446115e-03f,
+   2.376461169e-03f, -7.747015450e-03f, -1.708818483e-03f,  5.694970023e-03f,
+   4.692850052e-04f, -1.599573530e-03f,  1.243251725e-03f, -4.335979000e-03f,
+  -3.207177622e-03f,  1.145010162e-02f,  5.080172792e-03f, -1.857505739e-02f,
+  -6.417813245e-03f,  2.404482290e-02f,  6.708443630e-03f, -2.576721832e-02f,
+  -5.421797745e-03f,  2.136193030e-02f,  2.066799905e-03f, -8.357952349e-03f,
+   3.747612936e-03f, -1.556420512e-02f, -1.225570682e-02f,  5.230732635e-02f,
+   2.348930016e-02f, -1.030963361e-01f, -3.724945709e-02f,  1.682505012e-01f,
+   5.310007930e-02f, -2.470175326e-01f, -7.038549334e-02f,  3.374933004e-01f,
+   8.827152103e-02f, -4.366439581e-01f, -1.058067456e-01f,  5.404364467e-01f,
+   1.219981015e-01f, -6.440727711e-01f, -1.358933598e-01f,  7.423113585e-01f,
+   1.466620117e-01f, -8.298491836e-01f, -1.536660790e-01f,  9.017299414e-01f,
+   1.565135270e-01f, -9.537405372e-01f, -1.550889164e-01f,  9.827569723e-01f,
+   1.495582908e-01f, -9.870055914e-01f, -1.403485239e-01f,  9.662134051e-01f,
+   1.281035393e-01f, -9.216323495e-01f, -1.136229113e-01f,  8.559349179e-01f,
+   9.778966010e-02f, -7.729912996e-01f, -8.149492741e-02f,  6.775506139e-01f,
+   6.556745619e-02f, -5.748578310e-01f, -5.071437731e-02f,  4.702434242e-01f,
+   3.747865558e-02f, -3.687253892e-01f, -2.621579915e-02f,  2.746597230e-01f,
+   1.709057391e-02f, -1.914695501e-01f, -1.009187568e-02f,  1.214739680e-01f,
+   5.062218755e-03f, -6.582576782e-02f, -1.736956416e-03f,  2.455620095e-02f,
+  -2.121940342e-04f,  3.286268795e-03f,  1.134622376e-03f, -1.942488924e-02f,
+  -1.363812597e-03f,  2.609866858e-02f,  1.189120230e-03f, -2.579143271e-02f,
+  -8.381018415e-04f,  2.097460255e-02f,  4.696093965e-04f, -1.388816256e-02f,
+  -1.764817862e-04f,  6.377652287e-03f, -4.371496743e-06f,  2.030209143e-04f,
+   7.730373909e-05f, -5.021609832e-03f, -7.162158727e-05f,  7.736735512e-03f,
+   2.627645335e-05f, -8.418804966e-03f,  2.242741357e-05f,  7.439152803e-03f,
+  -4.891616481e-05f, -5.345473997e-03f,  4.190043910e-05f,  2.740774537e-03f,
+  -3.860686320e-06f, -1.801885082e-04f, -5.249350579e-05f, -1.904322999e-03f,
+   1.094275358e-04f,  3.246419597e-03f, -1.496446639e-04f, -3.755067941e-03f,
+   1.608069724e-04f,  3.495907644e-03f, -1.382966875e-04f, -2.651934745e-03f,
+  -5.492264172e-04f,  1.931629842e-03f,  4.737965064e-04f, -1.706067589e-03f,
+  -2.971454815e-04f,  1.096014166e-03f,  4.050224015e-05f, -1.531052403e-04f,
+   2.572282974e-04f, -9.970715037e-04f, -5.443922128e-04f,  2.165013924e-03f,
+   7.644068100e-04f, -3.120844951e-03f, -8.654552512e-04f,  3.629633458e-03f,
+   8.106048917e-04f, -3.494497156e-03f, -5.866598804e-04f,  2.601490589e-03f,
+   2.100717393e-04f, -9.589251713e-04f,  2.714799193e-04f, -1.276662457e-03f,
+  -7.826872170e-04f,  3.794975113e-03f,  1.229513320e-03f, -6.152053829e-03f,
+  -1.512687420e-03f,  7.818279788e-03f,  1.544289989e-03f, -8.252820000e-03f,
+  -1.265275059e-03f,  6.999010220e-03f,  6.613845471e-04f, -3.791263560e-03f,
+   2.251374681e-04f, -1.339038718e-03f, -1.290294924e-03f,  7.973115891e-03f,
+   2.371130511e-03f, -1.524448209e-02f, -3.257157514e-03f,  2.182177640e-02f,
+   3.709889716e-03f, -2.594422363e-02f, -3.488763468e-03f,  2.551406249e-02f,
+   2.380721970e-03f, -1.824400760e-02f, -2.300130145e-04f,  1.851094188e-03f,
+  -3.035564441e-03f,  2.571817487e-02f,  7.385557983e-03f, -6.605164707e-02f,
+  -1.267784182e-02f,  1.200480014e-01f,  1.866154373e-02f, -1.877305061e-01f,
+  -2.499239892e-02f,  2.681209147e-01f,  3.125952557e-02f, -3.591918051e-01f,
+  -3.702113032e-02f,  4.579090476e-01f,  4.184553400e-02f, -5.603674054e-01f,
+  -4.535303265e-02f,  6.620128751e-01f,  4.725397378e-02f, -7.579362988e-01f,
+  -4.737863690e-02f,  8.432151079e-01f,  4.569547623e-02f, -9.132733345e-01f,
+  -4.231551662e-02f,  9.642286897e-01f,  3.748232499e-02f, -9.931936264e-01f,
+  -3.154858947e-02f,  9.985034466e-01f,  2.494199574e-02f, -9.798489213e-01f,
+  -1.812415570e-02f,  9.383013248e-01f,  1.154723670e-02f, -8.762270808e-01f,
+  -5.613015499e-03f,  7.971005440e-01f,  6.387651083e-04f, -7.052320838e-01f,
+   3.166573355e-03f,  6.054379940e-01f, -5.713773426e-03f, -5.026816726e-01f,
+   7.031621877e-03f,  4.017196000e-01f, -7.253054529e-03f, -3.067823648e-01f,
+   6.591425277e-03f,  2.213174999e-01f, -5.310226697e-03f, -1.478132904e-01f,
+   3.690188518e-03f,  8.771438897e-02f, -1.997709740e-03f, -4.142996669e-02f,
+   4.581812245e-04f,  8.426935412e-03f,  7.631096523e-04f,  1.260770764e-02f,
+  -1.570927212e-03f, -2.355637029e-02f,  1.940576243e-03f,  2.663657814e-02f,
+  -1.909828978e-03f, -2.416736074e-02f,  1.564188162e-03f,  1.835848764e-02f,
+  -1.018065843e-03f, -1.114025433e-02f,  3.947447985e-04f,  4.045472015e-03f,
+   1.921239891e-04f,  1.851349953e-03f, -6.532066618e-04f, -5.939261988e-03f,
+   9.328151355e-04f,  8.027978241e-03f, -1.012223656e-03f, -8.268530481e-03f,
+   9.072159883e-04f,  7.051735185e-03f, -6.608874537e-04f, -4.899312276e-03f,
+   3.332959022e-04f,  2.361343009e-03f,  1.016142869e-05f,  6.893290265e-05f,
+  -3.097719164e-04f, -2.015623031e-03f,  5.203430774e-04f,  3.252707422e-03f,
+  -6.167468382e-04f, -3.709275508e-03f,  5.956762470e-04f,  3.451523138e-03f,
+  -4.737435374e-04f, -2.647957299e-03f,
+};
+
+static const cqtBinType CqtKernel_Bins[96] = {
+  {15, 3, 0, 1000.000f},
+  {11, 12, 3, 1029.302f},
+  {14, 6, 15, 1059.463f},
+  {12, 12, 21, 1090.508f},
+  {16, 5, 33, 1122.462f},
+  {13, 12, 38, 1155.353f},
+  {17, 5, 50, 1189.207f},
+  {14, 12, 55, 1224.054f},
+  {16, 9, 67, 1259.921f},
+  {16, 10, 76, 1296.840f},
+  {16, 11, 86, 1334.840f},
+  {20, 5, 97, 1373.954f},
+  {18, 11, 102, 1414.214f},
+  {19, 10, 113, 1455.653f},
+  {22, 5, 123, 1498.307f},
+  {20, 10, 128, 1542.211f},
+  {20, 11, 138, 1587.401f},
+  {22, 9, 149, 1633.915f},
+  {24, 7, 158, 1681.793f},
+  {23, 10, 165, 1731.073f},
+  {23, 12, 175, 1781.797f},
+  {24, 11, 187, 1834.008f},
+  {26, 9, 198, 1887.749f},
+  {28, 7, 207, 1943.064f},
+  {31, 3, 214, 2000.000f},
+  {30, 7, 217, 2058.604f},
+  {31, 7, 224, 2118.926f},
+  {31, 7, 231, 2181.015f},
+  {31, 10, 238, 2244.924f},
+  {32, 11, 248, 2310.705f},
+  {32, 12, 259, 2378.414f},
+  {34, 11, 271, 2448.107f},
+  {35, 10, 282, 2519.842f},
+  {35, 14, 292, 2593.679f},
+  {37, 12, 306, 2669.680f},
+  {38, 14, 318, 2747.907f},
+  {38, 14, 332, 2828.427f},
+  {39, 16, 346, 2911.306f},
+  {42, 13, 362, 2996.614f},
+  {43, 14, 375, 3084.422f},
+  {44, 14, 389, 3174.802f},
+  {44, 16, 403, 3267.831f},
+  {47, 15, 419, 3363.586f},
+  {48, 16, 434, 3462.146f},
+  {50, 16, 450, 3563.595f},
+  {51, 18, 466, 3668.016f},
+  {52, 19, 484, 3775.497f},
+  {54, 17, 503, 3886.128f},
+  {56, 17, 520, 4000.000f},
+  {57, 19, 537, 4117.209f},
+  {57, 21, 556, 4237.852f},
+  {61, 21, 577, 4362.031f},
+  {62, 20, 598, 4489.848f},
+  {64, 21, 618, 4621.411f},
+  {64, 23, 639, 4756.828f},
+  {68, 24, 662, 4896.214f},
+  {70, 22, 686, 5039.684f},
+  {72, 23, 708, 5187.358f},
+  {74, 26, 731, 5339.359f},
+  {76, 27, 757, 5495.815f},
+  {76, 30, 784, 5656.854f},
+  {81, 28, 814, 5822.613f},
+  {83, 27, 842, 5993.228f},
+  {83, 30, 869, 6168.843f},
+  {88, 31, 899, 6349.604f},
+  {88, 32, 930, 6535.662f},
+  {93, 33, 962, 6727.171f},
+  {93, 34, 995, 6924.292f},
+  {99, 32, 1029, 7127.190f},
+  {101, 36, 1061, 7336.032f},
+  {104, 34, 1097, 7550.995f},
+  {107, 35, 1131, 7772.256f},
+  {111, 35, 1166, 8000.000f},
+  {114, 40, 1201, 8234.418f},
+  {114, 41, 1241, 8475.705f},
+  {117, 46, 1282, 8724.062f},
+  {124, 40, 1328, 8979.696f},
+  {128, 41, 1368, 9242.822f},
+  {128, 46, 1409, 9513.657f},
+  {135, 44, 1455, 9792.428f},
+  {139, 49, 1499, 10079.368f},
+  {143, 47, 1548, 10374.716f},
+  {147, 48, 1595, 10678.719f},
+  {152, 53, 1643, 10991.629f},
+  {152, 59, 1696, 11313.708f},
+  {161, 56, 1755, 11645.225f},
+  {161, 58, 1811, 11986.457f},
+  {170, 60, 1869, 12337.687f},
+  {175, 57, 1929, 12699.208f},
+  {180, 59, 1986, 13071.324f},
+  {185, 66, 2045, 13454.343f},
+  {186, 72, 2111, 13848.585f},
+  {196, 65, 2183, 14254.379f},
+  {197, 71, 2248, 14672.065f},
+  {203, 73, 2319, 15101.989f},
+  {209, 75, 2392, 15544.511f},
+};
+
+const cqtKernelType CqtKernel = {
+  CQT_MAGIC,
+  64000.0f, // fs
+  1024, // length
+  24, // bins per octave
+  96, // bins
+  CqtKernel_Bins,
+  CqtKernel_Coeffs
+};
@@ -0,0 +1,222 @@
+//*****************************************************************************
+// filter.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Filter chain of CMSIS-DSP biquad and FIR stages with arena allocated state.
+
+#include <stdint.h>
+#include "filter.h"
+#include "arm_math.h"
+
+// take words from the chain's arena, 0 if it is full
+static uint32_t *alloc(filterChainType *f, uint32_t words){
+  uint32_t *p;
+  if(words > FILTER_ARENAWORDS - f->used){
+    return 0;
+  }
+  p = &f->arena[f->used];
+  f->used += words;
+  return p;
+}
+
+// append one stage, coefficients must outlive the chain
+static int addStage(filterChainType *f, uint32_t type, uint32_t count, const void *coeffs){
+  filterStageType *s;
+  uint32_t *state;
+  if((f->numStages == FILTER_MAXSTAGES) || (count == 0)){
+    return 0;
+  }
+  s = &f->stages[f->numStages];
+  s->type = type;
+  switch(type){
+    case FILTER_BIQUAD:
+      if((count > 255) || ((state = alloc(f, 2*count)) == 0)){
+        return 0;
+      }
+      arm_biquad_cascade_df2T_init_f32(&s->inst.biquad, (uint8_t)count,
+        (const float32_t *)coeffs, (float32_t *)state);
+      break;
+    case FILTER_FIR:
+      if((count > 0xFFFF) || ((state = alloc(f, count + FILTER_BLOCK - 1)) == 0)){
+        return 0;
+      }
+      arm_fir_init_f32(&s->inst.fir, (uint16_t)count, (const float32_t *)coeffs,
+        (float32_t *)state, FILTER_BLOCK);
+      break;
+    case FILTER_FIRQ15:
+      if((count > 0xFFFF) || ((state = alloc(f, (count + FILTER_BLOCK)/2)) == 0)){
+        return 0;
+      }
+      if(arm_fir_init_q15(&s->inst.firq15, (uint16_t)count, (const q15_t *)coeffs,
+           (q15_t *)state, FILTER_BLOCK) != ARM_MATH_SUCCESS){
+        return 0;  // odd or too few taps
+      }
+      break;
+    default:
+      return 0;
+  }
+  f->numStages++;
+  return 1;
+}
+
+static void empty(filterChainType *f){
+  f->numStages = 0;
+  f->numChecks = 0;
+  f->used = 0;
+}
+
+// copy the response checks, 0 if there are too many
+static int setChecks(filterChainType *f, uint32_t numChecks,
+                     const float32_t *hz, const float32_t *dB){
+  uint32_t i;
+  if(numChecks > FILTER_MAXCHECKS){
+    return 0;
+  }
+  for(i = 0; i < numChecks; i++){
+    f->checkHz[i] = hz[i];
+    f->checkdB[i] = dB[i];
+  }
+  f->numChecks = numChecks;
+  return 1;
+}
+
+int Filter_Configure(filterChainType *f, const filterSetType *set){
+  uint32_t i;
+  empty(f);
+  if((set->magic != FILTER_MAGIC) || (set->numStages > FILTER_MAXSTAGES)){
+    return 0;
+  }
+  for(i = 0; i < set->numStages; i++){
+    if(addStage(f, set->stages[i].type, set->stages[i].count, set->stages[i].coeffs) == 0){
+      empty(f);
+      return 0;
+    }
+  }
+  f->fs = set->fs;
+  if(setChecks(f, set->numChecks, set->checkHz, set->checkdB) == 0){
+    empty(f);
+    return 0;
+  }
+  return 1;
+}
+
+void Filter_Reset(filterChainType *f){
+  uint32_t i, k, words;
+  filterStageType *s;
+  uint32_t *state;
+  for(i = 0; i < f->numStages; i++){
+    s = &f->stages[i];
+    if(s->type == FILTER_BIQUAD){
+      state = (uint32_t *)s->inst.biquad.pState;
+      words = 2*s->inst.biquad.numStages;
+    }else if(s->type == FILTER_FIR){
+      state = (uint32_t *)s->inst.fir.pState;
+      words = s->inst.fir.numTaps + FILTER_BLOCK - 1;
+    }else{
+      state = (uint32_t *)s->inst.firq15.pState;
+      words = (s->inst.firq15.numTaps + FILTER_BLOCK)/2;
+    }
+    for(k = 0; k < words; k++){
+      state[k] = 0;  // all bits zero is 0.0f and 0 in Q15
+    }
+  }
+}
+
+// run one Q15 stage on a float block, saturating at +/-FILTER_Q15SCALE
+static void runQ15(filterStageType *s, float32_t *x, uint32_t n){
+  q15_t in[FILTER_BLOCK], out[FILTER_BLOCK];
+  int32_t v;
+  uint32_t i;
+  for(i = 0; i < n; i++){
+    v = (int32_t)(x[i]*(32768.0f/FILTER_Q15SCALE));
+    if(v > 32767){
+      v = 32767;
+    }else if(v < -32768){
+      v = -32768;
+    }
+    in[i] = (q15_t)v;
+  }
+  arm_fir_q15(&s->inst.firq15, in, out, n);
+  for(i = 0; i < n; i++){
+    x[i] = (float32_t)out[i]*(FILTER_Q15SCALE/32768.0f);
+  }
+}
+
+void Filter_Run(filterChainType *f, float32_t *x, uint32_t length){
+  uint32_t i, n;
+  filterStageType *s;
+  while(length){
+    n = (length > FILTER_BLOCK) ? FILTER_BLOCK : length;
+    for(i = 0; i < f->numStages; i++){
+      s = &f->stages[i];
+      if(s->type == FILTER_BIQUAD){
+        arm_biquad_cascade_df2T_f32(&s->inst.biquad, x, x, n);
+      }else if(s->type == FILTER_FIR){
+        arm_fir_f32(&s->inst.fir, x, x, n);  // input is copied to the state first, in place is safe
+      }else{
+        runQ15(s, x, n);
+      }
+    }
+    x += n;
+    length -= n;
+  }
+}
+
+float32_t Filter_Verify(filterChainType *f, float32_t *scratch){
+  const float32_t amplitude = FILTER_Q15SCALE/2;  // exact in Q15
+  float32_t worst = 0;
+  float32_t w, stepC, stepS, c, s, t, g, dB;
+  float32_t c0 = 1.0f, s0 = 0, cc, ss, cs, yc, ys, det, a, b;
+  uint32_t i, k, n;
+  for(i = 0; i < f->numChecks; i++){
+    // a tone at the check frequency, FILTER_SETTLELEN samples until the
+    // chain settles, then one block measured
+    w = 2.0f*PI*f->checkHz[i]/f->fs;
+    stepC = arm_cos_f32(w);
+    stepS = arm_sin_f32(w);
+    c = 1.0f;
+    s = 0;
+    Filter_Reset(f);
+    for(n = 0; n <= FILTER_SETTLELEN; n += FILTER_VERIFYLEN){
+      g = 1.0f/sqrtf(c*c + s*s);  // the rotation drifts in float
+      c = c*g;
+      s = s*g;
+      c0 = c;
+      s0 = s;
+      for(k = 0; k < FILTER_VERIFYLEN; k++){
+        scratch[k] = amplitude*c;
+        t = c*stepC - s*stepS;
+        s = s*stepC + c*stepS;
+        c = t;
+      }
+      Filter_Run(f, scratch, FILTER_VERIFYLEN);
+    }
+    // least squares fit of a cos + b sin to the measured block, exact for
+    // any frequency, where a DFT of the block would leak from the negative
+    // frequency; the tone is generated again from the start of the block
+    c = c0;
+    s = s0;
+    cc = ss = cs = yc = ys = 0;
+    for(k = 0; k < FILTER_VERIFYLEN; k++){
+      cc += c*c;
+      ss += s*s;
+      cs += c*s;
+      yc += scratch[k]*c;
+      ys += scratch[k]*s;
+      t = c*stepC - s*stepS;
+      s = s*stepC + c*stepS;
+      c = t;
+    }
+    det = cc*ss - cs*cs;
+    a = (yc*ss - ys*cs)/det/amplitude;
+    b = (ys*cc - yc*cs)/det/amplitude;
+    dB = 10*log10f(a*a + b*b + 1e-20f) - f->checkdB[i];
+    if(dB < 0){
+      dB = -dB;
+    }
+    if(dB > worst){
+      worst = dB;
+    }
+  }
+  Filter_Reset(f);
+  return worst;
+}
@@ -0,0 +1,118 @@
+//*****************************************************************************
+// filter.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Filter chain, a cascade of CMSIS-DSP biquad (df2T, float) and FIR (float
+// or Q15) stages applied to blocks of samples, configured from a table.
+
+// A chain is configured from a const filterSetType in flash, whose
+// coefficients are used in place. State buffers come from the arena inside
+// the chain, nothing is allocated from a heap, and reconfiguring a chain
+// starts its arena over.
+// Coefficient sets are designed and exported by tools/filterdesign.c.
+// Each set carries the steady state response the host computes from the
+// coefficients at a few frequencies; Filter_Verify measures a settled tone
+// at each of them on the board.
+
+// Coefficient layout of a stage: biquad coefficients are b0 b1 b2 a1 a2 per
+// section (count sections, CMSIS sign convention), FIR coefficients are in
+// time reversed order (count taps).
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __FILTER_H
+#define __FILTER_H  1
+
+#define FILTER_MAGIC      0x31544C46  // "FLT1", set format version 1
+#define FILTER_MAXSTAGES  4           // stages in one chain
+#define FILTER_MAXCHECKS  8           // response checks in one set
+#define FILTER_ARENAWORDS 256         // words of state per chain
+#define FILTER_BLOCK      32          // samples processed per CMSIS call
+#define FILTER_Q15SCALE   4096.0f     // sample value that maps to 1.0 in Q15 stages
+#define FILTER_VERIFYLEN  1024        // samples of each check tone measured
+#define FILTER_SETTLELEN  15360       // samples of each check tone run first, a multiple of FILTER_VERIFYLEN
+#define FILTER_VERIFYDB   0.2f        // largest allowed check error in dB
+
+enum FilterType{
+  FILTER_BIQUAD = 1,  // count biquad sections, float
+  FILTER_FIR    = 2,  // count taps, float
+  FILTER_FIRQ15 = 3   // count taps, Q15, count must be even
+};
+
+// one stage of a flash resident set
+struct filterSpec{
+  uint32_t type;          // enum FilterType
+  uint32_t count;         // sections or taps
+  const void *coeffs;     // float32_t or q15_t, layout as above
+};
+typedef struct filterSpec filterSpecType;
+
+// flash resident coefficient set, generated by tools/filterdesign.c
+struct filterSet{
+  uint32_t magic;         // FILTER_MAGIC
+  float32_t fs;           // sample rate the set was designed for in Hz
+  uint32_t numStages;
+  filterSpecType stages[FILTER_MAXSTAGES];
+  uint32_t numChecks;
+  float32_t checkHz[FILTER_MAXCHECKS];  // frequencies checked
+  float32_t checkdB[FILTER_MAXCHECKS];  // designed response there in dB
+};
+typedef struct filterSet filterSetType;
+
+struct filterStage{
+  uint32_t type;
+  union{
+    arm_biquad_cascade_df2T_instance_f32 biquad;
+    arm_fir_instance_f32 fir;
+    arm_fir_instance_q15 firq15;
+  } inst;
+};
+typedef struct filterStage filterStageType;
+
+struct filterChain{
+  uint32_t numStages;     // 0 passes samples through unchanged
+  filterStageType stages[FILTER_MAXSTAGES];
+  float32_t fs;
+  uint32_t numChecks;
+  float32_t checkHz[FILTER_MAXCHECKS];
+  float32_t checkdB[FILTER_MAXCHECKS];
+  uint32_t used;          // arena words in use
+  uint32_t arena[FILTER_ARENAWORDS];
+};
+typedef struct filterChain filterChainType;
+
+// default set linked into flash, generated by tools/filterdesign.c
+extern const filterSetType FilterSet;
+
+// ******** Filter_Configure ************
+// Build a chain from a flash resident set, coefficients stay in flash
+// Inputs:  pointer to chain
+//          pointer to set
+// Outputs: 1 if successful, 0 if the set is not valid or the arena is too
+//          small, the chain is then left empty
+int Filter_Configure(filterChainType *f, const filterSetType *set);
+
+// ******** Filter_Reset ************
+// Clear the state of every stage
+// Inputs:  pointer to chain
+// Outputs: none
+void Filter_Reset(filterChainType *f);
+
+// ******** Filter_Run ************
+// Filter samples in place through every stage in turn
+// Inputs:  pointer to chain
+//          samples, same units as SoundBufferIn
+//          number of samples
+// Outputs: none
+void Filter_Run(filterChainType *f, float32_t *x, uint32_t length);
+
+// ******** Filter_Verify ************
+// Run a tone at each of the set's check frequencies through the chain until
+// it settles, measure its level and compare with the designed response;
+// the state is cleared before and after, so the chain must not be running
+// (about 16 x FILTER_VERIFYLEN samples of filtering per check)
+// Inputs:  pointer to chain
+//          scratch buffer of FILTER_VERIFYLEN samples
+// Outputs: largest error in dB, 0 if the set has no checks
+float32_t Filter_Verify(filterChainType *f, float32_t *scratch);
+
+#endif
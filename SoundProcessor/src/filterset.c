@@ -0,0 +1,27 @@
+//*****************************************************************************
+// filterset.c
+// Generated by tools/filterdesign.c, do not edit
+// butterhp:2:20
+
+#include <stdint.h>
+#include "filter.h"
+
+static const float32_t FilterSet_Stage0[5] = {
+  9.986125827e-01f, -1.997225165e+00f, 9.986125827e-01f, 1.997223258e+00f, -9.972270727e-01f,
+};
+
+const filterSetType FilterSet = {
+  FILTER_MAGIC,
+  64000.0f, // fs
+  1, // stages
+  {
+    {FILTER_BIQUAD, 1, FilterSet_Stage0},
+  },
+  8, // checks
+  { // Hz
+    10.0f, 27.9f, 78.1f, 282.3f, 789.0f, 2851.4f, 7969.4f, 28800.0f,
+  },
+  { // dB
+    -12.2483f, -1.0334f, -0.0235f, -0.0005f, -0.0001f, -0.0000f, -0.0000f, -0.0000f,
+  }
+};
@@ -0,0 +1,116 @@
+//*****************************************************************************
+// mfcc.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Mel filterbank and mel frequency cepstral coefficients (MFCC) with deltas.
+// Filterbank is one pass over the bins with two multiply-adds per bin,
+// the DCT-II uses a rotating phasor per coefficient instead of a cosine table.
+
+#include <stdint.h>
+#include "mfcc.h"
+#include "arm_math.h"
+
+#define MFCC_FLOOR 1e-10f  // keeps log() finite for empty filters
+
+static float32_t hzToMel(float32_t f){
+  return 2595.0f*log10f(1.0f + f/700.0f);
+}
+
+static float32_t melToHz(float32_t mel){
+  return 700.0f*(powf(10.0f, mel/2595.0f) - 1.0f);
+}
+
+int MFCC_Init(mfccType *m, float32_t fs, uint32_t fftLength, uint32_t numBins,
+              float32_t fLow, float32_t fHigh){
+  uint32_t j, k;
+  float32_t melLow, melStep, pos[MFCC_NUMFILTERS+2];
+  if((numBins > MFCC_MAXBINS) || (fLow < 0) || (fHigh <= fLow) ||
+     (fHigh*(float32_t)fftLength/fs > (float32_t)numBins)){
+    return 0;
+  }
+  m->numBins = numBins;
+  melLow = hzToMel(fLow);
+  melStep = (hzToMel(fHigh) - melLow)/(MFCC_NUMFILTERS + 1);
+  for(j = 0; j < MFCC_NUMFILTERS+2; j++){ // fractional bin of each edge
+    pos[j] = melToHz(melLow + melStep*(float32_t)j)*(float32_t)fftLength/fs;
+    m->edge[j] = (uint16_t)ceilf(pos[j]);
+    if(m->edge[j] > numBins){
+      m->edge[j] = numBins;
+    }
+  }
+  for(k = 0; k < MFCC_MAXBINS; k++){
+    m->weight[k] = 0;
+  }
+  for(j = 0; j < MFCC_NUMFILTERS+1; j++){
+    for(k = m->edge[j]; k < m->edge[j+1]; k++){
+      m->weight[k] = (int16_t)(32767.0f*((float32_t)k - pos[j])/(pos[j+1] - pos[j]));
+    }
+  }
+  m->histPos = 0;
+  m->frames = 0;
+  return 1;
+}
+
+int MFCC_Compute(mfccType *m, const float32_t *power){
+  uint32_t j, k, n, i;
+  float32_t w, p, sum, c, s, stepC, stepS, t, scale;
+  float32_t *newest, *oldest;
+  for(j = 0; j < MFCC_NUMFILTERS; j++){
+    m->energy[j] = 0;
+  }
+  // bins between edge j and j+1: rising half of filter j, falling half of filter j-1
+  for(j = 0; j < MFCC_NUMFILTERS+1; j++){
+    for(k = m->edge[j]; k < m->edge[j+1]; k++){
+      w = (float32_t)m->weight[k]*(1.0f/32768.0f);
+      p = power[k];
+      if(j < MFCC_NUMFILTERS){
+        m->energy[j] += w*p;
+      }
+      if(j > 0){
+        m->energy[j-1] += (1.0f - w)*p;
+      }
+    }
+  }
+  for(j = 0; j < MFCC_NUMFILTERS; j++){
+    m->energy[j] = logf(m->energy[j] + MFCC_FLOOR);
+  }
+  // orthonormal DCT-II, c(n) = sum energy(j)*cos(pi*n*(j+0.5)/M)
+  m->histPos = (m->histPos + 1)%(2*MFCC_DELTAWIN+1);
+  newest = m->history[m->histPos];
+  for(n = 0; n < MFCC_NUMCOEFFS; n++){
+    t = PI*(float32_t)n/(float32_t)MFCC_NUMFILTERS;
+    c = arm_cos_f32(0.5f*t);
+    s = arm_sin_f32(0.5f*t);
+    stepC = arm_cos_f32(t);
+    stepS = arm_sin_f32(t);
+    sum = 0;
+    for(j = 0; j < MFCC_NUMFILTERS; j++){
+      sum += m->energy[j]*c;
+      w = c*stepC - s*stepS;
+      s = s*stepC + c*stepS;
+      c = w;
+    }
+    scale = (n == 0) ? sqrtf(1.0f/MFCC_NUMFILTERS) : sqrtf(2.0f/MFCC_NUMFILTERS);
+    m->coeffs[n] = scale*sum;
+    newest[n] = m->coeffs[n];
+  }
+  if(m->frames < 2*MFCC_DELTAWIN+1){
+    m->frames++;
+  }
+  // delta(t) = sum i*(c(t+i) - c(t-i)) / (2*sum i^2), centred MFCC_DELTAWIN frames back
+  for(n = 0; n < MFCC_NUMCOEFFS; n++){
+    m->delta[n] = 0;
+  }
+  sum = 0;
+  for(i = 1; i <= MFCC_DELTAWIN; i++){
+    newest = m->history[(m->histPos + 2*MFCC_DELTAWIN+1 - MFCC_DELTAWIN + i)%(2*MFCC_DELTAWIN+1)];
+    oldest = m->history[(m->histPos + 2*MFCC_DELTAWIN+1 - MFCC_DELTAWIN - i)%(2*MFCC_DELTAWIN+1)];
+    for(n = 0; n < MFCC_NUMCOEFFS; n++){
+      m->delta[n] += (float32_t)i*(newest[n] - oldest[n]);
+    }
+    sum += (float32_t)(i*i);
+  }
+  for(n = 0; n < MFCC_NUMCOEFFS; n++){
+    m->delta[n] = m->delta[n]/(2.0f*sum);
+  }
+  return (m->frames == 2*MFCC_DELTAWIN+1);
+}
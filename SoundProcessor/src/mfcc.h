@@ -0,0 +1,53 @@
+//*****************************************************************************
+// mfcc.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Mel filterbank and mel frequency cepstral coefficients (MFCC) with deltas,
+// computed from the power spectrum left in SoundBufferOut by call_FFT().
+
+// The triangular filters are stored sparsely. Filter j rises from edge j to
+// edge j+1 and falls to edge j+2, so each bin between two edges belongs to
+// exactly two filters with weights w and 1-w. Only the first bin of each edge
+// and one weight per bin are kept, instead of a filters x bins matrix.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __MFCC_H
+#define __MFCC_H  1
+
+#define MFCC_NUMFILTERS 24   // number of mel filters
+#define MFCC_NUMCOEFFS  13   // number of cepstral coefficients, including c0
+#define MFCC_MAXBINS    512  // maximum number of power spectrum bins
+#define MFCC_DELTAWIN   2    // frames each side used for the delta regression
+
+struct mfcc{
+  uint32_t numBins;                          // power spectrum bins used
+  uint16_t edge[MFCC_NUMFILTERS+2];          // first bin at or above each mel edge
+  int16_t weight[MFCC_MAXBINS];              // Q15 rising weight of bin k
+  float32_t energy[MFCC_NUMFILTERS];         // log filterbank energies
+  float32_t history[2*MFCC_DELTAWIN+1][MFCC_NUMCOEFFS]; // recent coefficient frames
+  uint32_t histPos;                          // newest frame in history
+  uint32_t frames;                           // frames computed, saturates
+  float32_t coeffs[MFCC_NUMCOEFFS];          // MFCCs of the newest frame
+  float32_t delta[MFCC_NUMCOEFFS];           // deltas of the frame MFCC_DELTAWIN frames ago
+};
+typedef struct mfcc mfccType;
+
+// ******** MFCC_Init ************
+// Build the sparse mel filterbank for fLow to fHigh
+// Inputs:  pointer to MFCC
+//          sample rate in Hz
+//          FFT length, bin k is k*fs/fftLength Hz
+//          number of power spectrum bins (at most MFCC_MAXBINS)
+//          lowest and highest filter edge in Hz
+// Outputs: 1 if successful, 0 if the parameters are not valid
+int MFCC_Init(mfccType *m, float32_t fs, uint32_t fftLength, uint32_t numBins,
+              float32_t fLow, float32_t fHigh);
+
+// ******** MFCC_Compute ************
+// Filterbank, log and DCT-II of one frame, then update the deltas
+// Inputs:  pointer to MFCC
+//          power spectrum, element k is the power of bin k
+// Outputs: 1 if delta is valid, 0 until 2*MFCC_DELTAWIN+1 frames have been seen
+int MFCC_Compute(mfccType *m, const float32_t *power);
+
+#endif
@@ -0,0 +1,66 @@
+//*****************************************************************************
+// noisefloor.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Minimum statistics noise floor and signal to noise ratio per bin.
+
+#include <stdint.h>
+#include "noisefloor.h"
+#include "arm_math.h"
+
+#define Q8(x) ((int32_t)((x)*256.0f))
+
+int Noise_Init(noisefloorType *nf, uint32_t numBins){
+  if(numBins > NOISE_MAXBINS){
+    return 0;
+  }
+  nf->numBins = numBins;
+  nf->frames = 0;
+  nf->snr = 0;
+  return 1;
+}
+
+float32_t Noise_Update(noisefloorType *nf, const float32_t *dB){
+  uint32_t i;
+  int32_t level, s, m;
+  float32_t p, n, sumP = 0, sumN = 0;
+  for(i = 0; i < nf->numBins; i++){
+    level = (dB[i] > NOISE_MINDB) ? Q8(dB[i]) : Q8(NOISE_MINDB);
+    if(level > Q8(NOISE_MAXDB)){
+      level = Q8(NOISE_MAXDB);
+    }
+    if(nf->frames == 0){
+      s = m = level;  // first frame starts both at the current level
+    }else{
+      s = (int32_t)(NOISE_ALPHA*(float32_t)nf->smooth[i] + (1.0f - NOISE_ALPHA)*(float32_t)level);
+      m = nf->minimum[i];
+      if(s < m){
+        m = s;
+      }else{
+        m = m + Q8(NOISE_RISEDB);
+        if(m > s){
+          m = s;
+        }
+      }
+    }
+    nf->smooth[i] = (int16_t)s;
+    nf->minimum[i] = (int16_t)m;
+    // linear powers for the overall ratio
+    p = powf(10.0f, (float32_t)level/(256.0f*10.0f));
+    n = powf(10.0f, ((float32_t)m/256.0f + NOISE_BIASDB)/10.0f);
+    sumP += p;
+    sumN += n;
+  }
+  if(nf->frames < 0xFFFF){
+    nf->frames++;
+  }
+  p = sumP - sumN;
+  if(p < 1e-6f*sumN){
+    p = 1e-6f*sumN;  // no signal above the floor, -60 dB
+  }
+  nf->snr = 10*log10f(p/sumN);
+  return nf->snr;
+}
+
+float32_t Noise_Floor(noisefloorType *nf, uint32_t i){
+  return (float32_t)nf->minimum[i]/256.0f + NOISE_BIASDB;
+}
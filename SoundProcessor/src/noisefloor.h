@@ -0,0 +1,58 @@
+//*****************************************************************************
+// noisefloor.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Minimum statistics noise floor, tracked per frequency bin over successive
+// spectra, giving per-bin and overall signal to noise ratio.
+
+// Per bin, the level in dB is first smoothed over frames, then the floor
+// follows the smoothed level down at once and rises by at most
+// NOISE_RISEDB per frame. The minimum of a smoothed spectrum sits below
+// the mean noise level (about 6.4 dB for noise-only bins with these
+// constants, since the average of a periodogram in dB is already 2.5 dB
+// below its mean power), so NOISE_BIASDB is added back.
+// Levels are kept in dB as Q8 (1/256 dB) int16, two per bin, so 512 bins
+// take 2 KB.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __NOISEFLOOR_H
+#define __NOISEFLOOR_H  1
+
+#define NOISE_MAXBINS 512     // maximum number of bins tracked
+#define NOISE_ALPHA   0.7f    // weight of the previous smoothed level
+#define NOISE_RISEDB  0.1f    // dB per frame the floor may rise
+#define NOISE_BIASDB  6.4f    // minimum to mean noise level correction in dB
+#define NOISE_MINDB  -100.0f  // floor for empty bins
+#define NOISE_MAXDB   127.0f  // largest level that fits Q8 in an int16
+
+struct noisefloor{
+  uint32_t numBins;
+  uint32_t frames;                 // frames seen, saturates
+  int16_t smooth[NOISE_MAXBINS];   // smoothed level, Q8 dB
+  int16_t minimum[NOISE_MAXBINS];  // tracked minimum, Q8 dB
+  float32_t snr;                   // overall SNR of the latest frame in dB
+};
+typedef struct noisefloor noisefloorType;
+
+// ******** Noise_Init ************
+// Initialize noise floor tracker
+// Inputs:  pointer to tracker
+//          number of bins (at most NOISE_MAXBINS)
+// Outputs: 1 if successful, 0 if too many bins
+int Noise_Init(noisefloorType *nf, uint32_t numBins);
+
+// ******** Noise_Update ************
+// Update the floor with one spectrum and compute the overall SNR
+// Inputs:  pointer to tracker
+//          spectrum in dB, same layout as magnitudeArr
+// Outputs: overall SNR in dB, signal power above the floor over floor power
+float32_t Noise_Update(noisefloorType *nf, const float32_t *dB);
+
+// ******** Noise_Floor ************
+// Estimated noise level of one bin
+// Inputs:  pointer to tracker
+//          bin index, same layout as magnitudeArr
+// Outputs: noise level in dB
+float32_t Noise_Floor(noisefloorType *nf, uint32_t i);
+
+#endif
@@ -0,0 +1,142 @@
+//*****************************************************************************
+// notch.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Adaptive mains hum notch with frequency tracking.
+// About 10 multiply-adds per harmonic per sample.
+
+#include <stdint.h>
+#include "notch.h"
+#include "arm_math.h"
+
+// point the oscillator at f0
+static void tune(notchType *n, float32_t f0){
+  n->f0 = f0;
+  n->stepC = arm_cos_f32(2.0f*PI*f0/n->fs);
+  n->stepS = arm_sin_f32(2.0f*PI*f0/n->fs);
+}
+
+int Notch_Init(notchType *n, float32_t fs, uint32_t harmonics){
+  uint32_t h;
+  if((harmonics == 0) || (harmonics > NOTCH_MAXHARMONICS) ||
+     (60.0f*(float32_t)harmonics >= fs/2)){
+    return 0;
+  }
+  n->fs = fs;
+  n->harmonics = harmonics;
+  n->mu = 2.0f*PI*NOTCH_BW/fs;
+  n->nominal = 0;
+  n->cosF = 1.0f;
+  n->sinF = 0;
+  for(h = 0; h < NOTCH_MAXHARMONICS; h++){
+    n->wc[h] = 0;
+    n->ws[h] = 0;
+  }
+  n->dc = 0;
+  n->lastPhase = 0;
+  n->blockLength = (uint32_t)(fs/10); // 100 ms, several cycles of f0
+  n->count = 0;
+  n->blocks = 0;
+  for(h = 0; h < 3; h++){
+    n->g50[h] = 0;
+    n->g60[h] = 0;
+  }
+  n->coef50 = 2.0f*arm_cos_f32(2.0f*PI*50.0f/fs);
+  n->coef60 = 2.0f*arm_cos_f32(2.0f*PI*60.0f/fs);
+  tune(n, 50.0f);
+  return 1;
+}
+
+// one Goertzel step, g[0] and g[1] are the state, g[2] accumulates power
+static void goertzel(float32_t *g, float32_t coef, float32_t x){
+  float32_t s = x + coef*g[0] - g[1];
+  g[1] = g[0];
+  g[0] = s;
+}
+
+static float32_t goertzelPower(float32_t *g, float32_t coef){
+  return g[0]*g[0] + g[1]*g[1] - coef*g[0]*g[1];
+}
+
+// choose 50 or 60 Hz from the stronger Goertzel output
+static void acquire(notchType *n, float32_t x){
+  goertzel(n->g50, n->coef50, x);
+  goertzel(n->g60, n->coef60, x);
+  if(n->count == n->blockLength){
+    n->g50[2] += goertzelPower(n->g50, n->coef50);
+    n->g60[2] += goertzelPower(n->g60, n->coef60);
+    n->g50[0] = n->g50[1] = 0;
+    n->g60[0] = n->g60[1] = 0;
+    n->blocks++;
+    if(n->blocks == NOTCH_ACQUIRE){
+      n->nominal = (n->g60[2] > n->g50[2]) ? 60.0f : 50.0f;
+      tune(n, n->nominal);
+    }
+  }
+}
+
+// retune from the rotation of the fundamental's weights over the block
+static void track(notchType *n){
+  float32_t phase, d, f;
+  phase = atan2f(-n->ws[0], n->wc[0]);
+  d = phase - n->lastPhase;
+  n->lastPhase = phase;
+  if(d > PI){
+    d -= 2.0f*PI;
+  }else if(d < -PI){
+    d += 2.0f*PI;
+  }
+  f = n->f0 + NOTCH_LOOPGAIN*d*n->fs/(2.0f*PI*(float32_t)n->blockLength);
+  if(f > n->nominal + NOTCH_MAXDRIFT){
+    f = n->nominal + NOTCH_MAXDRIFT;
+  }else if(f < n->nominal - NOTCH_MAXDRIFT){
+    f = n->nominal - NOTCH_MAXDRIFT;
+  }
+  tune(n, f);
+  // keep the oscillator on the unit circle
+  d = 1.0f/sqrtf(n->cosF*n->cosF + n->sinF*n->sinF);
+  n->cosF *= d;
+  n->sinF *= d;
+}
+
+float32_t Notch_Process(notchType *n, float32_t x){
+  uint32_t h;
+  float32_t c, s, t, y, e;
+  n->count++;
+  if(n->nominal == 0){
+    n->dc += (1.0f/1024)*(x - n->dc);
+    acquire(n, x - n->dc);
+    if(n->count == n->blockLength){
+      n->count = 0;
+    }
+    return x;
+  }
+  // estimate hum at every harmonic and subtract it
+  y = x;
+  c = n->cosF;
+  s = n->sinF;
+  for(h = 0; h < n->harmonics; h++){
+    y -= n->wc[h]*c + n->ws[h]*s;
+    t = c*n->cosF - s*n->sinF;     // next harmonic, (c + js)*(cosF + j*sinF)
+    s = s*n->cosF + c*n->sinF;
+    c = t;
+  }
+  n->dc += (1.0f/1024)*(y - n->dc);
+  e = n->mu*(y - n->dc);
+  c = n->cosF;
+  s = n->sinF;
+  for(h = 0; h < n->harmonics; h++){
+    n->wc[h] += e*c;
+    n->ws[h] += e*s;
+    t = c*n->cosF - s*n->sinF;
+    s = s*n->cosF + c*n->sinF;
+    c = t;
+  }
+  t = n->cosF*n->stepC - n->sinF*n->stepS;
+  n->sinF = n->cosF*n->stepS + n->sinF*n->stepC;
+  n->cosF = t;
+  if(n->count == n->blockLength){
+    n->count = 0;
+    track(n);
+  }
+  return y;
+}
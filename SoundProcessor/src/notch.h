@@ -0,0 +1,61 @@
+//*****************************************************************************
+// notch.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Adaptive mains hum notch, locks onto a 50 or 60 Hz fundamental, tracks
+// its drift and removes it and its first harmonics from every sample.
+
+// Each harmonic is removed by an adaptive noise canceller: a cosine and sine
+// at h*f0 are weighted by LMS and subtracted, which behaves as a second
+// order notch of bandwidth NOTCH_BW centred on h*f0. At the capture rate a
+// 50 Hz biquad notch has poles so close to z = 1 that float coefficients
+// can only place it to about 1 Hz; the reference oscillator has no such limit.
+// Once per block the phase drift of the fundamental's weights gives the
+// frequency error, and the oscillator is retuned.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __NOTCH_H
+#define __NOTCH_H  1
+
+#define NOTCH_MAXHARMONICS 8      // maximum harmonics removed, including f0
+#define NOTCH_BW           1.0f   // notch bandwidth in Hz
+#define NOTCH_MAXDRIFT     2.0f   // largest allowed offset from 50 or 60 Hz
+#define NOTCH_LOOPGAIN     0.5f   // fraction of the frequency error corrected per block
+#define NOTCH_ACQUIRE      4      // blocks spent choosing 50 or 60 Hz
+
+struct notch{
+  float32_t fs;            // sample rate in Hz
+  float32_t nominal;       // 50 or 60 Hz once acquired, 0 while acquiring
+  float32_t f0;            // tracked fundamental in Hz
+  uint32_t harmonics;      // harmonics removed
+  float32_t mu;            // LMS step size
+  float32_t cosF, sinF;    // fundamental oscillator
+  float32_t stepC, stepS;  // oscillator rotation per sample
+  float32_t wc[NOTCH_MAXHARMONICS], ws[NOTCH_MAXHARMONICS]; // canceller weights
+  float32_t dc;            // running DC estimate, kept out of the adaptation
+  float32_t lastPhase;     // phase of the fundamental weights at the last block
+  uint32_t blockLength;    // samples per frequency update
+  uint32_t count;          // samples in the current block
+  uint32_t blocks;         // blocks seen during acquisition
+  float32_t g50[3], g60[3];// Goertzel state and power, used while acquiring
+  float32_t coef50, coef60;// Goertzel coefficients
+};
+typedef struct notch notchType;
+
+// ******** Notch_Init ************
+// Initialize adaptive mains notch
+// Inputs:  pointer to notch
+//          sample rate in Hz
+//          number of harmonics to remove, including the fundamental
+// Outputs: 1 if successful, 0 if the parameters are not valid
+int Notch_Init(notchType *n, float32_t fs, uint32_t harmonics);
+
+// ******** Notch_Process ************
+// Remove hum from one sample, called every sample
+// Samples pass through unchanged while 50 or 60 Hz is being chosen
+// Inputs:  pointer to notch
+//          input sample
+// Outputs: sample with hum removed
+float32_t Notch_Process(notchType *n, float32_t x);
+
+#endif
@@ -0,0 +1,136 @@
+//*****************************************************************************
+// onset.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Onset (transient) detector with a pre-trigger capture buffer.
+// Per sample cost is a few multiply-adds, one log10 per hop.
+
+#include <stdint.h>
+#include "onset.h"
+#include "arm_math.h"
+#include "../inc/CortexM.h"
+
+int Onset_Init(onsetType *o, uint32_t post, uint32_t holdoff){
+  if(post + ONSET_HOP >= ONSET_CAPTURELEN){
+    return 0;
+  }
+  o->hopCount = 0;
+  o->hopEnergy = 0;
+  o->dc = 0;
+  o->prevLevel = 0;
+  o->mean = 0;
+  o->dev = ONSET_MINRISE/ONSET_K;
+  o->holdoff = (holdoff + ONSET_HOP - 1)/ONSET_HOP;
+  o->holdCount = 2*ONSET_CAPTURELEN/ONSET_HOP; // let the DC estimate settle
+  o->samples = 0;
+  o->state = ONSET_ARMED;
+  o->pos = 0;
+  o->post = post;
+  o->remaining = 0;
+  o->eventSample = 0;
+  o->eventOffset = 0;
+  o->events = 0;
+  o->missed = 0;
+  return 1;
+}
+
+// end of a hop, returns 1 if the rise in level is an onset
+static int hopDone(onsetType *o){
+  float32_t level, rise, excess, threshold;
+  level = 10*log10f(o->hopEnergy/ONSET_HOP + 1.0f);
+  rise = level - o->prevLevel;
+  o->prevLevel = level;
+  o->hopEnergy = 0;
+  if(rise < 0){
+    rise = 0;  // only rises are onsets
+  }
+  threshold = o->mean + ONSET_K*o->dev;
+  if(threshold < ONSET_MINRISE){
+    threshold = ONSET_MINRISE;
+  }
+  excess = rise - o->mean;
+  if(excess < 0){
+    excess = -excess;
+  }
+  o->mean += ONSET_ALPHA*(rise - o->mean);
+  o->dev += ONSET_ALPHA*(excess - o->dev);
+  if(o->holdCount){
+    o->holdCount--;
+    return 0;
+  }
+  if(rise > threshold){
+    o->holdCount = o->holdoff;
+    return 1;
+  }
+  return 0;
+}
+
+int Onset_Update(onsetType *o, int16_t x){
+  float32_t v;
+  int detected = 0;
+  o->samples++;
+  if(o->state != ONSET_CAPTURED){
+    o->ring[o->pos] = x;
+    o->pos = (o->pos + 1)%ONSET_CAPTURELEN;
+    if(o->state == ONSET_POSTTRIGGER){
+      o->remaining--;
+      if(o->remaining == 0){
+        o->state = ONSET_CAPTURED; // pos is now the oldest sample
+      }
+    }
+  }
+  o->dc += (1.0f/1024)*((float32_t)x - o->dc);
+  v = (float32_t)x - o->dc;
+  o->hopEnergy += v*v;
+  o->hopCount++;
+  if(o->hopCount == ONSET_HOP){
+    o->hopCount = 0;
+    if(hopDone(o)){
+      detected = 1;
+      o->events++;
+      if(o->state == ONSET_ARMED){
+        o->state = ONSET_POSTTRIGGER;
+        o->remaining = o->post;
+        o->eventSample = o->samples - ONSET_HOP;
+        // the hop started ONSET_HOP samples back, and post more samples follow
+        o->eventOffset = ONSET_CAPTURELEN - o->post - ONSET_HOP;
+        if(o->remaining == 0){
+          o->state = ONSET_CAPTURED;
+        }
+      }else{
+        o->missed++;
+      }
+    }
+  }
+  return detected;
+}
+
+int Onset_Oldest(onsetType *o, int16_t *x){
+  if(o->state == ONSET_CAPTURED){
+    return 0;
+  }
+  *x = o->ring[o->pos];
+  return 1;
+}
+
+int Onset_Read(onsetType *o, int16_t *dst){
+  uint32_t i, j;
+  if(o->state != ONSET_CAPTURED){
+    return 0;
+  }
+  j = o->pos;
+  for(i = 0; i < ONSET_CAPTURELEN; i++){
+    dst[i] = o->ring[j];
+    j = (j + 1)%ONSET_CAPTURELEN;
+  }
+  return 1;
+}
+
+void Onset_Release(onsetType *o){
+  uint32_t refill = (ONSET_CAPTURELEN - o->post)/ONSET_HOP;
+  long sr = StartCritical(); // Onset_Update runs in the acquisition interrupt
+  o->state = ONSET_ARMED;
+  if(o->holdCount < refill){
+    o->holdCount = refill; // pre-trigger part must be new samples
+  }
+  EndCritical(sr);
+}
@@ -0,0 +1,95 @@
+//*****************************************************************************
+// onset.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Onset (transient) detector with a pre-trigger capture buffer, so impulsive
+// events such as door slams are caught between the once-per-frame spectra.
+
+// Detection: the energy of each ONSET_HOP sample hop is converted to dB and
+// the rise from the previous hop is compared with an adaptive threshold,
+// mean + ONSET_K * mean absolute deviation of recent rises, never less than
+// ONSET_MINRISE. Timing is to the start of the hop that triggered.
+// Capture: raw samples go into a ring. On a trigger, post more samples are
+// written and then the ring is frozen, holding the ONSET_CAPTURELEN samples
+// around the event until Onset_Release() is called.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __ONSET_H
+#define __ONSET_H  1
+
+#define ONSET_HOP        32     // samples per energy hop
+#define ONSET_CAPTURELEN 1024   // samples held around each event
+#define ONSET_K          4.0f   // threshold in mean absolute deviations
+#define ONSET_MINRISE    6.0f   // smallest rise in dB that can trigger
+#define ONSET_ALPHA      (1.0f/32) // smoothing of the threshold statistics, per hop
+
+enum onsetState{
+  ONSET_ARMED,      // ring running, waiting for an event
+  ONSET_POSTTRIGGER,// event seen, collecting the samples after it
+  ONSET_CAPTURED    // ring frozen, capture ready to be read
+};
+
+struct onset{
+  // detection
+  uint32_t hopCount;       // samples in the current hop
+  float32_t hopEnergy;     // sum of squares in the current hop
+  float32_t dc;            // running DC estimate of the input
+  float32_t prevLevel;     // previous hop level in dB
+  float32_t mean;          // average rise in dB
+  float32_t dev;           // average absolute deviation of the rise in dB
+  uint32_t holdoff;        // hops between events
+  uint32_t holdCount;      // hops left before another event can trigger
+  uint32_t samples;        // samples seen, time base for events
+  // capture
+  enum onsetState state;
+  int16_t ring[ONSET_CAPTURELEN];
+  uint32_t pos;            // next write position, oldest sample when captured
+  uint32_t post;           // samples kept after the trigger
+  uint32_t remaining;      // samples still to collect after the trigger
+  uint32_t eventSample;    // sample number of the start of the event hop
+  uint32_t eventOffset;    // position of the event start within the capture
+  uint32_t events;         // events detected
+  uint32_t missed;         // events detected while a capture was waiting
+};
+typedef struct onset onsetType;
+
+// ******** Onset_Init ************
+// Initialize onset detector and capture buffer
+// Inputs:  pointer to onset detector
+//          samples to keep after the trigger, less than ONSET_CAPTURELEN,
+//          the rest of the capture is before the trigger
+//          minimum samples between events
+// Outputs: 1 if successful, 0 if post does not fit the capture buffer
+int Onset_Init(onsetType *o, uint32_t post, uint32_t holdoff);
+
+// ******** Onset_Update ************
+// Add one raw sample, called every sample
+// Inputs:  pointer to onset detector
+//          raw sample
+// Outputs: 1 if an event was detected on this sample, 0 otherwise
+int Onset_Update(onsetType *o, int16_t x);
+
+// ******** Onset_Oldest ************
+// The sample Onset_Update() is about to overwrite, ONSET_CAPTURELEN
+// samples old, so the ring can serve as the history of a sliding window
+// Call before Onset_Update() for the new sample
+// Inputs:  pointer to onset detector
+//          pointer to the sample
+// Outputs: 1 if successful, 0 while the ring is frozen on a capture
+int Onset_Oldest(onsetType *o, int16_t *x);
+
+// ******** Onset_Read ************
+// Copy a finished capture in time order
+// Inputs:  pointer to onset detector
+//          pointer to ONSET_CAPTURELEN outputs
+// Outputs: 1 if a capture was copied, 0 if none is ready
+int Onset_Read(onsetType *o, int16_t *dst);
+
+// ******** Onset_Release ************
+// Discard the capture and start recording again
+// Called from a thread, changes the state in a critical section
+// Inputs:  pointer to onset detector
+// Outputs: none
+void Onset_Release(onsetType *o);
+
+#endif
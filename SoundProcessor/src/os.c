@@ -10,7 +10,7 @@
 // Project was built on RTOS_4C123 template written and copyrighted by Daniel Valvano, February 2016
 // Copyright 2016 by Jonathan W. Valvano, valvano@mail.utexas.edu
 // This program does currently make use of Valvano's BSP.C and other assembly configurations.
-// RTOS functions and mechanism from template currently not used in this program.
+// The RTOS runs the acquisition, analysis, display and control stages in user.c.
 
 #include <stdint.h>
 #include "os.h"
@@ -18,6 +18,11 @@
 #include "BSP.h"
 #include "arm_math.h"
 #include "arm_common_tables.h"
+#include "hw_memmap.h"
+#include "hw_types.h"
+#include "hw_sysctl.h"
+#include "hw_watchdog.h"
+#include "trace.h"
 
 
 //******** FFT ********\\
@@ -38,21 +43,58 @@ arm_status rfft_fast_init_1024_f32(arm_rfft_fast_instance_f32 * S){
 
 
 //******** OS FUNCTIONS ********\\
-// currently not used in code
 
 // function definitions in osasm.s
 void StartOS(void);
 
 #define NUMTHREADS  3		      // maximum number of threads
-#define STACKSIZE   100      // number of 32-bit words in stack
+#define STACKSIZE   256      // number of words in stack, the analysis thread needs about 700 bytes
+#define IDLESTACKSIZE 128    // the idle thread only needs room for the SysTick handler
+#define IDLEMARGIN  200      // cycles, closer to the tick than this the idle thread does not reprogram SysTick
+#ifdef HOST
+typedef intptr_t stackWordType; // holds the initial PC, a pointer on a 64-bit host, see host/hal.c
+#else
+typedef int32_t stackWordType;  // one register pushed by the SysTick handler
+#endif
 struct tcb{
-  int32_t *sp;       // pointer to stack (valid for threads not running
+  stackWordType *sp; // pointer to stack (valid for threads not running
   struct tcb *next;  // linked-list pointer
+  int32_t *blocked;  // semaphore the thread is waiting on, 0 if none
+  uint32_t *flags;   // flag group the thread is waiting on, 0 if none
+  uint32_t mask;     // bits waited for
+  int32_t all;       // OS_FLAGS_ALL or OS_FLAGS_ANY
+  int32_t timed;     // true if the wait on flags has a timeout
+  uint32_t wake;     // Ticks when the wait on flags times out
+  uint32_t deadline; // ticks ready to run allowed for one job, 0 for none
+  uint32_t age;      // ticks ready to run since the last check-in
+  uint32_t worst;    // most ticks a job has taken
+  uint32_t misses;   // jobs that went past the deadline
+  int32_t critical;  // true if the watchdog waits for this thread's check-in
+  int32_t checkedIn; // true if it checked in since the last feed
+#if OS_STATS
+  uint32_t cycles;   // time running
+  uint32_t switches; // times switched in
+#endif
 };
 typedef struct tcb tcbType;
 tcbType tcbs[NUMTHREADS];
 tcbType *RunPt;
-int32_t Stacks[NUMTHREADS][STACKSIZE];
+stackWordType Stacks[NUMTHREADS][STACKSIZE];
+tcbType IdleTcb;       // runs when every foreground thread is blocked
+tcbType *LastPt;       // foreground thread that ran last, the round robin continues from it
+stackWordType IdleStack[IDLESTACKSIZE];
+uint32_t Slice;        // time slice in cycles, one tick
+uint32_t Ticks;        // ticks since OS_Launch, including those slept through
+uint32_t IdleCycles;   // time in the idle thread
+#define MISSLOGSIZE 8        // deadline misses kept in the log
+struct miss{
+  uint32_t tick;      // Ticks when the deadline passed
+  uint32_t thread;    // index in tcbs
+};
+typedef struct miss missType;
+missType MissLog[MISSLOGSIZE];
+uint32_t MissCount;    // misses so far, the next one goes to MissLog[MissCount%MISSLOGSIZE]
+uint32_t WatchdogLoad; // watchdog timer 0 reload in bus cycles, 0 if it is not used
 
 // declare global variables for mailbox
 uint32_t Mail; // shared data
@@ -60,39 +102,160 @@ int32_t Send; // that's used as a semaphore!
 int32_t Ack; // that's used as a semaphore!
 uint32_t Lost;
 // declare global variables for periodic tasks
-void(*EventThread)(void);
-uint32_t wait;
-uint32_t Counter;
+#define NUMEVENTS   4        // maximum number of periodic event threads
+struct event{
+  void(*task)(void);  // event thread, runs to completion in the SysTick handler
+  uint32_t period;    // ticks between activations
+  uint32_t counter;   // ticks until the next activation
+  uint32_t runs;      // activations so far
+  uint32_t overruns;  // activations that were still running when the next tick came
+};
+typedef struct event eventType;
+eventType Events[NUMEVENTS];
+uint32_t NumEvents;
+#if OS_STATS
+#define STACKPAINT  0xA5A5A5A5 // stack words never written since OS_AddThreads
+uint32_t LastSwitch;   // DWT_CYCCNT when the running thread was switched in
+uint32_t EventCycles;  // time in periodic event threads
+uint32_t SwitchCycles; // time in the rest of the SysTick handler
+#endif
 
 
 // ******** OS_Init ************
 // initialize operating system, disable interrupts until OS_Launch
-// initialize OS controlled I/O: systick
+// initialize OS controlled I/O: systick, DWT cycle counter
 // input:  none
 // output: none
 void OS_Init(void){
   DisableInterrupts();
   BSP_Clock_InitFastest();// set processor clock to fastest speed
-	wait = 1;
+  DEMCR |= DEMCR_TRCENA;  // cycle counter for profiling, DWT_CYCCNT
+  DWT_CYCCNT = 0;
+  DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+	NumEvents = 0;
+}
+
+// initial stack of a thread, size words, the caller sets the PC at size-2
+void SetStack(tcbType *t, stackWordType *stack, int size){
+#if OS_STATS
+  for(int k = 0; k < size; k++){
+    stack[k] = STACKPAINT;
+  }
+  t->cycles = 0;
+  t->switches = 0;
+#endif
+  t->blocked = 0;
+  t->flags = 0;
+  t->timed = 0;
+  t->deadline = 0;
+  t->age = 0;
+  t->worst = 0;
+  t->misses = 0;
+  t->critical = 0;
+  t->checkedIn = 0;
+  t->sp = &stack[size-16];     // thread stack pointer
+  stack[size-1] = 0x01000000;  // thumb bit
+  stack[size-3] = 0x14141414;  // R14
+  stack[size-4] = 0x12121212;  // R12
+  stack[size-5] = 0x03030303;  // R3
+  stack[size-6] = 0x02020202;  // R2
+  stack[size-7] = 0x01010101;  // R1
+  stack[size-8] = 0x00000000;  // R0
+  stack[size-9] = 0x11111111;  // R11
+  stack[size-10] = 0x10101010; // R10
+  stack[size-11] = 0x09090909; // R9
+  stack[size-12] = 0x08080808; // R8
+  stack[size-13] = 0x07070707; // R7
+  stack[size-14] = 0x06060606; // R6
+  stack[size-15] = 0x05050505; // R5
+  stack[size-16] = 0x04040404; // R4
 }
 
 void SetInitialStack(int i){
-  tcbs[i].sp = &Stacks[i][STACKSIZE-16]; // thread stack pointer
-  Stacks[i][STACKSIZE-1] = 0x01000000;   // thumb bit
-  Stacks[i][STACKSIZE-3] = 0x14141414;   // R14
-  Stacks[i][STACKSIZE-4] = 0x12121212;   // R12
-  Stacks[i][STACKSIZE-5] = 0x03030303;   // R3
-  Stacks[i][STACKSIZE-6] = 0x02020202;   // R2
-  Stacks[i][STACKSIZE-7] = 0x01010101;   // R1
-  Stacks[i][STACKSIZE-8] = 0x00000000;   // R0
-  Stacks[i][STACKSIZE-9] = 0x11111111;   // R11
-  Stacks[i][STACKSIZE-10] = 0x10101010;  // R10
-  Stacks[i][STACKSIZE-11] = 0x09090909;  // R9
-  Stacks[i][STACKSIZE-12] = 0x08080808;  // R8
-  Stacks[i][STACKSIZE-13] = 0x07070707;  // R7
-  Stacks[i][STACKSIZE-14] = 0x06060606;  // R6
-  Stacks[i][STACKSIZE-15] = 0x05050505;  // R5
-  Stacks[i][STACKSIZE-16] = 0x04040404;  // R4
+  SetStack(&tcbs[i], Stacks[i], STACKSIZE);
+}
+
+// True if the thread is not waiting, or what it waits for has happened
+static int ready(tcbType *t){
+  uint32_t v;
+  if(t->blocked){
+    return *t->blocked > 0;
+  }
+  if(t->flags){
+    v = *t->flags & t->mask;
+    if(t->all ? (v == t->mask) : (v != 0)){
+      return 1;
+    }
+    return t->timed && ((int32_t)(Ticks - t->wake) >= 0);
+  }
+  return 1;
+}
+
+// Idle thread, runs when every foreground thread is blocked
+// Sleeps until the next tick on which an event thread is due, with SysTick
+// reprogrammed for one long period instead of waking every tick, then
+// credits the ticks slept through to Ticks and the event thread counters
+// The reprogramming makes the tick boundaries a few cycles late per sleep
+void Idle(void){
+  uint32_t i, start, skip, r, load, elapsed, passed, left, early;
+  int32_t d;
+  while(1){
+    DisableInterrupts();
+    start = DWT_CYCCNT;
+    skip = 0x01000000;           // ticks before an event thread is due
+    for(i = 0; i < NumEvents; i++){
+      if(Events[i].counter < skip){
+        skip = Events[i].counter;
+      }
+    }
+    for(i = 0; i < NUMTHREADS; i++){ // a timed flag wait is ready on the tick Ticks reaches wake
+      if(tcbs[i].flags && tcbs[i].timed){
+        d = (int32_t)(tcbs[i].wake - Ticks) - 1;
+        if(d < (int32_t)skip){
+          skip = (d > 0) ? d : 0;
+        }
+      }
+    }
+    r = STCURRENT;               // cycles to the end of this tick
+    if(r < IDLEMARGIN){
+      skip = 0;                  // too close to reprogram, sleep to the tick
+    }else if(skip > (0x01000000 - r)/Slice){
+      skip = (0x01000000 - r)/Slice; // 24-bit reload
+    }
+    early = 0;
+    if(skip){
+      load = r + skip*Slice;
+      STRELOAD = load - 1;
+      STCURRENT = 0;             // reloads on the next cycle
+      STRELOAD = Slice - 1;      // the periods after this one are one tick again
+    }
+    WaitForInterrupt();
+    if(skip){
+      if(INTCTRL & 0x04000000){ // slept to the deadline, the SysTick handler does the last tick
+        passed = skip;
+      }else{                     // woken early, count the ticks gone by and realign
+        elapsed = load - STCURRENT;
+        passed = (elapsed >= r) ? (elapsed - r)/Slice + 1 : 0;
+        left = r + passed*Slice - elapsed;
+        if(left < 2){
+          left = 2;
+        }
+        STRELOAD = left - 1;
+        STCURRENT = 0;
+        STRELOAD = Slice - 1;
+        early = 1;
+      }
+      for(i = 0; i < NumEvents; i++){
+        Events[i].counter -= passed;
+      }
+      Ticks += passed;
+    }
+    IdleCycles += DWT_CYCCNT - start;
+    EnableInterrupts();          // a pending SysTick runs now
+    if(early){
+      OS_Suspend();              // whatever woke us may have readied a thread
+    }
+  }
 }
 
 //******** OS_AddThread ***************
@@ -100,42 +263,197 @@ void SetInitialStack(int i){
 // Inputs: three pointers to a void/void foreground tasks
 // Outputs: 1 if successful, 0 if this thread can not be added
 int OS_AddThreads(void(*task0)(void),
-                 void(*task1)(void)){ 
+                 void(*task1)(void),
+                 void(*task2)(void)){ 
 	int32_t status;
   status = StartCritical();
   tcbs[0].next = &tcbs[1]; // 0 points to 1
-  tcbs[1].next = &tcbs[0]; // 1 points to 2				 
+  tcbs[1].next = &tcbs[2]; // 1 points to 2
+  tcbs[2].next = &tcbs[0]; // 2 points to 0
+  SetStack(&IdleTcb, IdleStack, IDLESTACKSIZE);
+  IdleStack[IDLESTACKSIZE-2] = (stackWordType)(Idle); // PC
+  IdleTcb.next = &IdleTcb;  // not in the round robin
 									 
   SetInitialStack(0); 
-	Stacks[0][STACKSIZE-2] = (int32_t)(task0); // PC
+	Stacks[0][STACKSIZE-2] = (stackWordType)(task0); // PC
 									 
   SetInitialStack(1); 
-	Stacks[1][STACKSIZE-2] = (int32_t)(task1); // PC
-									 	 
+	Stacks[1][STACKSIZE-2] = (stackWordType)(task1); // PC
+									 
+  SetInitialStack(2); 
+	Stacks[2][STACKSIZE-2] = (stackWordType)(task2); // PC
 									 
   RunPt = &tcbs[0];       // thread 0 will run first
+  LastPt = RunPt;
   EndCritical(status);
   return 1;               // successful
 }
 								 
-int OS_AddPeriodicEventThreads(void(*thread)(void), uint32_t period){ // from previous lab assignments
-	EventThread = *thread;
-	wait = period;
-
+int OS_AddPeriodicEventThread(void(*thread)(void), uint32_t period, uint32_t phase){
+	eventType *e;
+	if((NumEvents == NUMEVENTS) || (period == 0) || (phase >= period)){
+		return 0;
+	}
+	e = &Events[NumEvents];
+	e->task = thread;
+	e->period = period;
+	e->counter = phase; // first activation on tick phase, counting from 0
+	e->runs = 0;
+	e->overruns = 0;
+	NumEvents++;
   return 1;
 }
 
+int OS_EventStats(uint32_t i, uint32_t *runs, uint32_t *overruns){
+	if(i >= NumEvents){
+		return 0;
+	}
+	*runs = Events[i].runs;
+	*overruns = Events[i].overruns;
+	return 1;
+}
+
+int OS_SetDeadline(uint32_t i, uint32_t deadline, int32_t critical){
+	if(i >= NUMTHREADS){
+		return 0;
+	}
+	tcbs[i].deadline = deadline;
+	tcbs[i].critical = critical;
+	return 1;
+}
+
+void OS_CheckIn(void){
+	long sr = StartCritical();
+	if(RunPt->age > RunPt->worst){
+		RunPt->worst = RunPt->age;
+	}
+	RunPt->age = 0;
+	RunPt->checkedIn = 1;
+	EndCritical(sr);
+}
+
+int OS_DeadlineStats(uint32_t i, uint32_t *misses, uint32_t *worst){
+	if(i >= NUMTHREADS){
+		return 0;
+	}
+	*misses = tcbs[i].misses;
+	*worst = tcbs[i].worst;
+	return 1;
+}
+
+int OS_MissLog(uint32_t k, uint32_t *tick, uint32_t *thread){
+	missType *m;
+	if((k >= MISSLOGSIZE) || (k >= MissCount)){
+		return 0;
+	}
+	m = &MissLog[(MissCount - 1 - k)%MISSLOGSIZE];
+	*tick = m->tick;
+	*thread = m->thread;
+	return 1;
+}
+
+void OS_WatchdogInit(uint32_t timeout){
+	WatchdogLoad = timeout/2; // the reset comes on the second time out
+}
+
+int OS_WatchdogReset(void){
+	uint32_t cause = HWREG(SYSCTL_RESC);
+	HWREG(SYSCTL_RESC) = 0;
+	return (cause & SYSCTL_RESC_WDT0) ? 1 : 0;
+}
+
+// Called on every tick, ages the jobs of the threads that are ready to run,
+// logs the ones that just passed their deadline, and feeds the watchdog
+// once every critical thread has checked in since the last feed
+static void checkDeadlines(void){
+	uint32_t i, feed = 1;
+	tcbType *t;
+	for(i = 0; i < NUMTHREADS; i++){
+		t = &tcbs[i];
+		if(t->deadline && ready(t)){
+			t->age++;
+			if(t->age == t->deadline + 1){ // once per job
+				t->misses++;
+				MissLog[MissCount%MISSLOGSIZE].tick = Ticks;
+				MissLog[MissCount%MISSLOGSIZE].thread = i;
+				MissCount++;
+			}
+		}
+		if(t->critical && (t->checkedIn == 0)){
+			feed = 0;
+		}
+	}
+	if(WatchdogLoad && feed){
+		HWREG(WATCHDOG0_BASE + WDT_O_LOAD) = WatchdogLoad; // restarts the count
+		for(i = 0; i < NUMTHREADS; i++){
+			tcbs[i].checkedIn = 0;
+		}
+	}
+}
+
 //******** SCHEDULER ********\\
-// Round Robin Scheduler, runs every ms
+// Round Robin Scheduler, runs every time slice and on OS_Suspend
 void Scheduler(void){ // Program 3.12 from book
   // run any periodic event threads if needed
   // implement round robin scheduler, update RunPt
-	if ((++Counter) == wait){	
-			EventThread();
-			Counter = 0; // reset counter
+#if OS_STATS
+	uint32_t start = DWT_CYCCNT, events = 0;
+	RunPt->cycles += start - LastSwitch;
+#endif
+	// COUNTFLAG is only set when the slice ran out, so a thread giving up
+	// its slice early does not advance the event thread timing
+	uint32_t tick = STCTRL & 0x00010000; // reading clears it
+	TRACE(TRACE_TICK, 0, tick != 0);
+	if (tick){
+		uint32_t late = 0; // true once the next tick has come
+		Ticks++;
+		for(uint32_t i = 0; i < NumEvents; i++){ // in the order they were added
+			eventType *e = &Events[i];
+			if(e->counter == 0){
+				TRACE(TRACE_EVENT_ENTER, i, 0);
+				EnableInterrupts(); // device interrupts above SysTick, e.g. the ADC, run during event threads
+#if OS_STATS
+				uint32_t t = DWT_CYCCNT;
+				e->task();
+				events += DWT_CYCCNT - t;
+#else
+				e->task();
+#endif
+				DisableInterrupts();
+				TRACE(TRACE_EVENT_EXIT, i, 0);
+				e->runs++;
+				e->counter = e->period;
+				if((late == 0) && (INTCTRL & 0x04000000)){ // SysTick pending, the tick ended while this thread ran
+					e->overruns++;
+					late = 1;
+				}
+			}
+			e->counter--;
+		}
+		checkDeadlines();
+	}
+	// Round Robin scheduler, skipping blocked threads
+	tcbType *pt = LastPt;
+	uint32_t n;
+	for(n = 0; n < NUMTHREADS; n++){
+		pt = pt->next;
+		if(ready(pt)){
+			break;
+		}
 	}
-	// Round Robin scheduler
-	RunPt = RunPt->next;
+	if(n == NUMTHREADS){
+		RunPt = &IdleTcb; // all blocked
+	}else{
+		RunPt = pt;
+		LastPt = pt;
+	}
+	TRACE(TRACE_SWITCH, (RunPt == &IdleTcb) ? TRACE_IDLE : RunPt - tcbs, 0);
+#if OS_STATS
+	RunPt->switches++;
+	LastSwitch = DWT_CYCCNT;
+	EventCycles += events;
+	SwitchCycles += LastSwitch - start - events;
+#endif
 	
 	return;
 }
@@ -150,10 +468,71 @@ void OS_Launch(uint32_t theTimeSlice){
   STCURRENT = 0;               // any write to current clears it
   SYSPRI3 =(SYSPRI3&0x00FFFFFF)|0xE0000000; // priority 7
   STRELOAD = theTimeSlice - 1; // reload value
+  Slice = theTimeSlice;
+  Ticks = 0;
+  if(WatchdogLoad){
+    HWREG(SYSCTL_RCGCWD) |= SYSCTL_RCGCWD_R0;
+    while((HWREG(SYSCTL_PRWD) & SYSCTL_PRWD_R0) == 0){};
+    HWREG(WATCHDOG0_BASE + WDT_O_LOAD) = WatchdogLoad;
+    HWREG(WATCHDOG0_BASE + WDT_O_TEST) |= WDT_TEST_STALL; // hold while halted by the debugger
+    HWREG(WATCHDOG0_BASE + WDT_O_CTL) |= WDT_CTL_RESEN | WDT_CTL_INTEN; // starts counting, no NVIC interrupt
+  }
   STCTRL = 0x00000007;         // enable, core clock and interrupt arm
+#if OS_STATS
+  RunPt->switches = 1;
+  LastSwitch = DWT_CYCCNT;
+#endif
   StartOS();                   // start on the first task
 }
 
+int OS_ThreadStats(uint32_t i, uint32_t *cycles, uint32_t *switches, uint32_t *stackUsed){
+	if(i >= NUMTHREADS){
+		return 0;
+	}
+#if OS_STATS
+	uint32_t k = 0;
+	*cycles = tcbs[i].cycles;
+	*switches = tcbs[i].switches;
+	while((k < STACKSIZE) && (Stacks[i][k] == (stackWordType)STACKPAINT)){ // the stack grows down to Stacks[i][0]
+		k++;
+	}
+	*stackUsed = sizeof(stackWordType)*(STACKSIZE - k);
+#else
+	*cycles = 0;
+	*switches = 0;
+	*stackUsed = 0;
+#endif
+	return 1;
+}
+
+uint32_t OS_TickCount(void){
+	return Ticks;
+}
+
+uint32_t OS_IdleCycles(void){
+	return IdleCycles;
+}
+
+void OS_HandlerStats(uint32_t *eventCycles, uint32_t *switchCycles, uint32_t *stackSize){
+#if OS_STATS
+	*eventCycles = EventCycles;
+	*switchCycles = SwitchCycles;
+#else
+	*eventCycles = 0;
+	*switchCycles = 0;
+#endif
+	*stackSize = sizeof(stackWordType)*STACKSIZE;
+}
+
+// ******** OS_Suspend ************
+// Give up the rest of the time slice, the next thread runs now
+// The time slice boundaries and the periodic event threads are unchanged
+// Inputs:  none
+// Outputs: none
+void OS_Suspend(void){
+	INTCTRL = 0x04000000; // pend SysTick, the switch happens once interrupts are enabled
+}
+
 //******** SEMAPHORES ********\\
 
 void OS_InitSemaphore(int32_t *semaPt, int32_t value){
@@ -161,26 +540,66 @@ void OS_InitSemaphore(int32_t *semaPt, int32_t value){
 }
 
 void OS_Wait(int32_t *semaPt){
-	DisableInterrupts();
-	while ((*semaPt) == 0){
-		EnableInterrupts();
-		DisableInterrupts();
-	}
 	// decrease counter and get out of here, value is either 0 or greater
-	*semaPt = (*semaPt) - 1; 
-	EnableInterrupts();
+	while(OS_AtomicTake(semaPt) == 0){
+		RunPt->blocked = semaPt; // not scheduled until the semaphore is signalled
+		TRACE(TRACE_WAIT, RunPt - tcbs, (uintptr_t)semaPt);
+		OS_Suspend(); // nothing to do until another thread or the event thread signals
+	}
+	RunPt->blocked = 0;
 	
 	return;
 }
 
 void OS_Signal(int32_t *semaPt){
-	DisableInterrupts();
-	(*semaPt)++; 	// dereference and increment
-	EnableInterrupts();
+	OS_AtomicAdd(semaPt, 1); // safe with interrupts disabled, as in the SysTick handler
+	TRACE(TRACE_SIGNAL, 0, (uintptr_t)semaPt);
 	
 	return;
 }
 
+//******** EVENT FLAGS ********\\
+
+void OS_FlagsInit(uint32_t *flagsPt, uint32_t value){
+	*flagsPt = value;
+}
+
+uint32_t OS_FlagsSet(uint32_t *flagsPt, uint32_t bits){
+	TRACE(TRACE_FLAGS_SET, 0, bits);
+	return OS_AtomicOr(flagsPt, bits);
+}
+
+uint32_t OS_FlagsClear(uint32_t *flagsPt, uint32_t bits){
+	return OS_AtomicAndNot(flagsPt, bits);
+}
+
+uint32_t OS_FlagsWait(uint32_t *flagsPt, uint32_t bits, int32_t all,
+                      int32_t clear, uint32_t timeout){
+	uint32_t v;
+	RunPt->mask = bits;
+	RunPt->all = all;
+	RunPt->wake = Ticks + timeout;
+	RunPt->timed = (timeout != OS_FOREVER);
+	while(1){
+		v = *flagsPt & bits;
+		if(all ? (v == bits) : (v != 0)){
+			break;
+		}
+		if(RunPt->timed && ((int32_t)(Ticks - RunPt->wake) >= 0)){
+			v = 0; // timed out
+			break;
+		}
+		RunPt->flags = flagsPt; // not scheduled until the bits are set or the timeout
+		TRACE(TRACE_FLAGS_WAIT, RunPt - tcbs, bits);
+		OS_Suspend();
+	}
+	RunPt->flags = 0;
+	if(clear && v){
+		OS_AtomicAndNot(flagsPt, v);
+	}
+	return v;
+}
+
 //******** MAIL BOX ********\\
 
 void OS_MailBox_Init(void){
@@ -10,23 +10,25 @@
 // Project was built on RTOS_4C123 template written and copyrighted by Daniel Valvano, February 2016
 // Copyright 2016 by Jonathan W. Valvano, valvano@mail.utexas.edu
 // This program does currently make use of Valvano's BSP.C and other assembly configurations.
-// RTOS functions and mechanism from template currently not used in this program.
+// The RTOS runs the acquisition, analysis, display and control stages in user.c.
 
 #include "arm_math.h"
 #ifndef __OS_H
 #define __OS_H  1
 
+#ifndef OS_STATS
+#define OS_STATS 1  // scheduler statistics, 0 removes them and their overhead
+#endif
 
 //******** FFT ********\\
 // initialize transform function with only one fiddle factor table
 arm_status rfft_fast_init_1024_f32(arm_rfft_fast_instance_f32 * S);
 
 //******** OS FUNCTIONS ********\\
-// currently not used in code
 
 // ******** OS_Init ************
 // initialize operating system, disable interrupts until OS_Launch
-// initialize OS controlled I/O: systick,
+// initialize OS controlled I/O: systick, DWT cycle counter
 // input:  none
 // output: none
 void OS_Init(void);
@@ -36,19 +38,66 @@ void OS_Init(void);
 // Inputs: three pointers to a void/void foreground tasks
 // Outputs: 1 if successful, 0 if this thread can not be added
 int OS_AddThreads(void(*task0)(void),
-                 void(*task1)(void));
+                 void(*task1)(void),
+                 void(*task2)(void));
 
-//******** OS_AddPeriodicEventThreads ***************
-// Add two background periodic event threads
+//******** OS_AddPeriodicEventThread ***************
+// Add a background periodic event thread, up to NUMEVENTS in os.c
 // Typically this function receives the highest priority
-// Inputs: pointers to a void/void event thread function2
-//         periods given in units of OS_Launch (Lab 2 this will be msec)
+// Inputs: pointer to a void/void event thread function
+//         period given in units of OS_Launch time slices (ticks)
+//         phase, tick of the first activation, 0 to period-1, so threads
+//         with the same period can be spread over different ticks
 // Outputs: 1 if successful, 0 if this thread cannot be added
+// Threads due on the same tick run in the order they were added
 // It is assumed that the event threads will run to completion and return
-// It is assumed the time to run these event threads is short compared to 1 msec
+// It is assumed the time to run the event threads due on one tick is short
+// compared to the time slice; a thread still running when the next tick
+// comes is counted as an overrun
 // These threads cannot spin, block, loop, sleep, or kill
-// These threads can call OS_Signal
-int OS_AddPeriodicEventThreads(void(*thread)(void), uint32_t period);
+// These threads can call OS_Signal and OS_FlagsSet
+// They run in the SysTick handler with interrupts enabled, so device
+// interrupts of higher priority than SysTick (7) are taken while they run
+int OS_AddPeriodicEventThread(void(*thread)(void), uint32_t period, uint32_t phase);
+
+//******** OS_EventStats ***************
+// Activation counts of a periodic event thread
+// Inputs: index of the thread, in the order they were added
+//         pointers to the number of activations and of overruns
+// Outputs: 1 if successful, 0 if there is no such thread
+int OS_EventStats(uint32_t i, uint32_t *runs, uint32_t *overruns);
+
+//******** OS_ThreadStats ***************
+// Scheduler statistics of a foreground thread, 0 if OS_STATS is 0
+// Run time is measured with DWT_CYCCNT from the end of one switch to the
+// start of the next, so SysTick handler time is not charged to threads.
+// The stack is painted when the thread is added; the high water mark is
+// the deepest word that no longer holds the paint, found by a scan of up
+// to STACKSIZE words, so call it from a foreground thread
+// Inputs: index of the thread, in the order given to OS_AddThreads
+//         pointers to the cycles it has run, the times it was switched
+//         in and the most stack it has used in bytes
+// Outputs: 1 if successful, 0 if there is no such thread
+int OS_ThreadStats(uint32_t i, uint32_t *cycles, uint32_t *switches, uint32_t *stackUsed);
+
+//******** OS_TickCount ***************
+// Ticks since OS_Launch, including the ones the idle thread slept through
+// Inputs: none
+// Outputs: number of time slices
+uint32_t OS_TickCount(void);
+
+//******** OS_IdleCycles ***************
+// Time spent in the idle thread, mostly asleep in WaitForInterrupt
+// Inputs: none
+// Outputs: DWT_CYCCNT cycles since OS_Launch, wraps like DWT_CYCCNT
+uint32_t OS_IdleCycles(void);
+
+//******** OS_HandlerStats ***************
+// Time spent in the SysTick handler, 0 if OS_STATS is 0
+// Inputs: pointers to the cycles spent in periodic event threads and in
+//         the rest of the scheduler, and to the stack size in bytes
+// Outputs: none
+void OS_HandlerStats(uint32_t *eventCycles, uint32_t *switchCycles, uint32_t *stackSize);
 
 //******** OS_Launch ***************
 // start the scheduler, enable interrupts
@@ -57,6 +106,63 @@ int OS_AddPeriodicEventThreads(void(*thread)(void), uint32_t period);
 // Outputs: none (does not return)
 void OS_Launch(uint32_t theTimeSlice);
 
+// ******** OS_Suspend ************
+// Give up the rest of the time slice, the next thread runs now
+// The time slice boundaries and the periodic event threads are unchanged
+// Inputs:  none
+// Outputs: none
+void OS_Suspend(void);
+
+//******** OS_SetDeadline ***************
+// Give a foreground thread a deadline, and make it critical to the watchdog
+// The thread calls OS_CheckIn each time it finishes a job. The ticks it
+// spends ready to run since its last check-in are counted, ticks waiting
+// on a semaphore are not; more than deadline of them is a miss, counted
+// and logged once per job
+// Inputs: index of the thread, in the order given to OS_AddThreads
+//         deadline in ticks, 0 for none
+//         1 if the watchdog is only fed while this thread checks in, else 0
+// Outputs: 1 if successful, 0 if there is no such thread
+int OS_SetDeadline(uint32_t i, uint32_t deadline, int32_t critical);
+
+//******** OS_CheckIn ***************
+// The running thread has finished a job, its deadline starts again
+// Inputs: none
+// Outputs: none
+void OS_CheckIn(void);
+
+//******** OS_DeadlineStats ***************
+// Deadline misses of a foreground thread
+// Inputs: index of the thread, in the order given to OS_AddThreads
+//         pointers to the number of misses and to the most ticks a job
+//         has taken, measured at check-in
+// Outputs: 1 if successful, 0 if there is no such thread
+int OS_DeadlineStats(uint32_t i, uint32_t *misses, uint32_t *worst);
+
+//******** OS_MissLog ***************
+// Entry of the deadline miss log, which keeps the latest MISSLOGSIZE misses
+// Inputs: age of the entry, 0 for the latest miss
+//         pointers to the tick (OS_TickCount) of the miss and to the thread index
+// Outputs: 1 if successful, 0 if there is no such entry
+int OS_MissLog(uint32_t k, uint32_t *tick, uint32_t *thread);
+
+//******** OS_WatchdogInit ***************
+// Arm watchdog timer 0 when OS_Launch starts the scheduler
+// The scheduler feeds it on a tick once every critical thread has checked
+// in since the last feed, so a critical thread must finish a job more often
+// than the timeout even when it has nothing to do; if none checks in for
+// the whole timeout, or the SysTick handler stops, the part is reset.
+// The watchdog stalls while the debugger halts the processor.
+// Inputs: timeout in bus cycles, at least two ticks
+// Outputs: none
+void OS_WatchdogInit(uint32_t timeout);
+
+//******** OS_WatchdogReset ***************
+// Cause of the latest reset, clears the cause so a later reset is told apart
+// Inputs: none
+// Outputs: 1 if the watchdog reset the part, 0 otherwise
+int OS_WatchdogReset(void);
+
 // ******** OS_InitSemaphore ************
 // Initialize counting semaphore
 // Inputs:  pointer to a semaphore
@@ -66,8 +172,12 @@ void OS_InitSemaphore(int32_t *semaPt, int32_t value);
 
 // ******** OS_Wait ************
 // Decrement semaphore
-// Lab2 spinlock (does not suspend while spinning)
+// Lab2 spinlock, gives up the time slice while spinning, and the scheduler
+// skips the thread until the semaphore is signalled; when every thread is
+// waiting the idle thread sleeps until the next event thread is due
 // Lab3 block if less than zero
+// The decrement is an OS_AtomicTake, interrupts stay enabled
+// Call from foreground threads only
 // Inputs:  pointer to a counting semaphore
 // Outputs: none
 void OS_Wait(int32_t *semaPt);
@@ -76,10 +186,82 @@ void OS_Wait(int32_t *semaPt);
 // Increment semaphore
 // Lab2 spinlock
 // Lab3 wakeup blocked thread if appropriate
+// The increment is an OS_AtomicAdd, so it leaves the interrupt mask alone
+// and can be called from threads, event threads and interrupt handlers
 // Inputs:  pointer to a counting semaphore
 // Outputs: none
 void OS_Signal(int32_t *semaPt);
 
+//******** EVENT FLAGS ********\\
+// A flag group is a 32-bit word, one bit per condition. Handlers and
+// threads set and clear bits with atomic operations; a thread can wait for
+// any or all of a set of bits, with a timeout. Like semaphores, the waiting
+// thread is skipped by the scheduler until its bits are set or the timeout
+// passes, and the idle thread wakes in time for the timeout.
+
+#define OS_FLAGS_ANY   0  // OS_FlagsWait returns when one of the bits is set
+#define OS_FLAGS_ALL   1  // OS_FlagsWait returns when all of the bits are set
+#define OS_FOREVER     0  // OS_FlagsWait timeout, never times out
+
+// ******** OS_FlagsInit ************
+// Inputs:  pointer to a flag group
+//          initial bits
+// Outputs: none
+void OS_FlagsInit(uint32_t *flagsPt, uint32_t value);
+
+// ******** OS_FlagsSet ************
+// Set bits in a flag group, safe in handlers and event threads
+// Inputs:  pointer to a flag group
+//          bits to set
+// Outputs: all bits of the group after the change
+uint32_t OS_FlagsSet(uint32_t *flagsPt, uint32_t bits);
+
+// ******** OS_FlagsClear ************
+// Clear bits in a flag group, safe in handlers and event threads
+// Inputs:  pointer to a flag group
+//          bits to clear
+// Outputs: all bits of the group after the change
+uint32_t OS_FlagsClear(uint32_t *flagsPt, uint32_t bits);
+
+// ******** OS_FlagsWait ************
+// Wait until any or all of the bits are set, from a foreground thread
+// When clear is 1, the bits returned are cleared, so each setting is
+// taken once; with several threads clearing the same bit one of them
+// may see it for nothing
+// Inputs:  pointer to a flag group
+//          bits waited for
+//          OS_FLAGS_ANY or OS_FLAGS_ALL
+//          1 to clear the bits returned, 0 to leave them set
+//          timeout in ticks, OS_FOREVER to wait without one
+// Outputs: the waited for bits that are set, 0 on a timeout
+uint32_t OS_FlagsWait(uint32_t *flagsPt, uint32_t bits, int32_t all,
+                      int32_t clear, uint32_t timeout);
+
+//******** ATOMICS ********\\
+// Read-modify-write of one word with LDREX/STREX in osasm.s, retried if
+// an interrupt or another thread got in between, so no interrupt masking
+
+// ******** OS_AtomicAdd ************
+// Inputs:  pointer to a word, amount added
+// Outputs: the new value
+int32_t OS_AtomicAdd(int32_t *pt, int32_t n);
+
+// ******** OS_AtomicTake ************
+// Decrement a word if it is above 0
+// Inputs:  pointer to a word
+// Outputs: 1 if it was decremented, 0 if it was 0 or less
+int32_t OS_AtomicTake(int32_t *pt);
+
+// ******** OS_AtomicOr ************
+// Inputs:  pointer to a word, bits to set
+// Outputs: the new value
+uint32_t OS_AtomicOr(uint32_t *pt, uint32_t bits);
+
+// ******** OS_AtomicAndNot ************
+// Inputs:  pointer to a word, bits to clear
+// Outputs: the new value
+uint32_t OS_AtomicAndNot(uint32_t *pt, uint32_t bits);
+
 // ******** OS_MailBox_Init ************
 // Initialize communication channel
 // Producer is an event thread, consumer is a main thread
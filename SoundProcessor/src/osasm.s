@@ -32,6 +32,10 @@
         EXTERN  RunPt            ; currently running thread
         EXPORT  StartOS
         EXPORT  SysTick_Handler
+        EXPORT  OS_AtomicAdd
+        EXPORT  OS_AtomicTake
+        EXPORT  OS_AtomicOr
+        EXPORT  OS_AtomicAndNot
 		IMPORT  Scheduler
 
 
@@ -67,5 +71,53 @@ StartOS
     CPSIE   I                  ; Enable interrupts at processor level
     BX      LR                 ; start first thread
 
+;*********** Atomic read-modify-write ***********
+; LDREX/STREX retry loops, the store fails and the loop repeats if an
+; interrupt or another thread touched the word in between, so interrupts
+; never have to be disabled and these can be called from handlers
+; int32_t OS_AtomicAdd(int32_t *pt, int32_t n): *pt += n, returns the new value
+OS_AtomicAdd
+    LDREX   R2, [R0]           ; R2 = *pt, start exclusive access
+    ADD     R2, R2, R1
+    STREX   R3, R2, [R0]       ; R3 = 0 if the store happened
+    CMP     R3, #0
+    BNE     OS_AtomicAdd       ; interrupted, try again
+    MOV     R0, R2
+    BX      LR
+; int32_t OS_AtomicTake(int32_t *pt): decrements *pt if it is above 0,
+; returns 1 if it did, 0 if *pt was 0 or less
+OS_AtomicTake
+    LDREX   R1, [R0]
+    CMP     R1, #0
+    BLE     TakeFail           ; signed, nothing to take
+    SUB     R1, R1, #1
+    STREX   R2, R1, [R0]
+    CMP     R2, #0
+    BNE     OS_AtomicTake
+    MOV     R0, #1
+    BX      LR
+TakeFail
+    CLREX                      ; give up the exclusive access
+    MOV     R0, #0
+    BX      LR
+; uint32_t OS_AtomicOr(uint32_t *pt, uint32_t bits): sets bits, returns the new value
+OS_AtomicOr
+    LDREX   R2, [R0]
+    ORR     R2, R2, R1
+    STREX   R3, R2, [R0]
+    CMP     R3, #0
+    BNE     OS_AtomicOr
+    MOV     R0, R2
+    BX      LR
+; uint32_t OS_AtomicAndNot(uint32_t *pt, uint32_t bits): clears bits, returns the new value
+OS_AtomicAndNot
+    LDREX   R2, [R0]
+    BIC     R2, R2, R1
+    STREX   R3, R2, [R0]
+    CMP     R3, #0
+    BNE     OS_AtomicAndNot
+    MOV     R0, R2
+    BX      LR
+
     ALIGN
     END
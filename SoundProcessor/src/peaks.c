@@ -0,0 +1,152 @@
+//*****************************************************************************
+// peaks.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Spectral peak picking with parabolic interpolation and frame to frame
+// tracking with birth, continuation and death.
+
+#include <stdint.h>
+#include "peaks.h"
+#include "arm_math.h"
+
+void Peaks_Init(peaksType *p, float32_t binHz){
+  uint32_t i;
+  p->binHz = binHz;
+  p->numPeaks = 0;
+  for(i = 0; i < PEAKS_MAXTRACKS; i++){
+    p->tracks[i].id = 0;
+  }
+  p->nextId = 1;
+}
+
+// local maxima within PEAKS_RANGE of the largest, strongest first
+static void pick(peaksType *p, const float32_t *dB, uint32_t length){
+  float32_t largest, a, b, c, d, amp;
+  uint32_t i, j, index;
+  p->numPeaks = 0;
+  arm_max_f32(dB, length, &largest, &index);
+  for(i = 1; i < length - 1; i++){
+    a = dB[i - 1];
+    b = dB[i];
+    c = dB[i + 1];
+    if((b <= a) || (b < c) || (b < largest - PEAKS_RANGE)){
+      continue;
+    }
+    // vertex of the parabola through the three points, d is in bins
+    d = 0.5f*(a - c)/(a - 2*b + c);
+    amp = b - 0.25f*(a - c)*d;
+    if((p->numPeaks == PEAKS_MAXPEAKS) && (amp <= p->peaks[PEAKS_MAXPEAKS - 1].amp)){
+      continue;
+    }
+    j = (p->numPeaks < PEAKS_MAXPEAKS) ? p->numPeaks++ : PEAKS_MAXPEAKS - 1;
+    while((j > 0) && (p->peaks[j - 1].amp < amp)){ // insertion by level
+      p->peaks[j] = p->peaks[j - 1];
+      j--;
+    }
+    p->peaks[j].freq = ((float32_t)(i + 1) + d)*p->binHz; // element i is bin i+1
+    p->peaks[j].amp = amp;
+  }
+}
+
+void Peaks_Update(peaksType *p, const float32_t *dB, uint32_t length){
+  uint8_t matched[PEAKS_MAXTRACKS];
+  trackType *t;
+  float32_t err, bestErr;
+  int32_t best;
+  uint32_t i, j;
+  pick(p, dB, length);
+  for(i = 0; i < PEAKS_MAXTRACKS; i++){
+    matched[i] = 0;
+  }
+  for(j = 0; j < p->numPeaks; j++){
+    // continuation, nearest unmatched track to its prediction
+    best = -1;
+    bestErr = PEAKS_MAXJUMP*p->binHz;
+    for(i = 0; i < PEAKS_MAXTRACKS; i++){
+      t = &p->tracks[i];
+      if((t->id == 0) || matched[i]){
+        continue;
+      }
+      err = fabsf(p->peaks[j].freq - (t->freq + t->slope));
+      if(err < bestErr){
+        bestErr = err;
+        best = (int32_t)i;
+      }
+    }
+    if(best >= 0){
+      t = &p->tracks[best];
+      t->slope = p->peaks[j].freq - t->freq;
+      t->age++;
+    }else{
+      // birth, in a free slot or else over the track missing longest
+      for(i = 0; i < PEAKS_MAXTRACKS; i++){
+        if(p->tracks[i].id == 0){
+          best = (int32_t)i;
+          break;
+        }
+        if((matched[i] == 0) && p->tracks[i].missed &&
+           ((best < 0) || (p->tracks[i].missed > p->tracks[best].missed))){
+          best = (int32_t)i;
+        }
+      }
+      if(best < 0){
+        continue;  // table full of live tracks, weaker peaks are dropped
+      }
+      t = &p->tracks[best];
+      t->id = p->nextId++;
+      if(p->nextId == 0){
+        p->nextId = 1;
+      }
+      t->slope = 0;
+      t->age = 0;
+    }
+    t->freq = p->peaks[j].freq;
+    t->amp = p->peaks[j].amp;
+    t->missed = 0;
+    matched[best] = 1;
+  }
+  // death, tracks coast along their slope while missing
+  for(i = 0; i < PEAKS_MAXTRACKS; i++){
+    t = &p->tracks[i];
+    if((t->id == 0) || matched[i]){
+      continue;
+    }
+    t->missed++;
+    t->freq += t->slope;
+    if(t->missed > PEAKS_MAXMISSED){
+      t->id = 0;
+    }
+  }
+}
+
+uint32_t Peaks_Stable(peaksType *p, float32_t *freq, float32_t *amp, uint32_t max){
+  float32_t level[PEAKS_MAXTRACKS];
+  trackType *t;
+  uint32_t i, j, n = 0;
+  for(i = 0; i < PEAKS_MAXTRACKS; i++){
+    t = &p->tracks[i];
+    if((t->id == 0) || t->missed || (t->age < PEAKS_STABLE)){
+      continue;
+    }
+    if((n == max) && ((n == 0) || (t->amp <= level[n - 1]))){
+      continue;
+    }
+    j = (n < max) ? n++ : max - 1;
+    while((j > 0) && (level[j - 1] < t->amp)){ // insertion by level
+      level[j] = level[j - 1];
+      if(freq){
+        freq[j] = freq[j - 1];
+      }
+      j--;
+    }
+    level[j] = t->amp;
+    if(freq){
+      freq[j] = t->freq;
+    }
+  }
+  if(amp){
+    for(i = 0; i < n; i++){
+      amp[i] = level[i];
+    }
+  }
+  return n;
+}
@@ -0,0 +1,79 @@
+//*****************************************************************************
+// peaks.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Spectral peak tracker, follows the strongest tonal components from frame
+// to frame instead of the single largest bin.
+
+// Each frame the picker finds local maxima of the dB spectrum, keeps the
+// PEAKS_MAXPEAKS strongest within PEAKS_RANGE dB of the largest, and refines
+// each by fitting a parabola through the peak bin and its neighbours.
+// Peaks are then matched to tracks, strongest peak first, against each
+// track's predicted frequency (last frequency plus last change):
+//   continuation  a peak within PEAKS_MAXJUMP bins of the prediction
+//   birth         an unmatched peak takes a free track slot
+//   death         a track unmatched for more than PEAKS_MAXMISSED frames
+// A track is stable once it has been continued PEAKS_STABLE frames.
+// Both tables are fixed size, nothing is allocated.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __PEAKS_H
+#define __PEAKS_H  1
+
+#define PEAKS_MAXPEAKS  8      // peaks picked per frame
+#define PEAKS_MAXTRACKS 8      // tracks followed at once
+#define PEAKS_RANGE     30.0f  // peaks more than this many dB below the largest are ignored
+#define PEAKS_MAXJUMP   3.0f   // largest prediction error in bins for a continuation
+#define PEAKS_MAXMISSED 2      // frames a track survives without a peak
+#define PEAKS_STABLE    3      // continuations before a track is reported
+
+struct peak{
+  float32_t freq;        // interpolated frequency in Hz
+  float32_t amp;         // interpolated level in dB
+};
+typedef struct peak peakType;
+
+struct track{
+  uint32_t id;           // unique while the tracker runs, 0 for a free slot
+  float32_t freq;        // latest frequency in Hz
+  float32_t slope;       // change of frequency over the last frame in Hz
+  float32_t amp;         // latest level in dB
+  uint32_t age;          // frames continued since birth
+  uint32_t missed;       // frames since the last matching peak
+};
+typedef struct track trackType;
+
+struct peaks{
+  float32_t binHz;       // width of one bin in Hz
+  uint32_t numPeaks;     // peaks picked in the latest frame, strongest first
+  peakType peaks[PEAKS_MAXPEAKS];
+  trackType tracks[PEAKS_MAXTRACKS];
+  uint32_t nextId;
+};
+typedef struct peaks peaksType;
+
+// ******** Peaks_Init ************
+// Initialize peak tracker with no tracks
+// Inputs:  pointer to tracker
+//          width of one FFT bin in Hz
+// Outputs: none
+void Peaks_Init(peaksType *p, float32_t binHz);
+
+// ******** Peaks_Update ************
+// Pick the peaks of one frame and update the tracks
+// Inputs:  pointer to tracker
+//          spectrum in dB, element k-1 is bin k, same layout as magnitudeArr
+//          number of elements
+// Outputs: none
+void Peaks_Update(peaksType *p, const float32_t *dB, uint32_t length);
+
+// ******** Peaks_Stable ************
+// Stable tracks of the latest frame, strongest first
+// Inputs:  pointer to tracker
+//          frequencies in Hz, filled in (may be 0)
+//          levels in dB, filled in (may be 0)
+//          room in the arrays
+// Outputs: number of stable tracks returned
+uint32_t Peaks_Stable(peaksType *p, float32_t *freq, float32_t *amp, uint32_t max);
+
+#endif
@@ -0,0 +1,117 @@
+//*****************************************************************************
+// pool.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Fixed-block memory pool with a free list per block size.
+
+#include <stdint.h>
+#include "pool.h"
+#include "../inc/CortexM.h"
+
+int Pool_Init(poolType *p, uint32_t *arena, uint32_t words,
+              const uint32_t *sizes, const uint32_t *counts, uint32_t numClasses){
+  poolClassType *c;
+  uint32_t i, j, size;
+  p->numClasses = 0;
+  if((numClasses == 0) || (numClasses > POOL_MAXCLASSES)){
+    return 0;
+  }
+  for(i = 0; i < numClasses; i++){
+    c = &p->classes[i];
+    size = (sizes[i] + 3)/4;   // in words
+    if((4*size < sizeof(void *)) || ((i > 0) && (4*size <= p->classes[i-1].size)) ||
+       (size*counts[i] > words)){
+      return 0;
+    }
+    c->size = 4*size;
+    c->count = counts[i];
+    c->base = arena;
+    c->end = arena + size*counts[i];
+    c->free = 0;
+    for(j = counts[i]; j > 0; j--){ // lowest address first in the list
+      *(void **)&arena[size*(j-1)] = c->free;
+      c->free = &arena[size*(j-1)];
+    }
+    c->used = 0;
+    c->peak = 0;
+    c->fails = 0;
+    arena = c->end;
+    words = words - size*counts[i];
+  }
+  p->numClasses = numClasses;
+  return 1;
+}
+
+// smallest class whose blocks hold size bytes
+static poolClassType *classOf(poolType *p, uint32_t size){
+  uint32_t i;
+  for(i = 0; i < p->numClasses; i++){
+    if(size <= p->classes[i].size){
+      return &p->classes[i];
+    }
+  }
+  return 0;
+}
+
+void *Pool_Alloc(poolType *p, uint32_t size){
+  poolClassType *c = classOf(p, size);
+  void *block;
+  long sr;
+  if(c == 0){
+    return 0;
+  }
+  sr = StartCritical();
+  block = c->free;
+  if(block){
+    c->free = *(void **)block;
+    c->used++;
+    if(c->used > c->peak){
+      c->peak = c->used;
+    }
+  }else{
+    c->fails++;
+  }
+  EndCritical(sr);
+  return block;
+}
+
+int Pool_Free(poolType *p, void *block){
+  poolClassType *c;
+  uint32_t *b = (uint32_t *)block;
+  uint32_t i;
+  long sr;
+  if(b == 0){
+    return 1;
+  }
+  for(i = 0; i < p->numClasses; i++){
+    c = &p->classes[i];
+    if((b >= c->base) && (b < c->end)){
+      if(((uint32_t)((uint8_t *)b - (uint8_t *)c->base))%c->size){
+        return 0; // inside a block, not its start
+      }
+      sr = StartCritical();
+#if POOL_CHECK
+      void *f;
+      for(f = c->free; f; f = *(void **)f){
+        if(f == b){
+          EndCritical(sr);
+          return 0; // freed twice
+        }
+      }
+#endif
+      *(void **)b = c->free;
+      c->free = b;
+      c->used--;
+      EndCritical(sr);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+uint32_t Pool_Available(poolType *p, uint32_t size){
+  poolClassType *c = classOf(p, size);
+  if(c == 0){
+    return 0;
+  }
+  return c->count - c->used;
+}
@@ -0,0 +1,87 @@
+//*****************************************************************************
+// pool.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Fixed-block memory pool, buffers borrowed and given back at run time so
+// stages and display modes share RAM instead of each owning a global.
+
+// The caller's arena is cut into classes of equal sized blocks, smallest
+// block size first. Each class keeps its free blocks in a linked list
+// threaded through the first word of each free block, so Pool_Alloc and
+// Pool_Free take the same few cycles however full the pool is, and a block
+// can never be split or fragmented. A request is served only from the
+// smallest class its size fits, never from a larger class, so one user
+// running out cannot take blocks another user depends on.
+// The list operations run with interrupts disabled, so threads and
+// interrupt handlers can both allocate and free.
+// With POOL_CHECK, Pool_Free walks the class's free list first and refuses
+// a block that is already on it, which would otherwise close the list into
+// a cycle and count the block out twice. The walk is as long as the free
+// list, a few blocks here.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __POOL_H
+#define __POOL_H  1
+
+#ifndef POOL_CHECK
+#define POOL_CHECK 1       // double free detection, 0 removes it and its cost
+#endif
+
+#define POOL_MAXCLASSES 4  // block sizes per pool
+
+// blocks of one size
+struct poolClass{
+  uint32_t size;           // block size in bytes, a multiple of 4
+  uint32_t count;          // blocks in the class
+  uint32_t *base;          // first block
+  uint32_t *end;           // just past the last block
+  void *free;              // first free block, 0 if all are in use
+  uint32_t used;           // blocks allocated now
+  uint32_t peak;           // most blocks allocated at once
+  uint32_t fails;          // requests refused because every block was in use
+};
+typedef struct poolClass poolClassType;
+
+struct pool{
+  uint32_t numClasses;
+  poolClassType classes[POOL_MAXCLASSES];
+};
+typedef struct pool poolType;
+
+// ******** Pool_Init ************
+// Cut an arena into classes of fixed size blocks, all free
+// Inputs:  pointer to pool
+//          pointer to the arena, word aligned
+//          arena size in 32-bit words
+//          block size in bytes of each class, increasing, rounded up to words,
+//          at least a pointer, which links the free blocks
+//          number of blocks in each class
+//          number of classes (1 to POOL_MAXCLASSES)
+// Outputs: 1 if successful, 0 if a size is too small or not increasing or the arena is too small
+int Pool_Init(poolType *p, uint32_t *arena, uint32_t words,
+              const uint32_t *sizes, const uint32_t *counts, uint32_t numClasses);
+
+// ******** Pool_Alloc ************
+// Borrow a block from the smallest class that fits, safe in an interrupt
+// Inputs:  pointer to pool
+//          bytes needed
+// Outputs: pointer to the block, word aligned and not cleared,
+//          0 if that class has no free block or no class is large enough
+void *Pool_Alloc(poolType *p, uint32_t size);
+
+// ******** Pool_Free ************
+// Give a block back to its class, safe in an interrupt
+// Inputs:  pointer to pool
+//          pointer returned by Pool_Alloc, 0 is ignored
+// Outputs: 1 if successful, 0 if the pointer is not the start of a block of this pool
+//          or, with POOL_CHECK, the block is already free
+int Pool_Free(poolType *p, void *block);
+
+// ******** Pool_Available ************
+// Free blocks in the class that would serve a request
+// Inputs:  pointer to pool
+//          bytes needed
+// Outputs: number of free blocks, 0 if no class is large enough
+uint32_t Pool_Available(poolType *p, uint32_t size);
+
+#endif
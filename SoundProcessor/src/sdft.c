@@ -0,0 +1,103 @@
+//*****************************************************************************
+// sdft.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Sliding DFT, updates a selected range of frequency bins every sample.
+// Costs one complex multiply per bin per sample, plus one more per bin
+// during the window that re-anchors the state.
+
+#include <stdint.h>
+#include "sdft.h"
+#include "arm_math.h"
+
+int SDFT_Init(sdftType *s, uint32_t firstBin, uint32_t numBins,
+              uint32_t length, uint32_t anchorFrames){
+  uint32_t i;
+  float32_t c, d, mag;
+  if((numBins == 0) || (numBins > SDFT_MAXBINS) || (firstBin == 0) ||
+     (firstBin + numBins > length/2) || (anchorFrames == 0)){
+    return 0;
+  }
+  s->firstBin = firstBin;
+  s->numBins = numBins;
+  s->length = length;
+  s->anchorFrames = anchorFrames;
+  for(i = 0; i < numBins; i++){
+    c = arm_cos_f32(2.0f*PI*(float32_t)(firstBin+i)/(float32_t)length);
+    d = arm_sin_f32(2.0f*PI*(float32_t)(firstBin+i)/(float32_t)length);
+    mag = sqrtf(c*c + d*d); // unit magnitude keeps the recursion from growing
+    s->coefRe[i] = c/mag;
+    s->coefIm[i] = d/mag;
+    s->re[i] = 0;
+    s->im[i] = 0;
+  }
+  s->n = 0;
+  s->frameCount = 0;
+  s->valid = 1;       // empty history and zero state agree
+  s->anchoring = 0;
+  return 1;
+}
+
+// start accumulating a direct DFT of the next window
+static void startAnchor(sdftType *s){
+  uint32_t i;
+  for(i = 0; i < s->numBins; i++){
+    s->anchorRe[i] = 0;
+    s->anchorIm[i] = 0;
+    s->rotRe[i] = 1.0f;
+    s->rotIm[i] = 0;
+  }
+  s->anchoring = 1;
+  s->frameCount = 0;
+}
+
+void SDFT_Update(sdftType *s, float32_t xNew, float32_t xOld){
+  uint32_t i;
+  float32_t tRe, tIm, delta = xNew - xOld;
+  for(i = 0; i < s->numBins; i++){
+    tRe = s->re[i] + delta;
+    tIm = s->im[i];
+    s->re[i] = tRe*s->coefRe[i] - tIm*s->coefIm[i];
+    s->im[i] = tRe*s->coefIm[i] + tIm*s->coefRe[i];
+  }
+  if(s->anchoring){
+    for(i = 0; i < s->numBins; i++){
+      s->anchorRe[i] += xNew*s->rotRe[i];
+      s->anchorIm[i] += xNew*s->rotIm[i];
+      // rotate by e^(-j2pik/N), the conjugate of the recursion coefficient
+      tRe = s->rotRe[i]*s->coefRe[i] + s->rotIm[i]*s->coefIm[i];
+      s->rotIm[i] = s->rotIm[i]*s->coefRe[i] - s->rotRe[i]*s->coefIm[i];
+      s->rotRe[i] = tRe;
+    }
+  }
+  s->n++;
+  if(s->n == s->length){ // window complete
+    s->n = 0;
+    s->frameCount++;
+    if(s->anchoring){
+      for(i = 0; i < s->numBins; i++){
+        s->re[i] = s->anchorRe[i];
+        s->im[i] = s->anchorIm[i];
+      }
+      s->anchoring = 0;
+      s->valid = 1;
+    }
+    if((s->valid == 0) || (s->frameCount >= s->anchorFrames)){
+      startAnchor(s);
+    }
+  }
+}
+
+void SDFT_Invalidate(sdftType *s){
+  s->valid = 0;
+  s->anchoring = 0; // history changed part way through, restart at next window
+}
+
+int SDFT_Magnitude(sdftType *s, float32_t *dB){
+  uint32_t i;
+  float32_t p;
+  for(i = 0; i < s->numBins; i++){
+    p = s->re[i]*s->re[i] + s->im[i]*s->im[i];
+    dB[i] = (p > 1e-12f) ? 10*log10f(p) : -120.0f; // never -inf
+  }
+  return s->valid;
+}
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// sdft.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Sliding DFT, updates a selected range of frequency bins every sample
+// so a narrow band can be watched without waiting for a full frame FFT.
+
+// X_k(n) = e^(j2pik/N) * (X_k(n-1) + x(n) - x(n-N))
+// The recursion accumulates rounding error, so every few windows a direct
+// DFT of the band is accumulated alongside it and replaces the recursive
+// state when the window completes (re-anchoring).
+// e^(j2pik/N) rounded to float32 is not exactly an N-th root of unity, so
+// without re-anchoring the error grows by about 4e-8 of the strongest bin
+// a sample; re-anchoring every 32 windows of 1024 holds it near -58 dB.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __SDFT_H
+#define __SDFT_H  1
+
+#define SDFT_MAXBINS 16    // maximum number of bins tracked
+
+struct sdft{
+  uint32_t firstBin;       // first bin index k tracked
+  uint32_t numBins;        // number of consecutive bins tracked
+  uint32_t length;         // window length N (same as frame FFT length)
+  uint32_t n;              // sample position in the current window, 0 to N-1
+  uint32_t anchorFrames;   // windows between re-anchors
+  uint32_t frameCount;     // windows since last re-anchor
+  int32_t anchoring;       // true while the direct DFT is being accumulated
+  int32_t valid;           // true once the state matches the true DFT
+  float32_t coefRe[SDFT_MAXBINS]; // e^(j2pik/N)
+  float32_t coefIm[SDFT_MAXBINS];
+  float32_t re[SDFT_MAXBINS];     // recursive state
+  float32_t im[SDFT_MAXBINS];
+  float32_t anchorRe[SDFT_MAXBINS]; // direct DFT accumulated for re-anchor
+  float32_t anchorIm[SDFT_MAXBINS];
+  float32_t rotRe[SDFT_MAXBINS];    // e^(-j2pikm/N) for sample m of window
+  float32_t rotIm[SDFT_MAXBINS];
+};
+typedef struct sdft sdftType;
+
+// ******** SDFT_Init ************
+// Initialize sliding DFT for bins firstBin to firstBin+numBins-1
+// Inputs:  pointer to sliding DFT
+//          first bin index (1 to N/2-1)
+//          number of bins (1 to SDFT_MAXBINS)
+//          window length N, must match the history buffer length
+//          number of windows between re-anchors (at least 1)
+// Outputs: 1 if successful, 0 if the bin range is not valid
+int SDFT_Init(sdftType *s, uint32_t firstBin, uint32_t numBins,
+              uint32_t length, uint32_t anchorFrames);
+
+// ******** SDFT_Update ************
+// Add one sample to the sliding window, called every sample
+// Inputs:  pointer to sliding DFT
+//          newest sample x(n)
+//          sample leaving the window x(n-N)
+// Outputs: none
+void SDFT_Update(sdftType *s, float32_t xNew, float32_t xOld);
+
+// ******** SDFT_Invalidate ************
+// Mark the state as not valid, forcing a re-anchor on the next window
+// Call when the sample history used for x(n-N) has been overwritten
+// Inputs:  pointer to sliding DFT
+// Outputs: none
+void SDFT_Invalidate(sdftType *s);
+
+// ******** SDFT_Magnitude ************
+// Convert the tracked bins to decibels, same units as magnitudeArr
+// Inputs:  pointer to sliding DFT
+//          pointer to numBins outputs, element i is bin firstBin+i
+// Outputs: 1 if the values are valid, 0 if still waiting for a re-anchor
+int SDFT_Magnitude(sdftType *s, float32_t *dB);
+
+#endif
@@ -0,0 +1,67 @@
+//*****************************************************************************
+// spectral.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Spectral descriptors: centroid, spread, flatness, roll-off and flux.
+// One log10 per bin, shared by the dB output, flatness and flux.
+
+#include <stdint.h>
+#include "spectral.h"
+#include "arm_math.h"
+
+void Spectral_Init(spectralType *d, float32_t binHz){
+  d->binHz = binHz;
+  d->centroid = 0;
+  d->spread = 0;
+  d->flatness = 0;
+  d->rolloff = 0;
+  d->flux = 0;
+  d->first = 1;
+}
+
+void Spectral_Compute(spectralType *d, const float32_t *power, float32_t *dB,
+                      uint32_t numBins){
+  uint32_t k;
+  float32_t p, f, level, rise;
+  float32_t sumP = 0, sumFP = 0, sumFFP = 0, sumDb = 0, sumRise = 0;
+  float32_t mean, var, tail;
+  for(k = 1; k < numBins; k++){
+    p = power[k];
+    f = (float32_t)k;               // in bins, scaled to Hz at the end
+    level = (p < SPECTRAL_ZEROPOWER) ? SPECTRAL_ZERODB : 10*log10f(p); // silence or a notched bin
+    rise = level - dB[k-1];
+    if(rise > 0){
+      sumRise += rise;
+    }
+    dB[k-1] = level;
+    if(level < SPECTRAL_MINDB){
+      level = SPECTRAL_MINDB;
+    }
+    sumDb += level;
+    sumP += p;
+    sumFP += f*p;
+    sumFFP += f*f*p;
+  }
+  if(sumP <= 0){
+    d->centroid = d->spread = d->flatness = d->rolloff = 0;
+  }else{
+    mean = sumFP/sumP;
+    var = sumFFP/sumP - mean*mean;
+    d->centroid = mean*d->binHz;
+    d->spread = (var > 0) ? sqrtf(var)*d->binHz : 0;
+    // geometric mean from the average dB, arithmetic mean from the power sum
+    d->flatness = powf(10.0f, sumDb/(10.0f*(float32_t)(numBins-1)))/
+                  (sumP/(float32_t)(numBins-1));
+    // roll-off, walk down from the top until the remaining tail is reached,
+    // this only visits the bins above the roll-off frequency
+    tail = (1.0f - SPECTRAL_ROLLOFF)*sumP;
+    k = numBins - 1;
+    p = 0;
+    while((k > 1) && (p + power[k] < tail)){
+      p += power[k];
+      k--;
+    }
+    d->rolloff = (float32_t)k*d->binHz;
+  }
+  d->flux = d->first ? 0 : sumRise/(float32_t)(numBins-1);
+  d->first = 0;
+}
@@ -0,0 +1,53 @@
+//*****************************************************************************
+// spectral.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Spectral descriptors: centroid, spread, flatness, roll-off and flux,
+// computed in one pass over the power spectrum left by call_FFT().
+
+// The same pass converts each bin to decibels and writes it over the
+// previous frame's value in the dB array (magnitudeArr), so flux needs no
+// buffer of its own. A bin with no power (digital silence, or a bin the
+// notch removed) is written as SPECTRAL_ZERODB, so the flux, the noise
+// floor, the plot and the cepstrum never see -inf.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __SPECTRAL_H
+#define __SPECTRAL_H  1
+
+#define SPECTRAL_ROLLOFF 0.85f   // fraction of power below the roll-off frequency
+#define SPECTRAL_MINDB  -100.0f  // floor for empty bins in the flatness sum
+#define SPECTRAL_ZEROPOWER 1e-12f // power below this is written as SPECTRAL_ZERODB
+#define SPECTRAL_ZERODB -120.0f  // level of a bin with no power, never -inf
+
+struct spectral{
+  float32_t binHz;       // width of one bin in Hz
+  float32_t centroid;    // power weighted mean frequency in Hz
+  float32_t spread;      // power weighted standard deviation about the centroid in Hz
+  float32_t flatness;    // geometric over arithmetic mean power, 0 (tonal) to 1 (white)
+  float32_t rolloff;     // frequency in Hz below which SPECTRAL_ROLLOFF of the power lies
+  float32_t flux;        // mean rise in dB per bin since the previous frame
+  int32_t first;         // true until a previous frame exists for flux
+};
+typedef struct spectral spectralType;
+
+// ******** Spectral_Init ************
+// Initialize spectral descriptors
+// Inputs:  pointer to descriptors
+//          width of one FFT bin in Hz
+// Outputs: none
+void Spectral_Init(spectralType *d, float32_t binHz);
+
+// ******** Spectral_Compute ************
+// Descriptors of one frame, fused with the conversion to decibels
+// Bin 0 (DC) is excluded
+// Inputs:  pointer to descriptors
+//          power spectrum, element k is the power of bin k, k = 0 to numBins-1
+//          dB array, element k-1 holds the previous frame's bin k on entry
+//          and this frame's on return
+//          number of bins
+// Outputs: none
+void Spectral_Compute(spectralType *d, const float32_t *power, float32_t *dB,
+                      uint32_t numBins);
+
+#endif
@@ -0,0 +1,117 @@
+//*****************************************************************************
+// thd.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// THD, THD+N and SINAD from a flat-top windowed power spectrum.
+
+#include <stdint.h>
+#include "thd.h"
+#include "arm_math.h"
+
+// flat-top window coefficients, a0 is also the coherent gain
+#define A0 0.21557895f
+#define A1 0.41663158f
+#define A2 0.277263158f
+#define A3 0.083578947f
+#define A4 0.006947368f
+
+void Thd_Init(thdType *t, float32_t binHz, uint32_t length, float32_t bandHz){
+  uint32_t h;
+  t->binHz = binHz;
+  t->length = length;
+  t->bandHz = bandHz;
+  t->valid = 0;
+  t->f0 = 0;
+  t->amplitude = 0;
+  t->thd = 0;
+  t->thdn = 0;
+  t->sinad = 0;
+  for(h = 0; h <= THD_HARMONICS; h++){
+    t->harmonic[h] = THD_MINDB;
+  }
+}
+
+void Thd_Window(thdType *t, float32_t *x){
+  float32_t c1, c2, c3, c4;
+  uint32_t n;
+  for(n = 0; n < t->length; n++){
+    c1 = arm_cos_f32(2.0f*PI*(float32_t)n/(float32_t)t->length);
+    c2 = 2*c1*c1 - 1;     // cos(2x), cos(3x), cos(4x) by the Chebyshev recurrence
+    c3 = 2*c1*c2 - c1;
+    c4 = 2*c1*c3 - c2;
+    x[n] = x[n]*(A0 - A1*c1 + A2*c2 - A3*c3 + A4*c4);
+  }
+}
+
+// power summed over bins first to last
+static float32_t lobe(const float32_t *power, uint32_t first, uint32_t last){
+  float32_t sum = 0;
+  uint32_t k;
+  for(k = first; k <= last; k++){
+    sum += power[k];
+  }
+  return sum;
+}
+
+int Thd_Measure(thdType *t, const float32_t *power, uint32_t numBins){
+  uint32_t band, k, peak, hw, h, center;
+  float32_t fund, harm, sum, moment, p, rest, f0;
+  band = (uint32_t)(t->bandHz/t->binHz);
+  if(band > numBins - 1 - THD_HALFWIDTH){
+    band = numBins - 1 - THD_HALFWIDTH;
+  }
+  t->valid = 0;
+  // fundamental, the largest bin clear of DC
+  peak = THD_HALFWIDTH + 1;
+  for(k = THD_HALFWIDTH + 1; k <= band; k++){
+    if(power[k] > power[peak]){
+      peak = k;
+    }
+  }
+  sum = 0;
+  moment = 0;
+  for(k = peak - THD_HALFWIDTH; k <= peak + THD_HALFWIDTH; k++){
+    sum += power[k];
+    moment += (float32_t)k*power[k];
+  }
+  if(sum <= 0){
+    return 0;  // silence
+  }
+  f0 = moment/sum;   // in bins
+  hw = (uint32_t)(f0/2);  // neighbouring harmonic lobes share at most one bin
+  if(hw > THD_HALFWIDTH){
+    hw = THD_HALFWIDTH;
+  }
+  if(hw < THD_MINHALFWIDTH){
+    return 0;
+  }
+  t->f0 = f0*t->binHz;
+  t->amplitude = 2*sqrtf(power[peak])/(A0*(float32_t)t->length);
+  fund = lobe(power, peak - hw, peak + hw);
+  harm = 0;
+  for(h = 2; h <= THD_HARMONICS; h++){
+    center = (uint32_t)(h*f0 + 0.5f);
+    if(center + hw > band){
+      t->harmonic[h] = THD_MINDB;
+      continue;
+    }
+    // a low second harmonic's lobe may reach the fundamental's, that bin is left to the fundamental
+    p = lobe(power, (center - hw > peak + hw) ? center - hw : peak + hw + 1, center + hw);
+    harm += p;
+    t->harmonic[h] = 10*log10f(p/fund + 1e-12f);
+    if(t->harmonic[h] < THD_MINDB){
+      t->harmonic[h] = THD_MINDB;
+    }
+  }
+  // residual summed directly, band power minus fundamental loses it to rounding
+  rest = 0;
+  for(k = THD_HALFWIDTH + 1; k <= band; k++){
+    if((k + hw < peak) || (k > peak + hw)){
+      rest += power[k];
+    }
+  }
+  t->thd = 100*sqrtf(harm/fund);
+  t->thdn = 100*sqrtf(rest/fund);
+  t->sinad = 10*log10f((rest + fund)/(rest + 1e-12f*fund));
+  t->valid = 1;
+  return 1;
+}
@@ -0,0 +1,71 @@
+//*****************************************************************************
+// thd.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Harmonic distortion measurement of a test tone: THD, THD+N, SINAD and the
+// level of harmonics 2 to THD_HARMONICS.
+
+// The frame is weighted by a five term flat-top window before the FFT, so
+// the peak bin gives the tone amplitude to within about 0.01 dB wherever it
+// falls between bins, and leakage is below -90 dB outside THD_HALFWIDTH bins.
+// The fundamental is the largest bin in the band, refined by the power
+// weighted centroid of its main lobe. Power is then summed over the main
+// lobe of the fundamental and of each harmonic, and over the whole band
+// (DC excluded); the residual after the fundamental is noise plus distortion.
+//   THD   = sqrt(harmonic power/fundamental power)
+//   THD+N = sqrt((band power - fundamental power)/fundamental power)
+//   SINAD = 10 log10(band power/(band power - fundamental power))
+// The lobe half width shrinks for low tones so harmonic lobes do not overlap
+// by more than a bin; tones below 2*THD_MINHALFWIDTH bins (500 Hz at
+// 64 kHz and 1024 points) are reported as not valid. With the full
+// THD_HALFWIDTH the residual floor is about -80 dB, at THD_MINHALFWIDTH
+// about -60 dB.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __THD_H
+#define __THD_H  1
+
+#define THD_HARMONICS    10       // highest harmonic measured
+#define THD_HALFWIDTH    5        // bins either side of a harmonic summed, the flat-top main lobe
+#define THD_MINHALFWIDTH 4        // narrowest usable main lobe in bins, -60 dB floor
+#define THD_MINDB       -120.0f   // level reported for harmonics outside the band
+
+struct thd{
+  float32_t binHz;       // width of one bin in Hz
+  uint32_t length;       // frame length, samples
+  float32_t bandHz;      // measurement bandwidth in Hz
+  int32_t valid;         // true if the latest frame had a usable tone
+  float32_t f0;          // fundamental frequency in Hz
+  float32_t amplitude;   // fundamental peak amplitude, same units as the samples
+  float32_t thd;         // total harmonic distortion in percent
+  float32_t thdn;        // total harmonic distortion plus noise in percent
+  float32_t sinad;       // signal to noise and distortion in dB
+  float32_t harmonic[THD_HARMONICS + 1]; // harmonic h in dB below the fundamental, h = 2 to THD_HARMONICS
+};
+typedef struct thd thdType;
+
+// ******** Thd_Init ************
+// Initialize distortion measurement
+// Inputs:  pointer to measurement
+//          width of one FFT bin in Hz
+//          frame length, samples
+//          measurement bandwidth in Hz, harmonics and noise above it are ignored
+// Outputs: none
+void Thd_Init(thdType *t, float32_t binHz, uint32_t length, float32_t bandHz);
+
+// ******** Thd_Window ************
+// Apply the flat-top window in place, before the FFT
+// Inputs:  pointer to measurement
+//          frame of length samples
+// Outputs: none
+void Thd_Window(thdType *t, float32_t *x);
+
+// ******** Thd_Measure ************
+// Measure distortion from the power spectrum of a windowed frame
+// Inputs:  pointer to measurement
+//          power spectrum, element k is the power of bin k
+//          number of bins
+// Outputs: 1 if a tone was measured, 0 if not
+int Thd_Measure(thdType *t, const float32_t *power, uint32_t numBins);
+
+#endif
@@ -0,0 +1,106 @@
+//*****************************************************************************
+// trace.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Event trace recorder with a polled UART0 dump.
+
+#include <stdint.h>
+#include "trace.h"
+#include "../inc/CortexM.h"
+#include "../inc/BSP.h"
+#ifdef HOST
+#include "../host/host.h"
+#else
+#include "../inc/tm4c123gh6pm.h"
+#endif
+
+traceType Trace;
+
+void Trace_Start(void){
+  long sr = StartCritical();
+  Trace.count = 0;
+  Trace.on = 1;
+  EndCritical(sr);
+}
+
+void Trace_Stop(void){
+  Trace.on = 0;
+}
+
+void Trace_Record(uint32_t type, uint32_t id, uint32_t arg){
+  traceRecordType *r;
+  long sr = StartCritical();
+  if(Trace.on){
+    r = &Trace.ring[Trace.count%TRACE_SIZE];
+    r->stamp = DWT_CYCCNT;
+    r->type = (uint8_t)type;
+    r->id = (uint8_t)id;
+    r->arg = (uint16_t)arg;
+    Trace.count++;
+  }
+  EndCritical(sr);
+}
+
+#ifdef HOST
+// host build, the dump is appended to the file given to the simulation
+static void uartInit(void){
+}
+
+static void uartOut(uint32_t byte){
+  Host_UartOut(byte);
+}
+#else
+// UART0 on PA1-0, 8 bit, no parity, one stop bit, FIFOs on
+static void uartInit(void){
+  uint32_t divider = (8*BSP_Clock_GetFreq()/TRACE_BAUD + 1)/2; // in 64ths, clock/(16*baud) rounded
+  SYSCTL_RCGCUART_R |= 0x00000001; // 1) activate clock for UART0
+  SYSCTL_RCGCGPIO_R |= 0x00000001; //    and Port A
+  while((SYSCTL_PRUART_R&0x01) == 0){};
+  while((SYSCTL_PRGPIO_R&0x01) == 0){};
+  UART0_CTL_R &= ~UART_CTL_UARTEN; // 2) disable UART0 while it is set up
+  UART0_IBRD_R = divider>>6;       // 3) integer and fractional baud rate divisors
+  UART0_FBRD_R = divider&0x3F;
+  UART0_LCRH_R = UART_LCRH_WLEN_8|UART_LCRH_FEN;
+  UART0_CTL_R |= UART_CTL_UARTEN;
+  GPIO_PORTA_AMSEL_R &= ~0x03;     // 4) disable analog on PA1-0
+  GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R&0xFFFFFF00)+0x00000011; // 5) U0Rx, U0Tx
+  GPIO_PORTA_AFSEL_R |= 0x03;      // 6) enable alt funct on PA1-0
+  GPIO_PORTA_DEN_R |= 0x03;        // 7) enable digital I/O on PA1-0
+}
+
+static void uartOut(uint32_t byte){
+  while(UART0_FR_R&UART_FR_TXFF){};
+  UART0_DR_R = byte;
+}
+#endif
+
+static void uartOut32(uint32_t word){
+  uartOut(word&0xFF);
+  uartOut((word>>8)&0xFF);
+  uartOut((word>>16)&0xFF);
+  uartOut(word>>24);
+}
+
+uint32_t Trace_Dump(void){
+  static int32_t uartReady = 0;
+  traceRecordType *r;
+  uint32_t i, first, n;
+  Trace_Stop();
+  if(uartReady == 0){
+    uartInit();
+    uartReady = 1;
+  }
+  n = (Trace.count < TRACE_SIZE) ? Trace.count : TRACE_SIZE;
+  first = Trace.count - n;
+  uartOut32(TRACE_MAGIC);
+  uartOut32(BSP_Clock_GetFreq());
+  uartOut32(n);
+  for(i = 0; i < n; i++){
+    r = &Trace.ring[(first + i)%TRACE_SIZE];
+    uartOut32(r->stamp);
+    uartOut(r->type);
+    uartOut(r->id);
+    uartOut(r->arg&0xFF);
+    uartOut(r->arg>>8);
+  }
+  return n;
+}
@@ -0,0 +1,96 @@
+//*****************************************************************************
+// trace.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Event trace recorder, timestamped scheduler, handler, semaphore and frame
+// events in a RAM ring, dumped over UART0 for tools/trace2json.c.
+
+// Each event is one 8 byte record, the DWT_CYCCNT cycle count, a type, an
+// id and a 16 bit argument, written inside StartCritical/EndCritical, about
+// 30 cycles in all. The ring keeps the latest TRACE_SIZE events; once
+// stopped, for example when a deadline is missed, it keeps the events that
+// led up to it until Trace_Start.
+// The dump goes out of UART0, the LaunchPad's virtual COM port, at
+// TRACE_BAUD 8N1 by polling, so it holds up the calling thread for about
+// 10*8*TRACE_SIZE/TRACE_BAUD seconds. It is
+//   "TRC1", clock in Hz, number of records, all little endian 32 bit words,
+//   then the records, oldest first, each
+//   stamp (32 bit), type (8 bit), id (8 bit), arg (16 bit)
+// Compile with OS_TRACE 0 to remove the TRACE calls and their overhead.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __TRACE_H
+#define __TRACE_H  1
+
+#ifndef OS_TRACE
+#define OS_TRACE 1   // trace recording, 0 removes every TRACE call
+#endif
+
+#define TRACE_SIZE  128      // records kept, a power of 2
+#define TRACE_BAUD  115200   // UART0 bit rate of the dump
+#define TRACE_MAGIC 0x31435254 // "TRC1"
+#define TRACE_IDLE  255      // id of the idle thread in TRACE_SWITCH
+
+// event types, id and arg in brackets
+enum TraceType{
+  TRACE_TICK = 1,      // SysTick handler entered (0, 1 for a tick, 0 for OS_Suspend)
+  TRACE_SWITCH,        // SysTick handler left (thread switched in, 0)
+  TRACE_EVENT_ENTER,   // periodic event thread started (event index, 0)
+  TRACE_EVENT_EXIT,    // periodic event thread returned (event index, 0)
+  TRACE_WAIT,          // thread blocked on a semaphore (thread, semaphore address)
+  TRACE_SIGNAL,        // semaphore signalled (0, semaphore address)
+  TRACE_FLAGS_WAIT,    // thread blocked on event flags (thread, bits waited for)
+  TRACE_FLAGS_SET,     // event flags set (0, bits set)
+  TRACE_FRAME_START,   // stage started on a frame (stage, frame number)
+  TRACE_FRAME_END,     // stage finished a frame (stage, frame number)
+  TRACE_MARK           // anything else (user id, user value)
+};
+
+struct traceRecord{
+  uint32_t stamp;      // DWT_CYCCNT
+  uint8_t type;        // enum TraceType
+  uint8_t id;
+  uint16_t arg;
+};
+typedef struct traceRecord traceRecordType;
+
+struct trace{
+  traceRecordType ring[TRACE_SIZE];
+  uint32_t count;      // records written since Trace_Start, the next goes to count%TRACE_SIZE
+  int32_t on;          // true while recording
+};
+typedef struct trace traceType;
+
+extern traceType Trace;
+
+#if OS_TRACE
+#define TRACE(type, id, arg) Trace_Record((type), (id), (arg))
+#else
+#define TRACE(type, id, arg)
+#endif
+
+// ******** Trace_Start ************
+// Empty the ring and start recording
+// Inputs:  none
+// Outputs: none
+void Trace_Start(void);
+
+// ******** Trace_Stop ************
+// Stop recording, the ring keeps the latest events
+// Inputs:  none
+// Outputs: none
+void Trace_Stop(void);
+
+// ******** Trace_Record ************
+// Add one event, safe in handlers, use the TRACE macro
+// Inputs:  event type, id and argument, see enum TraceType
+// Outputs: none
+void Trace_Record(uint32_t type, uint32_t id, uint32_t arg);
+
+// ******** Trace_Dump ************
+// Stop recording and send the ring out of UART0, from a foreground thread
+// Inputs:  none
+// Outputs: number of records sent
+uint32_t Trace_Dump(void);
+
+#endif
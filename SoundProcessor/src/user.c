@@ -10,33 +10,95 @@
 // Project was built on RTOS_4C123 template written and copyrighted by Daniel Valvano, February 2016
 // Copyright 2016 by Jonathan W. Valvano, valvano@mail.utexas.edu
 // This program does currently make use of Valvano's BSP.C and other assembly configurations.
-// RTOS functions and mechanism from template currently not used in this program.
+// The RTOS runs a three stage pipeline: a periodic event thread acquires
+// samples and hands each complete frame to the analysis thread through the
+// mailbox, and the analysis thread hands each finished plot to the display
+// thread, so drawing on the LCD never holds up the analysis.
 
 
 #include <stdlib.h>
 #include <stdint.h>
 #include "os.h"
 #include "../inc/BSP.h"
-#include "../inc/profile.h"
+#include "../inc/Profile.h"
 #include "arm_math.h"
+#include "sdft.h"
+#include "zoomfft.h"
+#include "mfcc.h"
+#include "classify.h"
+#include "spectral.h"
+#include "onset.h"
+#include "vad.h"
+#include "noisefloor.h"
+#include "notch.h"
+#include "filter.h"
+#include "peaks.h"
+#include "thd.h"
+#include "yin.h"
+#include "cepstrum.h"
+#include "cqt.h"
+#include "pool.h"
+#include "trace.h"
+#include "../inc/CortexM.h"
 
 //******** GLOBAL VARIABLES AND VALUES ********\\
 
 #define THREADFREQ 500   // frequency in Hz
+#define ACQCHUNK 128      // samples taken by the acquisition thread every tick
 #define MAGNUM 512   // number of magnitude values
 #define PLOTMAX 80
 #define PLOTMIN 0
+#define SAMPLERATE (ACQCHUNK*THREADFREQ) // microphone sampling rate in Hz, set by a timer, divides the bus clock
 #define SAMPLELENGTH 1024 // number of samples to collect before calculating RMS (may overflow if greater than 4104)
-#define FILTERSIZE 512
+#define SDFTFIRSTBIN 8    // first bin of the band updated every sample
+#define SDFTNUMBINS 16    // number of bins in the band (max SDFT_MAXBINS)
+#define SDFTANCHOR 32     // windows between sliding DFT re-anchors, about half a second
+#define BANDCOLUMNS (100/SDFTNUMBINS) // plot columns per band bin in BAND mode
+#define ZOOMCENTER 400    // zoom FFT centre frequency in Hz
+#define ZOOMSPAN 256      // zoom FFT span in Hz
+#define ZOOMLENGTH 256    // zoom FFT length, resolution is ZOOMSPAN/ZOOMLENGTH
+#define MFCCLOW 100       // lowest mel filter edge in Hz
+#define MFCCHIGH 16000    // highest mel filter edge in Hz
+#define ONSETPOST 768     // samples captured after an onset, the rest of the capture is before it
+#define ONSETHOLDOFF 4096 // minimum samples between onsets
+#define NOTCHHARMONICS 5  // mains hum harmonics removed, including the fundamental
+#define THDBAND 20000     // distortion measurement bandwidth in Hz
+#define CEPSMAXSPACING 20000 // highest harmonic or sideband spacing looked for in Hz
+#define CEPSPLOT 100      // cepstrum points plotted, one per plot column
+#define CEPSSCALE 20      // plot units per dB unit of cepstrum
+#define DSPDEADLINE (SAMPLELENGTH/ACQCHUNK) // ticks to analyse a frame, the time to acquire one
+#define LCDDEADLINE 50    // ticks to draw a plot
+#define CTLDEADLINE (SAMPLELENGTH/ACQCHUNK) // ticks for the control thread's work on a frame
+#define WATCHDOGTIME 1    // seconds without the analysis and control threads finishing a frame before a reset
+#define FRAMEBLOCKS 3     // frame buffers in the pool, a capture, the frame being analysed and its work block
+#define FRAMEBYTES (SAMPLELENGTH*sizeof(float32_t))
+#define SPECBYTES (MAGNUM*sizeof(float32_t))
+#define ZOOMBYTES (2*ZOOMLENGTH*sizeof(float32_t)) // at most SPECBYTES, the two share a block
+#define POOLWORDS ((SPECBYTES + FRAMEBLOCKS*FRAMEBYTES)/4)
 
 //---------------- Global variables shared between tasks ----------------
-uint32_t Time;              // elasped time in ?100? ms units
-uint32_t mag[MAGNUM];	// array to hold all calculated magnitude values
-int32_t dBArray[MAGNUM];
-float32_t magnitudeArr[MAGNUM];
-int16_t SoundArray[SAMPLELENGTH];
-float32_t SoundBufferIn[SAMPLELENGTH];
-float32_t SoundBufferOut[SAMPLELENGTH];
+uint32_t Time;              // elapsed time in ticks, 1/THREADFREQ s
+// Buffer lifetimes and aliasing over one pass of the analysis
+//   SoundBufferIn   samples of the frame until the rfft destroys them, then
+//                   scratch for the CQT levels, the cepstrum and Yin
+//   SoundBufferOut  rfft output, packed in place into the power of bin k at
+//                   [k], k < MAGNUM, the upper half is then free; scratch for
+//                   the cepstrum and Yin, so every reader of the power
+//                   spectrum (MFCC, THD) runs before call_Cepstrum
+//   magnitudeArr    dB of each bin from Spectral_Compute until the next frame,
+//                   the only spectrum kept from one frame to the next (flux)
+//   dBArray         plot points, the back plot until publish() swaps it
+// In ZOOM mode SoundBufferOut is not borrowed, the zoom levels go to the
+// spent SoundBufferIn and the block of magnitudeArr is the zoom FFT buffer.
+float32_t *magnitudeArr; // dB spectrum, a SPECBYTES block of Pool outside ZOOM mode
+float32_t *SoundBufferIn; // frame being analysed, a block borrowed from Pool by the acquisition
+float32_t *SoundBufferOut; // analysis work block from Pool, after call_FFT element k < MAGNUM is the power of bin k
+poolType Pool;         // buffers lent to the stages and display modes that need them
+uint32_t PoolArena[POOLWORDS];
+const uint32_t PoolSizes[2] = {SPECBYTES, FRAMEBYTES};
+const uint32_t PoolCounts[2] = {1, FRAMEBLOCKS};
+float32_t *Capture;    // frame block being filled by the acquisition, 0 if none could be borrowed
+float32_t *Captured;   // frame block sent with the latest mailbox entry, 0 once the analysis took it
 uint16_t SoundData;         // raw data sampled from the microphone
 int32_t dBAvg;
 int32_t rawAvg;
@@ -44,15 +106,99 @@ int32_t freqDb;
 uint32_t rawRMS;
 uint32_t avgFreq;
 uint32_t bin;
-int32_t NewData;  // true when new numbers to display on top of LCD
+int32_t NewData;  // semaphore, signalled when a new plot is ready for the display
 int32_t LCDmutex ; // exclusive access to LCD
 //// testing rfft function
 arm_rfft_fast_instance_f32 fft_inst; // rfft fast instance structure
 float32_t maxVal;
 uint32_t maxInd;
+sdftType Sdft;         // sliding DFT over the band of interest
+float32_t bandArr[SDFTNUMBINS]; // dB of bins SDFTFIRSTBIN.., same units as magnitudeArr
+int32_t bandValid;     // true if bandArr matches the true DFT, false until a re-anchor
+zoomfftType Zoom;      // band-selective high resolution analysis
+mfccType Mfcc;         // MFCC features of the latest frame
+uint32_t mfccCycles;   // WORK_CYCCNT cycles spent in MFCC_Compute for the latest frame
+classifyType Classifier; // sound event classifier on the MFCCs
+int32_t classifierReady; // true if a trained model is linked in
+uint32_t eventClass;   // most likely event class of the latest frame
+uint32_t classifyCycles; // WORK_CYCCNT cycles spent in Classify_Run for the latest frame
+spectralType Spectral; // centroid, spread, flatness, roll-off and flux of the latest frame
+onsetType Onset;       // transient detector and pre-trigger capture
+uint32_t onsetPeak;    // peak deviation from DC of the latest captured transient
+vadType Vad;           // activity detector gating the analysis and display
+uint32_t vadDuty;      // percent of frames found active
+uint64_t activeCycles; // WORK_CYCCNT cycles spent in analysis, a power proxy
+uint32_t skippedPasses; // passes where the analysis was skipped
+uint64_t analysedCycles; // WORK_CYCCNT cycles of the passes that were not skipped
+uint32_t analysedPasses; // passes that were not skipped
+noisefloorType Noise;  // background noise level per bin
+float32_t snrAll;      // overall signal to noise ratio of the latest frame in dB
+notchType Notch;       // adaptive mains hum removal ahead of the spectral analysis
+filterChainType Chain; // filter chain applied to each frame ahead of the FFT
+int32_t filterReady;   // true if the chain was built and matches its design
+float32_t filterErrordB; // largest difference from the designed response in dB
+peaksType Peaks;       // strongest spectral peaks tracked from frame to frame
+uint32_t numTones;     // stable tracks in the latest frame
+float32_t toneFreq[PEAKS_MAXTRACKS]; // stable track frequencies in Hz, strongest first
+float32_t toneAmp[PEAKS_MAXTRACKS];  // stable track levels in dB
+thdType Thd;           // distortion of a test tone, measured in THD mode
+yinType Yin;           // pitch of voiced and tonal sounds
+uint32_t yinCycles;    // WORK_CYCCNT cycles spent in Yin_Compute for the latest frame
+cepstrumType Ceps;     // echo delays and harmonic or sideband spacings of the latest frame
+cqtType Cqt;           // constant-Q levels, computed in CQT mode
+int32_t cqtReady;      // true if the linked kernels match the frame
+uint32_t cqtCycles;    // cycles spent in Cqt_Compute for the latest frame
+int32_t watchdogReset; // true if the watchdog restarted the program, a thread stopped finishing frames
 
+// display modes, Button1 selects the next one
+enum DisplayMode{
+  SPECTRUM,     // full frame FFT
+  ZOOM,         // zoom FFT around ZOOMCENTER
+  DESCRIPTORS,  // spectral descriptors as text
+  SNR,          // signal to noise ratio per bin
+  THD,          // harmonic distortion of a test tone as text
+  CEPSTRUM,     // liftered cepstrum over quefrency
+  CQT,          // constant-Q levels over log frequency
+  BAND,         // sliding DFT band over frequency
+  STATS,        // CPU load, stacks and frame rates as text
+  NUMMODES
+};
+enum DisplayMode Mode;
+uint32_t plotLength;   // number of points in dBArray to plot
 
-int32_t h[FILTERSIZE]; // coefficient (imaginary part) after discrete fourier transform
+// one plot, the analysis fills one while the display draws the other
+struct plot{
+	int8_t dB[MAGNUM];   // points to plot, from plotPoint
+	uint32_t length;     // number of points
+	int32_t dBAvg;       // values printed on top
+	uint32_t freq;
+	uint32_t bin;
+	uint32_t stamp;      // DWT_CYCCNT when the frame was acquired
+};
+typedef struct plot plotType;
+plotType Plots[2];
+plotType *Back = &Plots[0];  // being filled by the analysis
+plotType *Front = &Plots[1]; // being drawn by the display
+int8_t *dBArray = Plots[0].dB; // plot points of the frame being analysed
+int32_t plotFree;      // true while the display is waiting for a plot
+uint32_t ControlFlags;  // event flags that wake the control thread
+#define FLAG_FRAME 0x01  // a frame has been acquired
+#define FLAG_ONSET 0x02  // a transient has been captured
+
+// per stage counters, times in DWT_CYCCNT cycles
+struct stage{
+	uint32_t frames;     // frames completed
+	uint32_t dropped;    // frames lost because the next stage was still busy
+	uint32_t rate;       // frames completed in the latest second
+	uint32_t cycles;     // time spent on the latest frame
+	uint32_t latency;    // end of acquisition to the end of this stage, latest frame
+	uint32_t maxLatency;
+	uint32_t last;       // frames at the start of the current second
+};
+typedef struct stage stageType;
+stageType AcqStats;    // acquisition, dropped frames found no free block or a frame still waiting
+stageType DspStats;    // analysis
+stageType LcdStats;    // display, dropped plots were finished while the display was busy
 
 int timeTest;
 
@@ -73,6 +219,18 @@ void drawaxes(void){
 	return;
 }
 
+// Plot point of a level, saturated to the int8 range, which is wider than
+// the axes, so points off the plot are still drawn at its edge
+int8_t plotPoint(float32_t v){
+	if(v > 127){
+		return 127;
+	}
+	if(v < -128){
+		return -128;
+	}
+	return (int8_t)v;
+}
+
 float32_t imaginary_abs(float32_t real, float32_t imag) {
 	return sqrtf(real*real+imag*imag);
 }
@@ -85,6 +243,9 @@ float32_t imaginary_abs(float32_t real, float32_t imag) {
 uint32_t sqrt32(uint32_t s){
 uint32_t t;   // t*t will become s
 int n;             // loop counter
+  if(s == 0){
+    return 0;      // the first step would leave t at 0 and divide by it
+  }
   t = s/16+1;      // initial guess
   for(n = 16; n; --n){ // will finish
     t = ((t*t+s)/t)/2;
@@ -94,36 +255,166 @@ int n;             // loop counter
 
 //******** PROCESSING FUNCTIONS ********\\
 
+// Packs the rfft output in place into the power of bin k at [k], k < MAGNUM
+void packPower(float32_t *spec){
+	spec[0] = spec[0]*spec[0]; // DC power, Nyquist term at [1] is dropped
+	for(int i = 2; i < SAMPLELENGTH; i+=2){
+		// power of bin i/2, packed in place behind the values still to be read
+		spec[i/2] = spec[i]*spec[i] + spec[i+1]*spec[i+1];
+	}
+}
+
+// Background frame the VAD skipped: only the filtered dB spectrum, so the
+// noise floor and the flatness the VAD tests keep following the background
+void call_Background(void){
+	if(filterReady){
+		Filter_Run(&Chain, SoundBufferIn, SAMPLELENGTH);
+	}
+	arm_rfft_fast_f32(&fft_inst, SoundBufferIn, SoundBufferOut, 0);
+	packPower(SoundBufferOut);
+	Spectral_Compute(&Spectral, SoundBufferOut, magnitudeArr, MAGNUM);
+	snrAll = Noise_Update(&Noise, magnitudeArr);
+	Vad_SetFlatness(&Vad, Spectral.flatness);
+}
+
 // Calls FFT function, calculates magnitude and sound frequency
 void call_FFT(void){
 	static int32_t dBsum = 0;	
+	if(filterReady){
+		Filter_Run(&Chain, SoundBufferIn, SAMPLELENGTH);
+	}
+	if(Mode == THD){ // flat-top for amplitude accuracy, the other modes keep the resolution
+		Thd_Window(&Thd, SoundBufferIn);
+	}
 	// call function to process fft
 	arm_rfft_fast_f32(&fft_inst, SoundBufferIn, SoundBufferOut, 0);
+	if(cqtReady && (Mode == CQT)){ // needs the complex spectrum, levels go to the spent input
+		uint32_t start = DWT_CYCCNT;
+		Cqt_Compute(&Cqt, SoundBufferOut, SoundBufferIn);
+		cqtCycles = DWT_CYCCNT - start;
+	}
 	int counter = 0;
+	packPower(SoundBufferOut);
+	// decibels into magnitudeArr and spectral descriptors in one pass,
+	// magnitudeArr still holds the previous frame for the flux
+	Spectral_Compute(&Spectral, SoundBufferOut, magnitudeArr, MAGNUM);
+	Peaks_Update(&Peaks, magnitudeArr, MAGNUM-1);
+	numTones = Peaks_Stable(&Peaks, toneFreq, toneAmp, PEAKS_MAXTRACKS);
+	if(Mode == THD){
+		Thd_Measure(&Thd, SoundBufferOut, MAGNUM);
+	}
 	// array with real numbers for decibels
-	for(int i = 2; i < SAMPLELENGTH; i+=2){
-		// convert from time to frequency domain
-		dBArray[counter] = (uint32_t)(20*log10f(imaginary_abs(SoundBufferOut[i], SoundBufferOut[i+1])));
-		magnitudeArr[counter] = (20*log10f(imaginary_abs(SoundBufferOut[i], SoundBufferOut[i+1])));
-		
+	for(counter = 0; counter < MAGNUM-1; counter++){
+		dBArray[counter] = plotPoint(magnitudeArr[counter]);
 		// save real numbers in array
-		dBsum = dBsum + dBArray[counter];
-		counter++;
-	}
-	// get index of max magnitude value
-	arm_max_f32(magnitudeArr, 1024, &maxVal, &maxInd);
-	int binFreq = (125000/SAMPLELENGTH);
-	bin = (uint32_t)binFreq; // for display
-	avgFreq = maxInd*binFreq;
-	// adjust offset
-	int offs = avgFreq/MAGNUM;
-	avgFreq = (maxInd-offs)*binFreq;
+		dBsum = dBsum + (int32_t)magnitudeArr[counter];
+	}
+	// get index of max magnitude value, element i is bin i+1 and only
+	// MAGNUM-1 are written, the last element of the block is not a level
+	arm_max_f32(magnitudeArr, MAGNUM-1, &maxVal, &maxInd);
+	float32_t binFreq = (float32_t)SAMPLERATE/SAMPLELENGTH;
+	bin = (uint32_t)(binFreq + 0.5f); // for display
+	avgFreq = (uint32_t)((maxInd+1)*binFreq + 0.5f);
 	dBAvg = dBsum/MAGNUM - 20; // account for the negative values
 	dBsum = 0;
+	plotLength = MAGNUM;
+	snrAll = Noise_Update(&Noise, magnitudeArr);
+	if(Mode == SNR){ // plot level above the noise floor instead of the level
+		for(counter = 0; counter < MAGNUM-1; counter++){
+			dBArray[counter] = plotPoint(magnitudeArr[counter] - Noise_Floor(&Noise, counter));
+		}
+	}
+	if(cqtReady && (Mode == CQT)){ // plot the constant-Q levels instead, lowest frequency at the left
+		for(counter = 0; counter < (int)CqtKernel.numBins; counter++){
+			dBArray[counter] = plotPoint(SoundBufferIn[counter]);
+		}
+		plotLength = CqtKernel.numBins;
+		bin = CqtKernel.binsPerOctave; // for display
+		avgFreq = (uint32_t)CqtKernel.bins[Cqt.peak].freq;
+	}
+	if(Mode == BAND){ // plot the sliding DFT band instead, each bin BANDCOLUMNS wide
+		uint32_t strongest = 0;
+		for(counter = 0; counter < SDFTNUMBINS; counter++){
+			if(bandArr[counter] > bandArr[strongest]){
+				strongest = counter;
+			}
+		}
+		for(counter = 0; counter < SDFTNUMBINS*BANDCOLUMNS; counter++){
+			dBArray[counter] = plotPoint(bandArr[counter/BANDCOLUMNS]);
+		}
+		plotLength = bandValid ? SDFTNUMBINS*BANDCOLUMNS : 0; // axes only until a re-anchor
+		avgFreq = (uint32_t)((SDFTFIRSTBIN + strongest)*binFreq + 0.5f);
+	}
 	
 	return;
 }
 
+// Calculates the cepstrum of the latest frame from its dB spectrum
+// Must follow everything that reads the power spectrum in SoundBufferOut
+void call_Cepstrum(void){
+	Cepstrum_Compute(&Ceps, &fft_inst, magnitudeArr, MAGNUM-1, SoundBufferOut, SoundBufferIn);
+	if(Mode != CEPSTRUM){
+		return;
+	}
+	// peak hold over each group of quefrencies, qMin at the left
+	uint32_t step = (SAMPLELENGTH/2 - Ceps.qMin + CEPSPLOT - 1)/CEPSPLOT;
+	uint32_t q = Ceps.qMin;
+	for(int i = 0; i < CEPSPLOT; i++){
+		float32_t peak = 0;
+		for(uint32_t j = 0; (j < step) && (q <= SAMPLELENGTH/2); j++, q++){
+			if(SoundBufferIn[q] > peak){
+				peak = SoundBufferIn[q];
+			}
+		}
+		dBArray[i] = plotPoint(CEPSSCALE*peak);
+	}
+	plotLength = CEPSPLOT;
+	bin = step; // quefrency samples per plot column
+	avgFreq = Ceps.numPeaks ? (uint32_t)Ceps.spacing[0] : 0;
+}
+
+// Analyses a captured transient, then re-arms the onset detector
+// The red LED brightness shows the peak of the latest transient
+void call_Onset(void){
+	int32_t v;
+	int32_t peak = 0;
+	if(Onset.state != ONSET_CAPTURED){
+		return;
+	}
+	for(int i = 0; i < ONSET_CAPTURELEN; i++){ // order does not matter for the peak
+		v = Onset.ring[i] - (int32_t)Onset.dc;
+		if(v < 0){
+			v = -v;
+		}
+		if(v > peak){
+			peak = v;
+		}
+	}
+	onsetPeak = (uint32_t)peak;
+	BSP_RGB_Set((onsetPeak > 511) ? 1023 : 2*onsetPeak, 0, 0);
+	Onset_Release(&Onset);
+}
+
+// Calculates zoom FFT magnitude and peak frequency when a new spectrum is ready
+// The levels go to SoundBufferIn, the frame is not analysed in ZOOM mode
+// Returns 1 if the plot was updated
+int call_ZoomFFT(void){
+	float32_t sum = 0;
+	if(ZoomFFT_Magnitude(&Zoom, SoundBufferIn) == 0){
+		return 0; // still collecting decimated samples
+	}
+	for(int i = 0; i < ZOOMLENGTH; i++){
+		dBArray[i] = plotPoint(SoundBufferIn[i]);
+		sum = sum + SoundBufferIn[i];
+	}
+	arm_max_f32(SoundBufferIn, ZOOMLENGTH, &maxVal, &maxInd);
+	bin = (uint32_t)(Zoom.span/ZOOMLENGTH + 0.5f); // for display
+	avgFreq = (uint32_t)(Zoom.center - Zoom.span/2 + maxInd*Zoom.span/ZOOMLENGTH);
+	dBAvg = (int32_t)(sum/ZOOMLENGTH) - 20;
+	plotLength = ZOOMLENGTH;
+	return 1;
+}
+
 // *********Task0_Init*********
 // initializes microphone
 // Task0 measures sound intensity
@@ -131,35 +422,92 @@ void call_FFT(void){
 // Outputs: none
 void Task0_Init(void){
   BSP_Microphone_Init();
+  BSP_Microphone_Start(SAMPLERATE, 1); // above SysTick, so it samples while Acquire runs
 }
 
-// Capture and store raw sound data
-// periodic even thread, called every 1ms
-void Task0(void){ // periodic even thread
+// Borrows a block for the next frame, keeping one back for the analysis
+// unless it already holds its work block, so capturing can never leave the
+// analysis without SoundBufferOut
+// Returns the block, 0 if the frame is to be dropped
+float32_t *borrowFrame(void){
+	if(Pool_Available(&Pool, FRAMEBYTES) > (SoundBufferOut ? 0 : 1)){
+		return (float32_t *)Pool_Alloc(&Pool, FRAMEBYTES);
+	}
+	return 0;
+}
+
+// Capture and store raw sound data, one sample, SoundData
+// At the end of each frame, a frame captured into a block borrowed at its
+// first sample is handed to the analysis through the mailbox
+void Task0(void){
 	static int32_t rawSum = 0;
+	static uint64_t rawSquares = 0;
 	static int time = 0; // units of microphone sampling rate
-	BSP_Microphone_Input(&SoundData);
-	SoundArray[time] = SoundData;
+	static int32_t onsetTold = 0; // true once the control thread was told of the capture
 	// store raw sound data in buffer
 	float32_t voltage = (float32_t)SoundData; // input is voltage * 100
-  SoundBufferIn[time] = voltage;
+	voltage = Notch_Process(&Notch, voltage); // remove 50/60 Hz hum and harmonics
+	int16_t oldest; // x(n-N) for the sliding DFT, from the onset ring
+	if(Onset_Oldest(&Onset, &oldest) == 0){ // no history while a capture is held
+		SDFT_Invalidate(&Sdft);
+		oldest = 0;
+	}
+	SDFT_Update(&Sdft, (float32_t)SoundData, (float32_t)oldest); // raw, the band is above the notches
+	Onset_Update(&Onset, (int16_t)SoundData);
+	if(Onset.state != ONSET_CAPTURED){
+		onsetTold = 0;
+	}else if(onsetTold == 0){ // wake the control thread now rather than at the end of the frame
+		OS_FlagsSet(&ControlFlags, FLAG_ONSET);
+		onsetTold = 1;
+	}
+	Vad_Update(&Vad, voltage);
+	Yin_Update(&Yin, voltage);
+	if(Mode == ZOOM){
+		ZoomFFT_Update(&Zoom, voltage);
+	}
+	if(Capture){
+		Capture[time] = voltage;
+	}
 	rawSum = rawSum + (int32_t)SoundData;
+	rawSquares = rawSquares + (uint32_t)SoundData*SoundData;
 	
 	// increment time counter
 	time = time + 1;
 	// if SoundBuffer is full
 	if (time == SAMPLELENGTH){
-			// call function to process fft
-			//call_FFT();
 			rawAvg = rawSum/SAMPLELENGTH;
+			// variance in one pass, N*sum(x^2) - sum(x)^2 fits 64 bits for 12-bit samples
+			rawRMS = sqrt32((uint32_t)((SAMPLELENGTH*rawSquares - (uint64_t)rawSum*rawSum)/
+			                           ((uint64_t)SAMPLELENGTH*SAMPLELENGTH)));
 			rawSum = 0;
-			for(int i = 0; i < SAMPLELENGTH; i++){
-				rawSum = rawSum + (SoundArray[i] - rawAvg)*(SoundArray[i]-rawAvg);
-			}
-			rawRMS = sqrt32(rawSum/SAMPLELENGTH);
-			rawSum = 0;
+			rawSquares = 0;
 			time = 0; // start writing back into beginning of array (MACQ)
+			bandValid = SDFT_Magnitude(&Sdft, bandArr); // band of the latest SAMPLELENGTH samples
+			TRACE(TRACE_FRAME_END, 0, AcqStats.frames + AcqStats.dropped);
+			if(Capture && (Captured == 0)){
+				Captured = Capture; // belongs to the analysis until it gives it back
+				AcqStats.frames++;
+				OS_MailBox_Send(DWT_CYCCNT);
+			}else{
+				Pool_Free(&Pool, Capture);
+				AcqStats.dropped++;
+			}
+			Capture = borrowFrame();
+			TRACE(TRACE_FRAME_START, 0, AcqStats.frames + AcqStats.dropped);
+			OS_FlagsSet(&ControlFlags, FLAG_FRAME);
+	}
+}
+
+// Acquisition stage, periodic event thread run by the scheduler every tick
+// Takes the samples converted since the previous tick, ACQCHUNK of them at
+// SAMPLERATE, so a frame spans SAMPLELENGTH/ACQCHUNK ticks
+void Acquire(void){
+	uint32_t start = DWT_CYCCNT;
+	Time++;
+	while(BSP_Microphone_Get(&SoundData)){
+		Task0();
 	}
+	AcqStats.cycles = DWT_CYCCNT - start;
 }
 
 // plot display categories
@@ -170,17 +518,145 @@ void Task1(void){
 	BSP_LCD_DrawString(10, 1, "Bin", TOPTXTCOLOR);
 }
 
+// Print spectral descriptors in the plot area
+// centroid, spread and roll-off in Hz, flatness in 1/1000, flux in dB,
+// tone is the strongest stable peak track in Hz, pitch in 1/10 Hz
+// (0 if unvoiced) with its confidence in 1/100, then the analysed frames
+// per second and the latency from acquisition to display in 1/10 ms
+void drawDescriptors(void){
+	BSP_LCD_FillRect(0, 17, 128, 111, BGCOLOR);
+	BSP_LCD_DrawString(0, 3, "Centroid", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(12, 3); BSP_LCD_OutUDec5((uint32_t)Spectral.centroid, VALUECOLOR);
+	BSP_LCD_DrawString(0, 4, "Spread", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(12, 4); BSP_LCD_OutUDec5((uint32_t)Spectral.spread, VALUECOLOR);
+	BSP_LCD_DrawString(0, 5, "Flatness", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(12, 5); BSP_LCD_OutUDec5((uint32_t)(1000*Spectral.flatness), VALUECOLOR);
+	BSP_LCD_DrawString(0, 6, "Rolloff", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(12, 6); BSP_LCD_OutUDec5((uint32_t)Spectral.rolloff, VALUECOLOR);
+	BSP_LCD_DrawString(0, 7, "Flux", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(12, 7); BSP_LCD_OutUFix2_1((uint32_t)(10*Spectral.flux), VALUECOLOR);
+	BSP_LCD_DrawString(0, 8, "Tone", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(12, 8); BSP_LCD_OutUDec5(numTones ? (uint32_t)toneFreq[0] : 0, VALUECOLOR);
+	BSP_LCD_DrawString(0, 9, "Pitch", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(12, 9); BSP_LCD_OutUDec5((uint32_t)(10*Yin.pitch), VALUECOLOR);
+	BSP_LCD_DrawString(0, 10, "Confidence", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(12, 10); BSP_LCD_OutUDec5((uint32_t)(100*Yin.confidence), VALUECOLOR);
+	BSP_LCD_DrawString(0, 11, "Event", TOPTXTCOLOR); // frames per second are on the STATS page
+	BSP_LCD_DrawString(12, 11, (char *)Classify_Name(&Classifier, eventClass), VALUECOLOR); // "none" without a model
+	BSP_LCD_DrawString(0, 12, "Latency", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(12, 12); BSP_LCD_OutUDec5(LcdStats.latency/(BSP_Clock_GetFreq()/10000), VALUECOLOR);
+}
+
+// Print distortion measurements in the plot area
+// fundamental in Hz, THD and THD+N in 1/100 percent, SINAD in dB,
+// harmonics 2 to 10 in dB below the fundamental
+void drawThd(void){
+	BSP_LCD_FillRect(0, 17, 128, 111, BGCOLOR);
+	if(Thd.valid == 0){
+		BSP_LCD_DrawString(0, 3, "No tone", TOPTXTCOLOR);
+		return;
+	}
+	BSP_LCD_DrawString(0, 3, "Fund", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(12, 3); BSP_LCD_OutUDec5((uint32_t)Thd.f0, VALUECOLOR);
+	BSP_LCD_DrawString(0, 4, "THD", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(12, 4); BSP_LCD_OutUDec5((uint32_t)(100*Thd.thd), VALUECOLOR);
+	BSP_LCD_DrawString(0, 5, "THD+N", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(12, 5); BSP_LCD_OutUDec5((uint32_t)(100*Thd.thdn), VALUECOLOR);
+	BSP_LCD_DrawString(0, 6, "SINAD", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(12, 6); BSP_LCD_OutUFix2_1((uint32_t)(10*Thd.sinad), VALUECOLOR);
+	for(uint32_t h = 2; h <= THD_HARMONICS; h++){ // two columns, H2 H3 on the first row
+		uint32_t col = (h%2) ? 10 : 0;
+		uint32_t row = 6 + h/2;
+		BSP_LCD_DrawString(col, row, (h == 10) ? "H10" : "H", TOPTXTCOLOR);
+		if(h < 10){
+			BSP_LCD_SetCursor(col + 1, row); BSP_LCD_OutUDec(h, TOPTXTCOLOR);
+		}
+		BSP_LCD_SetCursor(col + 4, row); BSP_LCD_OutUDec4((uint32_t)(-Thd.harmonic[h]), VALUECOLOR);
+	}
+}
+
+// Print scheduler and pipeline statistics in the plot area
+// load of each thread, the SysTick handler and the idle thread in percent
+// since the page was last drawn, stack high water marks in bytes, thread
+// switches per second, and frames per second and frames dropped by each stage
+void drawStats(void){
+	static const char *threads[3] = {"Analyse", "Display", "Control"};
+	static uint32_t last[5], lastSwitches, lastTime;
+	uint32_t cycles, switches, stack, total = 0, eventCycles, switchCycles, misses, worst;
+	BSP_LCD_FillRect(0, 17, 128, 111, BGCOLOR);
+	uint32_t now = DWT_CYCCNT;
+	uint32_t elapsed = now - lastTime + 1;
+	uint32_t perCent = elapsed/100 + 1;
+	lastTime = now;
+	BSP_LCD_DrawString(0, 2, "Thread", TOPTXTCOLOR);
+	BSP_LCD_DrawString(8, 2, "Load", TOPTXTCOLOR);
+	BSP_LCD_DrawString(12, 2, "Stck", TOPTXTCOLOR);
+	BSP_LCD_DrawString(17, 2, "Miss", TOPTXTCOLOR);
+	for(uint32_t i = 0; i < 3; i++){
+		OS_ThreadStats(i, &cycles, &switches, &stack);
+		OS_DeadlineStats(i, &misses, &worst);
+		BSP_LCD_DrawString(0, 3 + i, (char *)threads[i], TOPTXTCOLOR);
+		BSP_LCD_SetCursor(8, 3 + i); BSP_LCD_OutUDec4((cycles - last[i])/perCent, VALUECOLOR);
+		BSP_LCD_SetCursor(12, 3 + i); BSP_LCD_OutUDec4(stack, VALUECOLOR);
+		BSP_LCD_SetCursor(17, 3 + i); BSP_LCD_OutUDec4(misses, VALUECOLOR);
+		last[i] = cycles;
+		total = total + switches;
+	}
+	OS_HandlerStats(&eventCycles, &switchCycles, &stack);
+	BSP_LCD_DrawString(0, 6, "Handler", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(8, 6); BSP_LCD_OutUDec4((eventCycles + switchCycles - last[3])/perCent, VALUECOLOR);
+	BSP_LCD_SetCursor(12, 6); BSP_LCD_OutUDec4(stack, VALUECOLOR); // size of each stack
+	last[3] = eventCycles + switchCycles;
+	cycles = OS_IdleCycles();
+	BSP_LCD_DrawString(0, 7, "Idle", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(8, 7); BSP_LCD_OutUDec4((cycles - last[4])/perCent, VALUECOLOR);
+	BSP_LCD_DrawString(17, 7, "Pool", TOPTXTCOLOR);
+	last[4] = cycles;
+	BSP_LCD_DrawString(0, 8, "Switch/s", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(8, 8); BSP_LCD_OutUDec4((uint32_t)((uint64_t)(total - lastSwitches)*BSP_Clock_GetFreq()/elapsed), VALUECOLOR);
+	BSP_LCD_SetCursor(17, 8); BSP_LCD_OutUDec4(Pool.classes[0].fails + Pool.classes[1].fails, VALUECOLOR);
+	lastSwitches = total;
+	BSP_LCD_DrawString(0, 9, "Stage", TOPTXTCOLOR);
+	BSP_LCD_DrawString(8, 9, "Fr/s", TOPTXTCOLOR);
+	BSP_LCD_DrawString(12, 9, "Drop", TOPTXTCOLOR);
+	BSP_LCD_DrawString(17, 9, "Wrst", TOPTXTCOLOR); // most ticks a job took
+	BSP_LCD_DrawString(0, 10, "Acquire", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(8, 10); BSP_LCD_OutUDec4(AcqStats.rate, VALUECOLOR);
+	BSP_LCD_SetCursor(12, 10); BSP_LCD_OutUDec4(AcqStats.dropped, VALUECOLOR);
+	BSP_LCD_DrawString(0, 11, "Analyse", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(8, 11); BSP_LCD_OutUDec4(DspStats.rate, VALUECOLOR);
+	BSP_LCD_SetCursor(12, 11); BSP_LCD_OutUDec4(DspStats.dropped, VALUECOLOR);
+	OS_DeadlineStats(0, &misses, &worst);
+	BSP_LCD_SetCursor(17, 11); BSP_LCD_OutUDec4(worst, VALUECOLOR);
+	BSP_LCD_DrawString(0, 12, "Display", TOPTXTCOLOR);
+	BSP_LCD_SetCursor(8, 12); BSP_LCD_OutUDec4(LcdStats.rate, VALUECOLOR);
+	BSP_LCD_SetCursor(12, 12); BSP_LCD_OutUDec4(LcdStats.dropped, VALUECOLOR);
+	OS_DeadlineStats(1, &misses, &worst);
+	BSP_LCD_SetCursor(17, 12); BSP_LCD_OutUDec4(worst, VALUECOLOR);
+}
+
 // Plot array - magnitude over frequency
-// x axis can be 0-99 units long
+// x axis can be 0-99 units long, draws the plot handed over by the analysis
 void Task2(void){
  // Count2 = 0;
+	if(Mode == DESCRIPTORS){
+		drawDescriptors();
+		return;
+	}
+	if(Mode == THD){
+		drawThd();
+		return;
+	}
+	if(Mode == STATS){
+		drawStats();
+		return;
+	}
 	// draw magnitude
 	drawaxes();
-		int i = 0;
+		uint32_t i = 0;
 		int32_t val = 0;
-		while (i < MAGNUM){
-			//val = (int32_t) mag[i];
-			val = dBArray[i];
+		while (i < Front->length){
+			val = Front->dB[i];
 			BSP_LCD_PlotPoint(val, SOUNDCOLOR);
 			BSP_LCD_PlotIncrement();
 			i++;
@@ -189,33 +665,236 @@ void Task2(void){
 
 // update numerical values on LCD
 void Task3(void){
-	BSP_LCD_SetCursor(3, 0); BSP_LCD_OutUDec4(dBAvg,VALUECOLOR);
+	BSP_LCD_SetCursor(3, 0); BSP_LCD_OutUDec4(Front->dBAvg,VALUECOLOR);
 	BSP_LCD_SetCursor(3, 1); BSP_LCD_OutUDec4(rawRMS,VALUECOLOR);
-	BSP_LCD_SetCursor(15, 0); BSP_LCD_OutUDec4(avgFreq,VALUECOLOR);
-	BSP_LCD_SetCursor(15, 1); BSP_LCD_OutUDec4(bin,VALUECOLOR);
+	BSP_LCD_SetCursor(15, 0); BSP_LCD_OutUDec4(Front->freq,VALUECOLOR);
+	BSP_LCD_SetCursor(15, 1); BSP_LCD_OutUDec4(Front->bin,VALUECOLOR);
+}
+
+// Hands the finished plot to the display if it is waiting for one,
+// otherwise the plot is dropped and the next frame is analysed into the
+// same buffer, so the analysis never waits for the display
+// Input: DWT_CYCCNT when the frame was acquired
+void publish(uint32_t stamp){
+	plotType *p;
+	if(plotFree == 0){
+		LcdStats.dropped++;
+		return;
+	}
+	Back->length = plotLength;
+	Back->dBAvg = dBAvg;
+	Back->freq = avgFreq;
+	Back->bin = bin;
+	Back->stamp = stamp;
+	p = Front;
+	Front = Back;
+	Back = p;
+	dBArray = Back->dB;
+	plotFree = 0;
+	OS_Signal(&NewData);
+}
+
+// Updates a stage's counters at the end of a frame
+// Inputs: stage, DWT_CYCCNT when the stage started on the frame and when the frame was acquired
+void stageDone(stageType *s, uint32_t start, uint32_t stamp){
+	uint32_t now = DWT_CYCCNT;
+	s->frames++;
+	s->cycles = now - start;
+	s->latency = now - stamp;
+	if(s->latency > s->maxLatency){
+		s->maxLatency = s->latency;
+	}
+}
+
+// Analysis stage, foreground thread
+// Waits for a frame from the acquisition, analyses it, gives its blocks
+// back to the pool and hands the plot to the display
+void Analyse(void){
+	float32_t *block;
+	while(1){
+		uint32_t stamp = OS_MailBox_Recv();
+		uint32_t passStart = DWT_CYCCNT;
+		uint32_t passWork = WORK_CYCCNT;
+		TRACE(TRACE_FRAME_START, 1, DspStats.frames);
+		int32_t updated = 0;
+		SoundBufferIn = Captured;
+		Captured = 0;
+		if((Mode == ZOOM) && (Zoom.buf == 0)){ // the dB spectrum block becomes the zoom buffer
+			Pool_Free(&Pool, magnitudeArr);
+			magnitudeArr = 0;
+			ZoomFFT_Attach(&Zoom, (float32_t *)Pool_Alloc(&Pool, ZOOMBYTES));
+		}else if((Mode != ZOOM) && Zoom.buf){
+			block = Zoom.buf;
+			ZoomFFT_Attach(&Zoom, 0);
+			Pool_Free(&Pool, block);
+			magnitudeArr = (float32_t *)Pool_Alloc(&Pool, SPECBYTES); // the first flux after ZOOM compares with zoom data
+		}
+		vadDuty = (100*Vad.activeFrames)/(Vad.frames + 1);
+		int32_t skip = (Vad_Take(&Vad) == 0) && (Mode != ZOOM) && (Mode != THD) && (Mode != STATS); // Vad_Take clears it in every mode
+		if(skip){ // nothing but background since the last frame, measurements are never skipped
+			skippedPasses++;
+			SoundBufferOut = (float32_t *)Pool_Alloc(&Pool, FRAMEBYTES); // the floor tracks every frame, not only the analysed ones
+			call_Background();
+			updated = (Mode == DESCRIPTORS); // the text pages show every frame
+		}else if(Mode == ZOOM){
+			updated = call_ZoomFFT();
+		}else{
+			SoundBufferOut = (float32_t *)Pool_Alloc(&Pool, FRAMEBYTES); // borrowFrame always leaves one
+			call_FFT();
+			uint32_t start = WORK_CYCCNT;
+			MFCC_Compute(&Mfcc, SoundBufferOut);
+			mfccCycles = WORK_CYCCNT - start;
+			if(classifierReady){
+				start = WORK_CYCCNT;
+				eventClass = Classify_Run(&Classifier, Mfcc.coeffs);
+				classifyCycles = WORK_CYCCNT - start;
+			}
+			call_Cepstrum();
+			start = WORK_CYCCNT;
+			Yin_Compute(&Yin, &fft_inst, SoundBufferIn, SoundBufferOut); // both are free once the frame is analysed
+			yinCycles = WORK_CYCCNT - start;
+			Vad_SetFlatness(&Vad, Spectral.flatness);
+			updated = 1;
+		}
+		block = SoundBufferOut;
+		SoundBufferOut = 0; // borrowFrame keeps a block back again from here on
+		Pool_Free(&Pool, block);
+		Pool_Free(&Pool, SoundBufferIn);
+		SoundBufferIn = 0;
+		TRACE(TRACE_FRAME_END, 1, DspStats.frames);
+		stageDone(&DspStats, passStart, stamp);
+		passWork = WORK_CYCCNT - passWork;
+		activeCycles += passWork;
+		if(skip == 0){
+			analysedCycles += passWork;
+			analysedPasses++;
+		}
+		if(updated){
+			publish(stamp);
+		}
+		OS_CheckIn();
+	}
+}
+
+// Display stage, foreground thread
+// Draws each plot handed over by the analysis
+void Display(void){
+	while(1){
+		OS_Wait(&NewData);
+		uint32_t start = DWT_CYCCNT;
+		TRACE(TRACE_FRAME_START, 2, LcdStats.frames);
+		Task1(); // write on top
+		Task2(); // update plot
+		Task3(); // update numerical values
+		TRACE(TRACE_FRAME_END, 2, LcdStats.frames);
+		stageDone(&LcdStats, start, Front->stamp);
+		plotFree = 1; // ready for the next plot
+		OS_CheckIn();
+	}
+}
+
+// Frame rate of each stage, periodic event thread run once a second
+void Rates(void){
+	AcqStats.rate = AcqStats.frames - AcqStats.last;
+	AcqStats.last = AcqStats.frames;
+	DspStats.rate = DspStats.frames - DspStats.last;
+	DspStats.last = DspStats.frames;
+	LcdStats.rate = LcdStats.frames - LcdStats.last;
+	LcdStats.last = LcdStats.frames;
+}
+
+// Control thread, runs once per frame and when a transient is captured
+// Transients, the display mode button, and the trace: it is frozen on a
+// deadline miss and Button2 sends it out of UART0 and starts it again
+void Control(void){
+	int32_t pressed = 0, pressed2 = 0;
+	uint32_t events, tick, thread, lastMiss = 0;
+	while(1){
+		events = OS_FlagsWait(&ControlFlags, FLAG_FRAME | FLAG_ONSET, OS_FLAGS_ANY, 1, OS_FOREVER);
+		if(events & FLAG_ONSET){
+			call_Onset();
+		}
+		if(events & FLAG_FRAME){
+			if(BSP_Button1_Input() == 0){ // pressed, select next display mode once per press
+				if(pressed == 0){
+					Mode = (enum DisplayMode)((Mode + 1)%NUMMODES);
+				}
+				pressed = 1;
+			}else{
+				pressed = 0;
+			}
+			if(OS_MissLog(0, &tick, &thread) && (tick != lastMiss)){
+				Trace_Stop(); // keep what led up to the miss
+				lastMiss = tick;
+			}
+			if(BSP_Button2_Input() == 0){
+				if(pressed2 == 0){
+					Trace_Dump(); // takes longer than the deadline, a miss is logged
+					OS_MissLog(0, &lastMiss, &thread);
+					Trace_Start();
+				}
+				pressed2 = 1;
+			}else{
+				pressed2 = 0;
+			}
+		}
+		OS_CheckIn();
+	}
 }
 
 //******** MAIN FUNCTION ********\\
 
 int main(void){
   OS_Init();            // initialize, disable interrupts
+	watchdogReset = OS_WatchdogReset();
 	Task0_Init();    // microphone init
 	//arm_rfft_fast_init_f32(&fft_inst,1024); // bug in library function
 	rfft_fast_init_1024_f32(&fft_inst); // initialize FFT table with sample length of 1024
+	SDFT_Init(&Sdft, SDFTFIRSTBIN, SDFTNUMBINS, ONSET_CAPTURELEN, SDFTANCHOR); // the onset ring is the history
+	ZoomFFT_Init(&Zoom, SAMPLERATE, ZOOMCENTER, ZOOMSPAN, ZOOMLENGTH);
+	MFCC_Init(&Mfcc, SAMPLERATE, SAMPLELENGTH, MAGNUM, MFCCLOW, MFCCHIGH);
+	classifierReady = Classify_Init(&Classifier, &ClassModel, MFCC_NUMCOEFFS);
+	Spectral_Init(&Spectral, (float32_t)SAMPLERATE/SAMPLELENGTH);
+	Peaks_Init(&Peaks, (float32_t)SAMPLERATE/SAMPLELENGTH);
+	Thd_Init(&Thd, (float32_t)SAMPLERATE/SAMPLELENGTH, SAMPLELENGTH, THDBAND);
+	Yin_Init(&Yin, SAMPLERATE);
+	Cepstrum_Init(&Ceps, SAMPLERATE, SAMPLELENGTH, CEPSMAXSPACING);
+	cqtReady = Cqt_Init(&Cqt, &CqtKernel, SAMPLERATE, SAMPLELENGTH);
+	Onset_Init(&Onset, ONSETPOST, ONSETHOLDOFF);
+	Vad_Init(&Vad, SAMPLELENGTH);
+	Noise_Init(&Noise, MAGNUM-1);
+	Notch_Init(&Notch, SAMPLERATE, NOTCHHARMONICS);
+	Pool_Init(&Pool, PoolArena, POOLWORDS, PoolSizes, PoolCounts, 2);
+	magnitudeArr = (float32_t *)Pool_Alloc(&Pool, SPECBYTES); // zeroed like the other globals
+	filterReady = Filter_Configure(&Chain, &FilterSet);
+	SoundBufferOut = (float32_t *)Pool_Alloc(&Pool, FRAMEBYTES); // scratch, every block is free until the first frame
+	filterErrordB = Filter_Verify(&Chain, SoundBufferOut);
+	Pool_Free(&Pool, SoundBufferOut);
+	SoundBufferOut = 0;
+	if(filterErrordB > FILTER_VERIFYDB){
+		filterReady = 0; // built, but does not behave as designed
+	}
+	BSP_Button1_Init();
+	BSP_Button2_Init();
+	Mode = SPECTRUM;
+	plotLength = MAGNUM;
 	BSP_RGB_Init(0, 0, 0);
 	BSP_LCD_Init();
   BSP_LCD_FillScreen(BSP_LCD_Color565(0, 0, 0));
 	Time = 0;
-	while(1){
-		// take sample
-		for(int i = 0; i < 44100; i++){ // sampling at 44.1 kHz
-			Task0();
-		}
-		call_FFT();
-		Task1(); // write on top
-		Task2(); // update plot
-		Task3(); // update numerical values
-		
-	}
-	//return 0;
+	Capture = borrowFrame();
+	plotFree = 1;
+	OS_InitSemaphore(&NewData, 0);
+	OS_FlagsInit(&ControlFlags, 0);
+	OS_MailBox_Init();
+	OS_AddThreads(&Analyse, &Display, &Control);
+	OS_SetDeadline(0, DSPDEADLINE, 1);
+	OS_SetDeadline(1, LCDDEADLINE, 0); // waits as long as the analysis has no plot for it
+	OS_SetDeadline(2, CTLDEADLINE, 1);
+	OS_WatchdogInit(WATCHDOGTIME*BSP_Clock_GetFreq());
+	OS_AddPeriodicEventThread(&Acquire, 1, 0);
+	OS_AddPeriodicEventThread(&Rates, THREADFREQ, THREADFREQ/2);
+	Trace_Start();
+	OS_Launch(BSP_Clock_GetFreq()/THREADFREQ); // doesn't return, interrupts enabled in here
+	return 0;
 }
@@ -0,0 +1,118 @@
+//*****************************************************************************
+// vad.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Voice (sound) activity detector from energy, zero crossings and
+// spectral flatness, with hangover.
+
+#include <stdint.h>
+#include "vad.h"
+#include "arm_math.h"
+#include "../inc/CortexM.h"
+
+void Vad_Init(vadType *v, uint32_t frameLength){
+  uint32_t i;
+  v->frameLength = frameLength;
+  v->count = 0;
+  v->dc = 0;
+  v->energy = 0;
+  v->crossings = 0;
+  v->lastSign = 0;
+  v->flatness = 0;      // treat as structured until a spectrum is seen
+  v->level = 0;
+  v->zcr = 0;
+  v->floor = VAD_FLOORMAX;
+  for(i = 0; i < VAD_FLOORSUBS; i++){
+    v->subMin[i] = 1000.0f;           // first frame sets the floor
+  }
+  v->curMin = 1000.0f;
+  v->subFrames = 0;
+  v->subPos = 0;
+  v->hang = 0;
+  v->active = 1;
+  v->pending = 1;       // analyse the first frame
+  v->frames = 0;
+  v->activeFrames = 0;
+}
+
+// the quietest level of the window, this frame included, at most
+// VAD_FLOORMAX, then start a new sub-window in place of the oldest if
+// this one is full
+static void floorDone(vadType *v){
+  uint32_t i;
+  if(v->level < v->curMin){
+    v->curMin = v->level;
+  }
+  v->floor = (v->curMin < VAD_FLOORMAX) ? v->curMin : VAD_FLOORMAX;
+  for(i = 0; i < VAD_FLOORSUBS; i++){
+    if(v->subMin[i] < v->floor){
+      v->floor = v->subMin[i];
+    }
+  }
+  v->subFrames++;
+  if(v->subFrames == VAD_FLOORSUBLEN){
+    v->subMin[v->subPos] = v->curMin;
+    v->subPos = (v->subPos + 1)%VAD_FLOORSUBS;
+    v->curMin = 1000.0f;
+    v->subFrames = 0;
+  }
+}
+
+// decide on a finished frame
+static void frameDone(vadType *v){
+  int32_t loud, noiseLike;
+  v->level = 10*log10f(v->energy/(float32_t)v->frameLength + 1.0f);
+  v->zcr = (float32_t)v->crossings/(float32_t)v->frameLength;
+  floorDone(v);
+  loud = (v->level > v->floor + VAD_MARGIN);
+  noiseLike = (v->flatness > VAD_FLATMAX) && (v->zcr > VAD_ZCRMAX);
+  v->flatness *= VAD_FLATDECAY;     // ages until the next Vad_SetFlatness
+  if(loud && !noiseLike){
+    v->hang = VAD_HANGOVER;
+    v->active = 1;
+  }else if(v->hang){
+    v->hang--;
+    v->active = 1;
+  }else{
+    v->active = 0;
+  }
+  v->frames++;
+  if(v->active){
+    v->activeFrames++;
+    v->pending = 1;
+  }
+  v->energy = 0;
+  v->crossings = 0;
+  v->count = 0;
+}
+
+void Vad_Update(vadType *v, float32_t x){
+  int32_t sign;
+  if((v->frames == 0) && (v->count == 0)){
+    v->dc = x;            // start at the first sample, not far below midscale
+  }
+  v->dc += (1.0f/1024)*(x - v->dc);
+  x = x - v->dc;
+  v->energy += x*x;
+  sign = (x >= 0) ? 1 : -1;
+  if(sign != v->lastSign){
+    v->crossings++;
+    v->lastSign = sign;
+  }
+  v->count++;
+  if(v->count == v->frameLength){
+    frameDone(v);
+  }
+}
+
+void Vad_SetFlatness(vadType *v, float32_t flatness){
+  v->flatness = flatness;
+}
+
+int Vad_Take(vadType *v){
+  int result;
+  long sr = StartCritical(); // frameDone sets pending in the acquisition interrupt
+  result = v->pending;
+  v->pending = 0;
+  EndCritical(sr);
+  return result;
+}
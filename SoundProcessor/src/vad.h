@@ -0,0 +1,85 @@
+//*****************************************************************************
+// vad.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Voice (sound) activity detector, decides per frame whether anything is
+// worth analysing so the FFT, feature and display stages can be skipped.
+
+// A frame is active when its level is VAD_MARGIN dB above the noise floor,
+// unless it looks like broadband noise: spectral flatness above
+// VAD_FLATMAX and zero-crossing rate above VAD_ZCRMAX. Active frames are
+// extended by VAD_HANGOVER frames so word endings and decays are kept.
+// Flatness comes from the last spectrum seen, and decays by VAD_FLATDECAY
+// every frame until the next one, so a stale noise-like flatness cannot
+// keep a loud broadband sound from being analysed.
+// The floor is the quietest frame of the current sub-window and the last
+// VAD_FLOORSUBS full ones of VAD_FLOORSUBLEN frames, 2 to 2.3 s at 64 kHz,
+// and never above VAD_FLOORMAX: it drops to a quieter room at once, rises
+// to a louder one within the window, and a steady sound louder than
+// VAD_FLOORMAX + VAD_MARGIN, such as a tone already playing at boot, stays
+// active however long it lasts.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __VAD_H
+#define __VAD_H  1
+
+#define VAD_MARGIN    6.0f    // dB above the noise floor to be active
+#define VAD_FLOORSUBS 8       // sub-windows the floor is the minimum of
+#define VAD_FLOORSUBLEN 16    // frames in each sub-window
+#define VAD_FLOORMAX  24.0f   // dB, highest floor, 16 ADC counts rms
+#define VAD_FLATMAX   0.5f    // flatter than this may be background noise
+#define VAD_ZCRMAX    0.35f   // zero crossings per sample of background noise
+#define VAD_HANGOVER  4       // frames kept active after the last active frame
+#define VAD_FLATDECAY 0.8f    // flatness kept per frame without a new spectrum
+
+struct vad{
+  uint32_t frameLength;   // samples per decision
+  uint32_t count;         // samples in the current frame
+  float32_t dc;           // running DC estimate
+  float32_t energy;       // sum of squares in the current frame
+  uint32_t crossings;     // zero crossings in the current frame
+  int32_t lastSign;
+  float32_t flatness;     // spectral flatness of the last spectrum, decayed
+  float32_t level;        // level of the last frame in dB
+  float32_t zcr;          // zero crossings per sample of the last frame
+  float32_t floor;        // noise floor in dB
+  float32_t subMin[VAD_FLOORSUBS]; // quietest level of each full sub-window
+  float32_t curMin;       // quietest level of the current sub-window
+  uint32_t subFrames;     // frames in the current sub-window
+  uint32_t subPos;        // oldest sub-window, replaced next
+  uint32_t hang;          // hangover frames left
+  int32_t active;         // decision for the last frame
+  int32_t pending;        // true if any frame was active since Vad_Take
+  uint32_t frames;        // frames decided
+  uint32_t activeFrames;  // frames decided active
+};
+typedef struct vad vadType;
+
+// ******** Vad_Init ************
+// Initialize activity detector
+// Inputs:  pointer to detector
+//          samples per decision
+// Outputs: none
+void Vad_Init(vadType *v, uint32_t frameLength);
+
+// ******** Vad_Update ************
+// Add one raw sample, called every sample
+// Inputs:  pointer to detector
+//          raw sample
+// Outputs: none
+void Vad_Update(vadType *v, float32_t x);
+
+// ******** Vad_SetFlatness ************
+// Give the detector the spectral flatness of the latest frame
+// Inputs:  pointer to detector
+//          flatness, 0 to 1
+// Outputs: none
+void Vad_SetFlatness(vadType *v, float32_t flatness);
+
+// ******** Vad_Take ************
+// Check for activity since the previous call and clear it
+// Inputs:  pointer to detector
+// Outputs: 1 if any frame was active, 0 if all were inactive
+int Vad_Take(vadType *v);
+
+#endif
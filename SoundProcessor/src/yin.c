@@ -0,0 +1,132 @@
+//*****************************************************************************
+// yin.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// YIN pitch tracker, difference function from the rfft autocorrelation.
+
+#include <stdint.h>
+#include "yin.h"
+#include "arm_math.h"
+
+int Yin_Init(yinType *y, float32_t fs){
+  uint32_t i;
+  y->fs = fs/YIN_DECIMATE;
+  y->tauMin = (uint32_t)(y->fs/YIN_MAXHZ);
+  y->tauMax = (uint32_t)(y->fs/YIN_MINHZ) + 1;
+  for(i = 0; i < YIN_LENGTH; i++){
+    y->ring[i] = 0;
+  }
+  y->pos = 0;
+  y->acc = 0;
+  y->accCount = 0;
+  y->pitch = 0;
+  y->confidence = 0;
+  y->voiced = 0;
+  // lags up to half the frame, so every d(tau) averages at least YIN_LENGTH/2 products
+  return (y->tauMin >= 2) && (y->tauMax + 1 < YIN_LENGTH/2) && (y->tauMax + 1 < YIN_MAXLAG);
+}
+
+void Yin_Update(yinType *y, float32_t sample){
+  y->acc += sample;
+  y->accCount++;
+  if(y->accCount == YIN_DECIMATE){
+    y->ring[y->pos] = (int16_t)(y->acc*(1.0f/YIN_DECIMATE));
+    y->pos = (y->pos + 1)%YIN_LENGTH;
+    y->acc = 0;
+    y->accCount = 0;
+  }
+}
+
+float32_t Yin_Compute(yinType *y, arm_rfft_fast_instance_f32 *fft,
+                      float32_t *bufA, float32_t *bufB){
+  float32_t mean, energy = 0, scale, m, d, sum, a, b, c, delta, w, p, q;
+  float32_t *r = bufA, *cmnd = bufB;  // autocorrelation then d, and d'
+  uint32_t j, tau, pos = y->pos;
+  // one copy of the ring, oldest first, as Yin_Update keeps writing it
+  sum = 0;
+  for(j = 0; j < YIN_LENGTH; j++){
+    bufA[j] = (float32_t)y->ring[(pos + j)%YIN_LENGTH];
+    sum += bufA[j];
+  }
+  mean = sum/YIN_LENGTH;
+  for(j = 0; j < YIN_LENGTH; j++){ // DC removed, second half zero
+    bufA[j] = bufA[j] - mean;
+    bufA[YIN_LENGTH + j] = 0;
+    energy += bufA[j]*bufA[j];
+  }
+  y->voiced = 0;
+  y->confidence = 0;
+  if(energy == 0){
+    y->pitch = 0;
+    return 0;   // silence
+  }
+  // m(tau) from the copy before the rfft overwrites it
+  m = 2*energy;
+  for(tau = 1; tau <= y->tauMax + 1; tau++){
+    a = bufA[YIN_LENGTH - tau];  // x(N-tau)
+    b = bufA[tau - 1];           // x(tau-1)
+    m -= a*a + b*b;
+    y->m[tau] = m;
+  }
+  // autocorrelation = inverse transform of the power spectrum
+  arm_rfft_fast_f32(fft, bufA, bufB, 0);
+  bufB[0] = bufB[0]*bufB[0];  // DC
+  bufB[1] = bufB[1]*bufB[1];  // Nyquist
+  for(j = 2; j < 2*YIN_LENGTH; j += 2){
+    bufB[j] = bufB[j]*bufB[j] + bufB[j + 1]*bufB[j + 1];
+    bufB[j + 1] = 0;
+  }
+  arm_rfft_fast_f32(fft, bufB, r, 1);
+  scale = energy/r[0];  // r(0) is the energy whatever the transform scaling
+  // cumulative mean normalized difference into bufB
+  sum = 0;
+  cmnd[0] = 1;
+  for(tau = 1; tau <= y->tauMax + 1; tau++){
+    d = (y->m[tau] - 2*scale*r[tau])/(float32_t)(YIN_LENGTH - tau);
+    if(d < 0){
+      d = 0;   // rounding
+    }
+    r[tau] = d;  // r(tau) is not needed again, keep d for the interpolation
+    sum += d;
+    cmnd[tau] = (sum > 0) ? d*(float32_t)tau/sum : 1;
+  }
+  // first dip below the threshold, else the deepest
+  for(tau = y->tauMin; tau <= y->tauMax; tau++){
+    if(cmnd[tau] < YIN_THRESHOLD){
+      y->voiced = 1;
+      break;
+    }
+  }
+  if(y->voiced){
+    while((tau < y->tauMax) && (cmnd[tau + 1] < cmnd[tau])){
+      tau++;
+    }
+  }else{
+    tau = y->tauMin;
+    for(j = y->tauMin + 1; j <= y->tauMax; j++){
+      if(cmnd[j] < cmnd[tau]){
+        tau = j;
+      }
+    }
+  }
+  // parabola through d rather than d', which the normalization skews at short
+  // lags, then a cosine through the same three points: about a period of a
+  // tone d is C - B*cos(w*(u - tau - delta)) with w = 2*pi/(tau + delta),
+  // where the parabola is several Hz off at 5 to 8 lags; two passes settle w
+  a = r[tau - 1];
+  b = r[tau];
+  c = r[tau + 1];
+  delta = 0;
+  if(a - 2*b + c > 0){
+    delta = 0.5f*(a - c)/(a - 2*b + c);
+    for(j = 0; j < 2; j++){
+      w = 2*PI/((float32_t)tau + delta);
+      q = arm_sin_f32(0.5f*w);         // 1 - cos w as 2 sin^2(w/2), no cancellation
+      p = (a + c - 2*b)/(4*q*q);       // B cos(w delta)
+      q = (a - c)/(4*q*arm_cos_f32(0.5f*w)); // B sin(w delta)
+      delta = atan2f(q, p)/w;
+    }
+  }
+  y->confidence = (cmnd[tau] < 1) ? 1 - cmnd[tau] : 0;
+  y->pitch = y->voiced ? y->fs/((float32_t)tau + delta) : 0;
+  return y->pitch;
+}
@@ -0,0 +1,79 @@
+//*****************************************************************************
+// yin.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// YIN fundamental frequency (pitch) tracker with confidence, for voiced and
+// tonal sounds, with the difference function computed through the rfft.
+
+// Samples are decimated by YIN_DECIMATE (boxcar average) into a YIN_LENGTH
+// ring as they arrive, e.g. 64 kHz to 8 kHz and 64 ms of history.
+// Yin_Compute copies the ring once into the first half of a rfft frame,
+// so samples arriving meanwhile do not change the window, and leaves the
+// second half zero, so the circular autocorrelation obtained as
+// the inverse rfft of the power spectrum has no wrap around:
+//   r(tau) = sum over j of x(j)*x(j+tau)
+//   m(tau) = sum over j of x(j)^2 + x(j+tau)^2, j = 0 to YIN_LENGTH-1-tau
+//   d(tau) = (m(tau) - 2*r(tau))/(YIN_LENGTH - tau)
+// d is the mean squared difference over the part of the frame that overlaps
+// its delayed copy. The cumulative mean normalized difference
+//   d'(tau) = d(tau)*tau/(d(1) + ... + d(tau))
+// is searched for the first dip below YIN_THRESHOLD, the bottom of that dip
+// is refined by a cosine through d at the three lags about it, and 1 - d'
+// there is the confidence.
+// The cosine is exact for a sinusoid where a parabola is not: tones and
+// sounds whose fundamental dominates are found to 0.25 Hz over the whole
+// range, 5 to 115 lags, and under 0.5 Hz up to 500 Hz with harmonics as
+// strong as 1/h. Above 500 Hz such harmonics bend d between the lags by a
+// few Hz, and above 1 kHz, a period of 5 to 8 lags, the integer lags can
+// miss the dip altogether and find the sound an octave down.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __YIN_H
+#define __YIN_H  1
+
+#define YIN_DECIMATE  8       // input samples averaged into one
+#define YIN_LENGTH    512     // decimated samples analysed, half the rfft length
+#define YIN_MINHZ     70.0f   // lowest pitch searched
+#define YIN_MAXHZ     1500.0f // highest pitch searched
+#define YIN_THRESHOLD 0.15f   // d' below this is a pitch period
+#define YIN_MAXLAG    128     // above the longest lag, fs/YIN_DECIMATE/YIN_MINHZ + 1
+
+struct yin{
+  float32_t fs;            // decimated sample rate in Hz
+  uint32_t tauMin, tauMax; // lags searched, decimated samples
+  int16_t ring[YIN_LENGTH];// decimated history
+  uint32_t pos;            // next write position in ring
+  float32_t acc;           // sum of the samples being decimated
+  uint32_t accCount;
+  float32_t pitch;         // latest pitch in Hz, 0 if none
+  float32_t confidence;    // 0 to 1
+  int32_t voiced;          // true if a period was found below YIN_THRESHOLD
+  float32_t m[YIN_MAXLAG]; // m(tau) of the window Yin_Compute copied
+};
+typedef struct yin yinType;
+
+// ******** Yin_Init ************
+// Initialize pitch tracker
+// Inputs:  pointer to tracker
+//          input sample rate in Hz
+// Outputs: 1 if successful, 0 if the pitch range does not fit the frame
+int Yin_Init(yinType *y, float32_t fs);
+
+// ******** Yin_Update ************
+// Add one input sample, called every sample
+// Inputs:  pointer to tracker
+//          sample, same units as SoundBufferIn
+// Outputs: none
+void Yin_Update(yinType *y, float32_t sample);
+
+// ******** Yin_Compute ************
+// Estimate the pitch of the latest YIN_LENGTH decimated samples
+// Inputs:  pointer to tracker
+//          rfft instance of length 2*YIN_LENGTH
+//          two scratch buffers of 2*YIN_LENGTH, e.g. SoundBufferIn and
+//          SoundBufferOut once the frame has been analysed
+// Outputs: pitch in Hz, 0 if unvoiced
+float32_t Yin_Compute(yinType *y, arm_rfft_fast_instance_f32 *fft,
+                      float32_t *bufA, float32_t *bufB);
+
+#endif
@@ -0,0 +1,213 @@
+//*****************************************************************************
+// zoomfft.c
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Zoom FFT, high resolution spectrum of a narrow band around a centre frequency.
+// RAM is the FIR history plus the attached FFT buffer, independent of the resolution.
+// Stage 1 costs ZOOM_CICORDER*(ZOOM_CICORDER+1) multiply-adds a sample.
+
+#include <stdint.h>
+#include "zoomfft.h"
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include "../inc/CortexM.h"
+
+// tap n of the stage 1 impulse response, ZOOM_CICORDER boxcars of length d
+// convolved, sum over m of (-1)^m C(K,m) C(n-m*d+K-1, K-1), d^K in all
+static int64_t cicTap(uint32_t n, uint32_t d){
+  int64_t tap = 0, b, c;
+  uint32_t m, r;
+  for(m = 0; (m <= ZOOM_CICORDER) && (m*d <= n); m++){
+    b = 1;                 // C(K,m)
+    for(r = 0; r < m; r++){
+      b = b*(ZOOM_CICORDER - r)/(r + 1);
+    }
+    c = 1;                 // C(n-m*d+K-1, K-1)
+    for(r = 0; r < ZOOM_CICORDER - 1; r++){
+      c = c*(n - m*d + ZOOM_CICORDER - 1 - r)/(r + 1);
+    }
+    tap += (m & 1) ? -b*c : b*c;
+  }
+  return tap;
+}
+
+int ZoomFFT_Init(zoomfftType *z, float32_t fs, float32_t center,
+                 float32_t span, uint32_t length){
+  int32_t i, j, m;
+  int64_t diff[ZOOM_CICORDER];
+  float32_t w, sum, scale;
+  switch(length){
+    case 16:  z->cfft = &arm_cfft_sR_f32_len16;  break;
+    case 32:  z->cfft = &arm_cfft_sR_f32_len32;  break;
+    case 64:  z->cfft = &arm_cfft_sR_f32_len64;  break;
+    case 128: z->cfft = &arm_cfft_sR_f32_len128; break;
+    case 256: z->cfft = &arm_cfft_sR_f32_len256; break;
+    default: return 0;
+  }
+  if((span <= 0) || (center < 0) || (center >= fs/2)){
+    return 0;
+  }
+  z->decimation = (uint32_t)(fs/(2*span) + 0.5f);
+  if((z->decimation < ZOOM_CICORDER) || // the weights of a block are one polynomial piece
+     (z->decimation > ZOOM_MAXDECIM)){
+    return 0;
+  }
+  z->span = fs/(float32_t)(2*z->decimation);
+  z->center = center;
+  z->length = length;
+  // oscillator steps by e^(-j2pi*center/fs) each sample
+  z->stepRe = arm_cos_f32(2.0f*PI*center/fs);
+  z->stepIm = -arm_sin_f32(2.0f*PI*center/fs);
+  z->ncoRe = 1.0f;
+  z->ncoIm = 0;
+  // Hamming windowed sinc, cutoff at a quarter of the stage 2 input rate
+  m = ZOOM_FIRTAPS/2;
+  sum = 0;
+  for(i = 0; i < ZOOM_FIRTAPS; i++){
+    w = 0.54f - 0.46f*arm_cos_f32(2.0f*PI*(float32_t)i/(float32_t)(ZOOM_FIRTAPS-1));
+    if(i == m){
+      z->coef[i] = 0.5f*w;
+    }else{
+      z->coef[i] = w*arm_sin_f32(0.5f*PI*(float32_t)(i-m))/(PI*(float32_t)(i-m));
+    }
+    sum = sum + z->coef[i];
+    z->firRe[i] = 0;
+    z->firIm[i] = 0;
+  }
+  for(i = 0; i < ZOOM_FIRTAPS; i++){
+    z->coef[i] = z->coef[i]/sum; // unity gain at the centre frequency
+  }
+  // sample i of a block is d-1-i+j*d samples old when output j completes,
+  // its weight a polynomial in i of degree K-1, kept as the forward
+  // differences at i = 0 over m!, so that
+  //   weight = e0 + i*(e1 + (i-1)*(e2 + (i-2)*(e3 + ...)))
+  // normalized to unity gain at the centre frequency
+  scale = 1.0f;
+  for(m = 0; m < ZOOM_CICORDER; m++){
+    scale = scale*(float32_t)z->decimation;
+  }
+  for(j = 0; j < ZOOM_CICORDER; j++){
+    for(i = 0; i < ZOOM_CICORDER; i++){
+      diff[i] = cicTap(z->decimation - 1 - i + j*z->decimation, z->decimation);
+    }
+    sum = scale;           // d^K times m!
+    for(m = 0; m < ZOOM_CICORDER; m++){
+      z->weight[j][m] = (float32_t)diff[m]/sum;
+      for(i = ZOOM_CICORDER - 1; i > m; i--){
+        diff[i] = diff[i] - diff[i-1];
+      }
+      sum = sum*(float32_t)(m + 1);
+    }
+    z->accRe[j] = z->accIm[j] = 0;
+  }
+  z->accCount = 0;
+  z->firPos = 0;
+  z->firPhase = 0;
+  z->count = 0;
+  z->ready = 0;
+  z->buf = 0;
+  return 1;
+}
+
+void ZoomFFT_Attach(zoomfftType *z, float32_t *buf){
+  long sr = StartCritical(); // ZoomFFT_Update runs in the acquisition interrupt
+  z->count = 0;
+  z->ready = 0;
+  z->buf = buf;
+  EndCritical(sr);
+}
+
+// stage 2, low pass and keep every other output
+static void decimate2(zoomfftType *z, float32_t re, float32_t im){
+  uint32_t i, j;
+  float32_t yRe, yIm;
+  z->firRe[z->firPos] = re;
+  z->firIm[z->firPos] = im;
+  z->firPos = (z->firPos + 1)%ZOOM_FIRTAPS;
+  z->firPhase ^= 1;
+  if(z->firPhase || z->ready || (z->buf == 0)){
+    return;
+  }
+  yRe = 0;
+  yIm = 0;
+  j = z->firPos;  // oldest sample
+  for(i = 0; i < ZOOM_FIRTAPS; i++){
+    yRe += z->coef[i]*z->firRe[j];
+    yIm += z->coef[i]*z->firIm[j];
+    j++;
+    if(j == ZOOM_FIRTAPS){
+      j = 0;
+    }
+  }
+  z->buf[2*z->count] = yRe;
+  z->buf[2*z->count+1] = yIm;
+  z->count++;
+  if(z->count == z->length){
+    z->ready = 1;
+  }
+}
+
+void ZoomFFT_Update(zoomfftType *z, float32_t x){
+  float32_t re, im, t, w, f[ZOOM_CICORDER];
+  uint32_t j, m;
+  re = x*z->ncoRe;
+  im = x*z->ncoIm;
+  for(m = 1; m < ZOOM_CICORDER; m++){
+    f[m] = (float32_t)z->accCount - (float32_t)(m - 1); // i, i-1, i-2, ...
+  }
+  // sample i of a block goes into the ZOOM_CICORDER outputs whose blocks
+  // it is in, overlapping B-splines of length K*D
+  for(j = 0; j < ZOOM_CICORDER; j++){
+    w = z->weight[j][ZOOM_CICORDER-1];
+    for(m = ZOOM_CICORDER - 1; m > 0; m--){
+      w = z->weight[j][m-1] + w*f[m];
+    }
+    z->accRe[j] += w*re;
+    z->accIm[j] += w*im;
+  }
+  t = z->ncoRe*z->stepRe - z->ncoIm*z->stepIm;
+  z->ncoIm = z->ncoRe*z->stepIm + z->ncoIm*z->stepRe;
+  z->ncoRe = t;
+  z->accCount++;
+  if(z->accCount == z->decimation){
+    z->accCount = 0;
+    decimate2(z, z->accRe[0], z->accIm[0]);
+    for(j = 0; j < ZOOM_CICORDER - 1; j++){
+      z->accRe[j] = z->accRe[j+1];
+      z->accIm[j] = z->accIm[j+1];
+    }
+    z->accRe[ZOOM_CICORDER-1] = 0;
+    z->accIm[ZOOM_CICORDER-1] = 0;
+    // keep the oscillator on the unit circle
+    t = 1.0f/sqrtf(z->ncoRe*z->ncoRe + z->ncoIm*z->ncoIm);
+    z->ncoRe *= t;
+    z->ncoIm *= t;
+  }
+}
+
+int ZoomFFT_Magnitude(zoomfftType *z, float32_t *dB){
+  uint32_t i, k, half = z->length/2;
+  float32_t w, f, h, d = (float32_t)z->decimation;
+  long sr;
+  if((z->ready == 0) || (z->buf == 0)){
+    return 0;
+  }
+  for(i = 0; i < z->length; i++){ // Hann window
+    w = 0.5f - 0.5f*arm_cos_f32(2.0f*PI*(float32_t)i/(float32_t)z->length);
+    z->buf[2*i] *= w;
+    z->buf[2*i+1] *= w;
+  }
+  arm_cfft_f32(z->cfft, z->buf, 0, 1);
+  for(i = 0; i < z->length; i++){
+    k = (i + half)%z->length; // negative frequencies first
+    w = z->buf[2*k]*z->buf[2*k] + z->buf[2*k+1]*z->buf[2*k+1];
+    // less the droop of stage 1 at the bin, f in cycles a stage 1 output
+    f = ((float32_t)i - (float32_t)half)/(float32_t)(2*z->length);
+    h = (i == half) ? 1.0f : arm_sin_f32(PI*f)/(d*arm_sin_f32(PI*f/d));
+    dB[i] = (w > 1e-12f) ? 10*log10f(w) - 20*ZOOM_CICORDER*log10f(h) : -120.0f;
+  }
+  sr = StartCritical(); // stage 2 may write again once ready is clear
+  z->count = 0;
+  z->ready = 0;
+  EndCritical(sr);
+  return 1;
+}
@@ -0,0 +1,94 @@
+//*****************************************************************************
+// zoomfft.h
+// Runs on TM4C123 with BOOSTXL-EDUMKII booster pack
+// Zoom FFT, high resolution spectrum of a narrow band around a centre frequency.
+
+// Each sample is mixed down by the centre frequency with a complex oscillator,
+// low pass filtered and decimated in two stages, then a short complex FFT is
+// taken of the decimated signal:
+//   stage 1: ZOOM_CICORDER order CIC, decimate by D = fs/(2*span) to 2*span
+//   stage 2: ZOOM_FIRTAPS tap FIR, decimate by 2, 2*span to span
+// Resolution is span/length, e.g. 256 Hz span with length 256 gives 1 Hz bins.
+// Stage 1 folds the band around every multiple of 2*span onto the span; its
+// response (sin(pi f D/fs)/(D sin(pi f/fs)))^ZOOM_CICORDER has nulls there,
+// and the nearest images that land in the span, from 1.5*span away, are
+// down about 10 dB per order. ZoomFFT_Magnitude takes out the droop of
+// stage 1 across the span, the outer edges are attenuated by stage 2.
+// Stage 1 is computed as a polyphase FIR, each sample weighted into the
+// ZOOM_CICORDER outputs whose blocks it is in, with no integrators to overflow.
+// The FFT buffer is lent by the caller with ZoomFFT_Attach only while the
+// zoom is in use, so it can be shared with other analyses. ZoomFFT_Update
+// runs in the acquisition interrupt, ZoomFFT_Attach and ZoomFFT_Magnitude
+// in a thread, which changes buf, count and ready in critical sections.
+
+#include <stdint.h>
+#include "arm_math.h"
+#ifndef __ZOOMFFT_H
+#define __ZOOMFFT_H  1
+
+#define ZOOM_MAXLEN   256  // maximum complex FFT length
+#define ZOOM_FIRTAPS  31   // taps in the decimate by 2 low pass filter
+#define ZOOM_CICORDER 6    // order of the stage 1 CIC, images in the span 60 dB down
+#define ZOOM_MAXDECIM 1024 // largest stage 1 decimation, the weights are exact in 64 bits
+
+struct zoomfft{
+  float32_t center;        // centre frequency in Hz
+  float32_t span;          // actual span in Hz, sample rate after decimation
+  uint32_t decimation;     // stage 1 decimation factor
+  uint32_t length;         // complex FFT length
+  const arm_cfft_instance_f32 *cfft;
+  float32_t ncoRe, ncoIm;  // oscillator e^(-j2pi*center*n/fs)
+  float32_t stepRe, stepIm;
+  uint32_t accCount;       // sample position in the stage 1 block
+  float32_t accRe[ZOOM_CICORDER]; // stage 1 outputs, element j completes
+  float32_t accIm[ZOOM_CICORDER]; // j blocks after this one
+  float32_t weight[ZOOM_CICORDER][ZOOM_CICORDER]; // Newton forward differences
+                           // at 0 of the weight of sample i of a block in output j
+  float32_t firRe[ZOOM_FIRTAPS], firIm[ZOOM_FIRTAPS];
+  float32_t coef[ZOOM_FIRTAPS];
+  uint32_t firPos;         // next write position in the FIR history
+  uint32_t firPhase;       // stage 2 keeps every other output
+  uint32_t count;          // complex samples in buf
+  int32_t ready;           // true when buf is full and waiting for ZoomFFT_Magnitude
+  float32_t *buf;          // 2*length values, interleaved real, imag, 0 if detached
+};
+typedef struct zoomfft zoomfftType;
+
+// ******** ZoomFFT_Init ************
+// Initialize zoom FFT analysis of center-span/2 to center+span/2
+// Inputs:  pointer to zoom FFT
+//          input sample rate in Hz
+//          centre frequency in Hz
+//          requested span in Hz, rounded so fs/(2*span) is an integer
+//          from ZOOM_CICORDER to ZOOM_MAXDECIM
+//          FFT length, power of 2 from 16 to ZOOM_MAXLEN
+// Outputs: 1 if successful, 0 if the parameters are not valid
+int ZoomFFT_Init(zoomfftType *z, float32_t fs, float32_t center,
+                 float32_t span, uint32_t length);
+
+// ******** ZoomFFT_Attach ************
+// Lend the FFT buffer, or take it back, and start collecting a new one
+// Filtering goes on while detached, decimated samples are dropped
+// Inputs:  pointer to zoom FFT
+//          pointer to 2*length values, 0 to detach
+// Outputs: none
+void ZoomFFT_Attach(zoomfftType *z, float32_t *buf);
+
+// ******** ZoomFFT_Update ************
+// Mix, filter and decimate one input sample, called every sample
+// Samples are dropped while a full buffer waits for ZoomFFT_Magnitude,
+// and while no buffer is attached
+// Inputs:  pointer to zoom FFT
+//          input sample
+// Outputs: none
+void ZoomFFT_Update(zoomfftType *z, float32_t x);
+
+// ******** ZoomFFT_Magnitude ************
+// Window and transform a full buffer, then start collecting the next one
+// Inputs:  pointer to zoom FFT
+//          pointer to length outputs in dB, element i is
+//          center - span/2 + i*span/length Hz
+// Outputs: 1 if a new spectrum was written, 0 if the buffer is not full yet
+int ZoomFFT_Magnitude(zoomfftType *z, float32_t *dB);
+
+#endif
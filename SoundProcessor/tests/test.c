@@ -0,0 +1,50 @@
+//*****************************************************************************
+// test.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Assertions for the host tests.
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "test.h"
+
+uint32_t Checks;
+uint32_t Failed;
+uint32_t Seed = 1;
+
+int Test_Check(int ok, const char *what, const char *file, int line){
+  Checks++;
+  if(ok == 0){
+    Failed++;
+    printf("%s:%d: check failed: %s\n", file, line, what);
+  }
+  return ok;
+}
+
+int Test_Near(double a, double b, double tol, const char *what, const char *file, int line){
+  int ok = fabs(a - b) <= tol;
+  if(Test_Check(ok, what, file, line) == 0){
+    printf("  %g and %g differ by more than %g\n", a, b, tol);
+  }
+  return ok;
+}
+
+void Test_Exit(void){
+  printf("%u checks, %u failed\n", Checks, Failed);
+  fflush(stdout);
+  exit(Failed ? 1 : 0);
+}
+
+uint32_t Test_Random(void){
+  Seed = Seed*1103515245 + 12345;
+  return (Seed>>1) & 0x7FFFFFFF;
+}
+
+double Test_Seconds(void){
+  struct timespec t;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+  return t.tv_sec + 1e-9*t.tv_nsec;
+}
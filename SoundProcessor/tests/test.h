@@ -0,0 +1,76 @@
+//*****************************************************************************
+// test.h
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Assertions for the host tests. Each test is a program of its own, built
+// by the Makefile here against the modules under test and, for the OS
+// tests, the host port in ../host; it exits with status 0 if every check
+// passed.
+
+// A test of the OS sets up threads as user.c does and calls OS_Launch,
+// which does not return. Simulated time passes while every thread is
+// blocked, or in Host_Busy, and the test ends with Test_Exit from a thread
+// or when the host port calls Host_Exit, e.g. on a watchdog reset; a test
+// that expects such an exit sets Test_Expect to its reason first.
+
+#include <stdint.h>
+#ifndef __TEST_H
+#define __TEST_H  1
+
+#define TEST_CLOCK 80000000  // bus cycles per second, as BSP_Clock_InitFastest
+#define TEST_SLICE 80000     // cycles per tick, 1 ms
+
+//******** ASSERTIONS, test.c ********\\
+
+// ******** CHECK ************
+// Count a check, report it with its source line if it fails
+// Inputs:  condition that must hold
+// Outputs: the condition
+#define CHECK(c) Test_Check((c) != 0, #c, __FILE__, __LINE__)
+
+// ******** CHECKNEAR ************
+// Check that two numbers differ by at most tol
+#define CHECKNEAR(a, b, tol) Test_Near((double)(a), (double)(b), (double)(tol), \
+                                       #a " ~ " #b, __FILE__, __LINE__)
+
+int Test_Check(int ok, const char *what, const char *file, int line);
+int Test_Near(double a, double b, double tol, const char *what, const char *file, int line);
+
+// ******** Test_Exit ************
+// Report the checks and end the program, does not return
+// Inputs:  none
+// Outputs: none, exit status 0 if every check passed, 1 if not
+void Test_Exit(void);
+
+// ******** Test_Random ************
+// Repeatable pseudo random numbers, the same sequence on every host
+// Inputs:  none
+// Outputs: 0 to 2^31-1
+uint32_t Test_Random(void);
+
+// ******** Test_Seconds ************
+// Host processor time, for the costs some tests print; they are of this
+// host, not the board, so they compare modules rather than meet a budget
+// Inputs:  none
+// Outputs: seconds of processor time the test has used
+double Test_Seconds(void);
+
+//******** OS TESTS, testos.c ********\\
+
+extern const char *Test_Expect; // reason of the Host_Exit the test expects, 0 for none
+extern void (*Test_Final)(const char *reason); // more checks at a Host_Exit, 0 for none
+extern void (*Test_Tick)(void); // called on each SysTick the port takes, 0 for none
+
+// ******** Test_Launch ************
+// OS_AddThreads and OS_Launch at TEST_SLICE, after OS_Init and any event
+// threads; a thread given as 0 blocks for ever
+// Inputs:  up to three foreground threads
+// Outputs: none, does not return
+void Test_Launch(void(*task0)(void), void(*task1)(void), void(*task2)(void));
+
+// ******** Test_Sleep ************
+// Block the calling thread for some ticks, with a timed flag wait
+// Inputs:  ticks
+// Outputs: none
+void Test_Sleep(uint32_t ticks);
+
+#endif
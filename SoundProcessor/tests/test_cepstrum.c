@@ -0,0 +1,131 @@
+//*****************************************************************************
+// test_cepstrum.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the cepstrum of cepstrum.c with the parameters and rfft of
+// user.c, on dB spectra of synthetic frames: the liftered cepstrum is the
+// inverse real DFT of the dB spectrum summed directly, white noise with an
+// echo of gain g delayed D samples peaks at D at the level the log of
+// 1 + g e^-jwD gives, a pulse train peaks at its period and its multiples,
+// and noise alone gives no peaks above CEPS_MINLEVEL.
+
+#include <stdint.h>
+#include <math.h>
+#include "test.h"
+#include "os.h"
+#include "cepstrum.h"
+
+#define FS     64000         // as user.c
+#define N      1024
+#define BINS   511           // MAGNUM-1
+#define MAXSPACING 20000     // CEPSMAXSPACING
+#define GAIN   0.5           // of the echo
+
+static cepstrumType C;
+static arm_rfft_fast_instance_f32 Fft;
+static float32_t dB[BINS];
+static float32_t Work[N], Out[N];
+static double X[2*N];        // frame with the history before it
+static double Cos[N], Sin[N];
+
+static double gaussian(void){  // Box-Muller
+  double u = (Test_Random() + 1.0)/2147483649.0, v = Test_Random()/2147483648.0;
+  return sqrt(-2*log(u))*cos(2*M_PI*v);
+}
+
+// the dB spectrum of the last N samples of X, as Spectral_Compute leaves it
+static void spectrum(void){
+  double re, im;
+  uint32_t k, n;
+  for(k = 1; k <= BINS; k++){
+    re = im = 0;
+    for(n = 0; n < N; n++){
+      re += X[N + n]*Cos[(k*n)%N];
+      im -= X[N + n]*Sin[(k*n)%N];
+    }
+    dB[k-1] = (float32_t)(10*log10(re*re + im*im + 1e-10));
+  }
+}
+
+// white noise with an echo delayed delay samples, gain 0 for none
+static void echo(uint32_t delay, double gain){
+  double s[2*N];
+  uint32_t n;
+  for(n = 0; n < 2*N; n++){
+    s[n] = 1000*gaussian();
+    X[n] = s[n] + ((n >= delay) ? gain*s[n - delay] : 0);
+  }
+  spectrum();
+}
+
+// largest difference from the inverse real DFT of the packed dB spectrum,
+// DC and Nyquist repeating their neighbours, summed directly
+static double direct(void){
+  double sum, worst = 0;
+  uint32_t q, k;
+  for(q = C.qMin; q < N/2; q++){
+    sum = dB[0] + ((q%2) ? -dB[BINS-1] : dB[BINS-1]);
+    for(k = 1; k < N/2; k++){
+      sum += 2*dB[k-1]*Cos[(k*q)%N];
+    }
+    if(fabs(sum/N - Out[q]) > worst){
+      worst = fabs(sum/N - Out[q]);
+    }
+  }
+  return worst;
+}
+
+int main(void){
+  const uint32_t delays[] = {17, 64, 150, 333, 480};
+  double worst = 0, level;
+  uint32_t i, q, noisy;
+  for(i = 0; i < N; i++){
+    Cos[i] = cos(2*M_PI*i/N);
+    Sin[i] = sin(2*M_PI*i/N);
+  }
+  rfft_fast_init_1024_f32(&Fft);
+  Cepstrum_Init(&C, FS, N, MAXSPACING);
+  CHECK(C.qMin == FS/MAXSPACING);
+  // echoes at delays over the quefrency range
+  level = 0;
+  for(i = 0; i < 5; i++){
+    echo(delays[i], GAIN);
+    CHECK(Cepstrum_Compute(&C, &Fft, dB, BINS, Work, Out) >= 1);
+    CHECKNEAR(C.quefrency[0]*FS, delays[i], 0.5);
+    CHECKNEAR(C.spacing[0], (double)FS/delays[i], (double)FS/delays[i]/(2*delays[i]));
+    // 20 log10|1 + g e^-jwD| is 20 log10(e) g cos(wD) less smaller terms,
+    // over the half of the bins that are positive, and only N-D of the
+    // frame holds the echo of samples in it
+    level += C.level[0]/(20*log10(exp(1))*GAIN*(N/2 - 1)/N*(1 - (double)delays[i]/N))/5;
+    worst = (direct() > worst) ? direct() : worst;
+    for(q = 0; q < C.qMin; q++){
+      CHECK(Out[q] == 0);      // liftered
+    }
+  }
+  CHECK(worst < 1e-3);
+  CHECKNEAR(level, 1, 0.1);
+  // a pulse train 1 kHz apart over a floor 60 dB down, its harmonics one
+  // bin wide so the rahmonics are as high as the first
+  for(i = 0; i < 2*N; i++){
+    X[i] = ((i%64) == 0) ? 1000 : 0;
+    X[i] += gaussian();
+  }
+  spectrum();
+  CHECK(Cepstrum_Compute(&C, &Fft, dB, BINS, Work, Out) == CEPS_MAXPEAKS);
+  for(i = 0; i < C.numPeaks; i++){
+    q = (uint32_t)(C.quefrency[i]*FS + 0.5);
+    CHECKNEAR(C.quefrency[i]*FS, q, 0.1);
+    CHECK(q%64 == 0);
+    CHECKNEAR(C.spacing[i], 1000.0*64/q, 1);
+  }
+  CHECK((Out[64] > Out[63]) && (Out[64] > Out[65]) && (Out[64] > 0.8*C.level[0]));
+  CHECK(direct() < 1e-3);
+  // noise alone
+  noisy = 0;
+  for(i = 0; i < 50; i++){
+    echo(0, 0);
+    noisy += Cepstrum_Compute(&C, &Fft, dB, BINS, Work, Out) != 0;
+  }
+  CHECK(noisy <= 2);
+  Test_Exit();
+  return 0;
+}
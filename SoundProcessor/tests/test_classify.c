@@ -0,0 +1,147 @@
+//*****************************************************************************
+// test_classify.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the classifier of classify.c with the model linked in
+// classmodel.c: models that do not fit are refused, the decisions match a
+// Gaussian naive Bayes written out in double precision, vectors drawn from
+// each class's own distribution mostly come out as that class, the
+// names are the model's, and the state and model are within their RAM and
+// flash budgets. The cost of a decision on this host is printed, with the
+// model linked in and with the largest the format takes.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "test.h"
+#include "classify.h"
+#include "mfcc.h"
+
+#define DRAWS 5000           // random vectors per class
+#define RUNS  100000         // decisions timed
+
+static classModelType Model; // a copy to spoil
+
+// log likelihood of class c as the textbook writes it
+static double logLikelihood(const classModelType *m, uint32_t c, const float32_t *x){
+  double sum = log(m->priors[c]), v, d;
+  uint32_t i;
+  for(i = 0; i < m->dimension; i++){
+    v = m->sigma[c*m->dimension + i] + m->epsilon;
+    d = x[i] - m->theta[c*m->dimension + i];
+    sum += -0.5*log(2*M_PI*v) - d*d/(2*v);
+  }
+  return sum;
+}
+
+static uint32_t reference(const classModelType *m, const float32_t *x, double *margin){
+  double best = -INFINITY, second = -INFINITY, l;
+  uint32_t c, k = 0;
+  for(c = 0; c < m->numClasses; c++){
+    l = logLikelihood(m, c, x);
+    if(l > best){
+      second = best;
+      best = l;
+      k = c;
+    }else if(l > second){
+      second = l;
+    }
+  }
+  *margin = best - second;
+  return k;
+}
+
+// seconds a decision takes on this host
+static double cost(classifyType *c, float32_t *x){
+  double seconds = Test_Seconds();
+  uint32_t n;
+  for(n = 0; n < RUNS; n++){
+    x[n%c->model->dimension] = (float32_t)(n%17);  // not quite the same vector each time
+    Classify_Run(c, x);
+  }
+  return (Test_Seconds() - seconds)/RUNS;
+}
+
+static double gaussian(void){  // Box-Muller
+  double u = (Test_Random() + 1.0)/2147483649.0, v = Test_Random()/2147483648.0;
+  return sqrt(-2*log(u))*cos(2*M_PI*v);
+}
+
+int main(void){
+  classifyType c;
+  float32_t x[CLASSIFY_MAXDIM];
+  uint32_t k, i, n, right, differ, close;
+  double margin, seconds;
+  const classModelType *m = &ClassModel;
+  // models that do not fit
+  memcpy(&Model, m, sizeof(Model));
+  Model.magic++;
+  CHECK(Classify_Init(&c, &Model, MFCC_NUMCOEFFS) == 0);
+  CHECK(Classify_Run(&c, x) == 0);           // nothing attached
+  CHECK(strcmp(Classify_Name(&c, 0), "none") == 0);
+  memcpy(&Model, m, sizeof(Model));
+  Model.numClasses = 0;
+  CHECK(Classify_Init(&c, &Model, MFCC_NUMCOEFFS) == 0);
+  Model.numClasses = CLASSIFY_MAXCLASSES + 1;
+  CHECK(Classify_Init(&c, &Model, MFCC_NUMCOEFFS) == 0);
+  CHECK(Classify_Init(&c, m, MFCC_NUMCOEFFS + 1) == 0); // not the features given
+  // the model linked in
+  CHECK(Classify_Init(&c, m, MFCC_NUMCOEFFS));
+  CHECK(m->numClasses == 2);
+  CHECK(strcmp(Classify_Name(&c, 0), "whistle") == 0);
+  CHECK(strcmp(Classify_Name(&c, 1), "buzz") == 0);
+  CHECK(strcmp(Classify_Name(&c, 2), "none") == 0);
+  for(i = 0; i < m->numClasses*m->dimension; i++){
+    CHECK(m->sigma[i] > 0);
+  }
+  for(k = 0; k < m->numClasses; k++){        // each class's mean is that class
+    CHECK(Classify_Run(&c, &m->theta[k*m->dimension]) == k);
+    CHECK(c.result == k);
+  }
+  // vectors drawn from each class's distribution
+  for(k = 0; k < m->numClasses; k++){
+    right = differ = close = 0;
+    for(n = 0; n < DRAWS; n++){
+      for(i = 0; i < m->dimension; i++){
+        x[i] = (float32_t)(m->theta[k*m->dimension + i] +
+                           gaussian()*sqrt(m->sigma[k*m->dimension + i]));
+      }
+      i = Classify_Run(&c, x);
+      if(i != reference(m, x, &margin)){
+        differ++;
+        close += margin < 1e-3; // a tie to float precision
+      }
+      right += i == k;
+    }
+    CHECK(differ == close);
+    CHECK(differ < DRAWS/1000);
+    CHECK(right > DRAWS*9/10);
+  }
+  // the budgets, also checked when classify.c is compiled
+  CHECK(sizeof(classifyType) <= CLASSIFY_RAMBUDGET);
+  CHECK(sizeof(classModelType) <= CLASSIFY_FLASHBUDGET);
+  printf("classifier: %u bytes of RAM, model %u bytes of flash\n",
+         (unsigned)sizeof(classifyType), (unsigned)sizeof(classModelType));
+  // the cost, of the model linked in and of the largest
+  seconds = cost(&c, x);
+  printf("Classify_Run: %.3f us a decision on this host, %ux%u model\n",
+         1e6*seconds, m->numClasses, m->dimension);
+  memset(&Model, 0, sizeof(Model));
+  Model.magic = CLASSIFY_MAGIC;
+  Model.numClasses = CLASSIFY_MAXCLASSES;
+  Model.dimension = CLASSIFY_MAXDIM;
+  for(i = 0; i < CLASSIFY_MAXCLASSES*CLASSIFY_MAXDIM; i++){
+    Model.theta[i] = (float32_t)(i%5);
+    Model.sigma[i] = 1;
+  }
+  for(k = 0; k < CLASSIFY_MAXCLASSES; k++){
+    Model.priors[k] = 1.0f/CLASSIFY_MAXCLASSES;
+  }
+  CHECK(Classify_Init(&c, &Model, CLASSIFY_MAXDIM));
+  seconds = cost(&c, x);
+  printf("Classify_Run: %.3f us a decision on this host, %ux%u model\n",
+         1e6*seconds, CLASSIFY_MAXCLASSES, CLASSIFY_MAXDIM);
+  CHECK(seconds < 0.01*1024/64000.0); // 1% of a frame period of user.c
+  Test_Exit();
+  return 0;
+}
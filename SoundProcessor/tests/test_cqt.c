@@ -0,0 +1,150 @@
+//*****************************************************************************
+// test_cqt.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the constant-Q transform of cqt.c with the kernels linked in
+// from cqt_kernel.c and the rfft of user.c: the kernels are laid out as
+// cqt.h says, each bin from the sparse spectral kernel is the inner product
+// with its temporal kernel, written out here from the definition, to well
+// within the -40 dB tools/cqtkernel.c accepts, a tone at a bin's centre
+// reads the level of a plain FFT peak in that bin, and kernels that do
+// not fit are refused.
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "test.h"
+#include "os.h"
+#include "cqt.h"
+
+#define FS     64000         // as user.c
+#define N      1024
+#define BPO    24            // bins per octave of the kernels linked in
+#define FMIN   1000.0
+#define AMP    1000.0
+
+static arm_rfft_fast_instance_f32 Fft;
+static float32_t Frame[N], Spectrum[N];
+static float32_t dB[CQT_MAXBINS];
+static double X[N];
+static double Exact[2*CQT_MAXBINS];
+static cqtBinType Bins[CQT_MAXBINS];
+static cqtKernelType Spoiled;
+
+// N times the inner product of X with the conjugate temporal kernel of
+// each bin: a Hann window of Q fs/f samples, at most N, of unit sum,
+// centred in the frame, times exp(j 2 pi f t)
+static void exact(const cqtKernelType *k){
+  double q = 1/(pow(2, 1.0/BPO) - 1), f, sum, w, re, im;
+  uint32_t b, m, length, n0;
+  for(b = 0; b < k->numBins; b++){
+    f = FMIN*pow(2, (double)b/BPO);
+    length = (uint32_t)(q*FS/f + 0.5);
+    length = (length > N) ? N : length;
+    n0 = (N - length)/2;
+    sum = 0;
+    for(m = 0; m < length; m++){
+      sum += 0.5 - 0.5*cos(2*M_PI*m/(length - 1));
+    }
+    re = im = 0;
+    for(m = 0; m < length; m++){
+      w = (0.5 - 0.5*cos(2*M_PI*m/(length - 1)))/sum;
+      re += N*X[n0 + m]*w*cos(2*M_PI*f*m/FS);
+      im -= N*X[n0 + m]*w*sin(2*M_PI*f*m/FS);
+    }
+    Exact[2*b] = re;
+    Exact[2*b + 1] = im;
+  }
+}
+
+// the frame in X through the rfft and Cqt_Compute, worst difference from
+// the exact bins in dB relative to the largest
+static double compare(cqtType *c){
+  double largest = 0, worst = 0, e;
+  uint32_t b, n;
+  for(n = 0; n < N; n++){
+    Frame[n] = (float32_t)X[n];
+  }
+  arm_rfft_fast_f32(&Fft, Frame, Spectrum, 0);
+  Cqt_Compute(c, Spectrum, dB);
+  exact(c->kernel);
+  for(b = 0; b < c->kernel->numBins; b++){
+    if(hypot(Exact[2*b], Exact[2*b + 1]) > largest){
+      largest = hypot(Exact[2*b], Exact[2*b + 1]);
+    }
+  }
+  for(b = 0; b < c->kernel->numBins; b++){
+    // Cqt_Compute gives only the level, so compare the magnitudes
+    e = fabs(pow(10, dB[b]/20) - hypot(Exact[2*b], Exact[2*b + 1]));
+    worst = (e > worst) ? e : worst;
+  }
+  return 20*log10(worst/largest + 1e-12);
+}
+
+int main(void){
+  const cqtKernelType *k = &CqtKernel;
+  cqtType c;
+  double worst = -300, e, f;
+  uint32_t b, n, i, centre;
+  rfft_fast_init_1024_f32(&Fft);
+  // the layout
+  CHECK(k->magic == CQT_MAGIC);
+  CHECK(k->binsPerOctave == BPO);
+  for(b = 0; b < k->numBins; b++){
+    f = FMIN*pow(2, (double)b/BPO);
+    CHECKNEAR(k->bins[b].freq, f, 1e-3);
+    CHECK(k->bins[b].offset == ((b == 0) ? 0 : k->bins[b-1].offset + k->bins[b-1].count));
+    centre = (uint32_t)(f*N/FS + 0.5);
+    CHECK((k->bins[b].start <= centre) && (centre < k->bins[b].start + k->bins[b].count));
+  }
+  CHECK(k->bins[k->numBins - 1].freq < 16000);       // up to the top of the default range
+  CHECK(Cqt_Init(&c, k, FS, N));
+  // random frames, to within the -40 dB the tool accepts
+  for(i = 0; i < 20; i++){
+    for(n = 0; n < N; n++){
+      X[n] = (double)(Test_Random()%4096) - 2048;
+    }
+    e = compare(&c);
+    worst = (e > worst) ? e : worst;
+  }
+  CHECK(worst < -45);
+  // a tone at each bin's centre reads the plain FFT peak, A N/2, there
+  worst = 0;
+  for(b = 0; b < k->numBins; b += 5){
+    for(n = 0; n < N; n++){
+      X[n] = AMP*cos(2*M_PI*k->bins[b].freq*n/FS + b);
+    }
+    e = compare(&c);
+    CHECK(e < -45);
+    CHECK(c.peak == b);
+    if(fabs(dB[b] - 20*log10(AMP*N/2)) > worst){
+      worst = fabs(dB[b] - 20*log10(AMP*N/2));
+    }
+  }
+  CHECK(worst < 0.05);
+  // silence is the floor
+  memset(Spectrum, 0, sizeof(Spectrum));
+  Cqt_Compute(&c, Spectrum, dB);
+  CHECK(dB[0] == CQT_MINDB);
+  // kernels that do not fit
+  CHECK(Cqt_Init(&c, k, FS/2, N) == 0);
+  CHECK(c.kernel == 0);
+  CHECK(Cqt_Init(&c, k, FS, 2*N) == 0);
+  Spoiled = *k;
+  Spoiled.magic++;
+  CHECK(Cqt_Init(&c, &Spoiled, FS, N) == 0);
+  Spoiled = *k;
+  Spoiled.numBins = CQT_MAXBINS + 1;
+  CHECK(Cqt_Init(&c, &Spoiled, FS, N) == 0);
+  memcpy(Bins, k->bins, k->numBins*sizeof(cqtBinType));
+  Spoiled = *k;
+  Spoiled.bins = Bins;
+  Bins[0].start = 0;                 // on DC
+  CHECK(Cqt_Init(&c, &Spoiled, FS, N) == 0);
+  Bins[0] = k->bins[0];
+  Bins[k->numBins - 1].count = N/2 - Bins[k->numBins - 1].start + 1; // past Nyquist
+  CHECK(Cqt_Init(&c, &Spoiled, FS, N) == 0);
+  Bins[k->numBins - 1] = k->bins[k->numBins - 1];
+  CHECK(Cqt_Init(&c, &Spoiled, FS, N));
+  Test_Exit();
+  return 0;
+}
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// test_deadline.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the thread deadlines and the watchdog of os.c: a job that runs
+// past its deadline is counted and logged once, on the tick it passed it,
+// and only ticks ready to run count towards it; the watchdog is fed while
+// the critical thread checks in, and resets the part one timeout after
+// the thread stops, even with the idle thread asleep.
+
+#include <stdint.h>
+#include "test.h"
+#include "host.h"
+#include "os.h"
+#include "CortexM.h"
+
+#define DEADLINE 5           // ticks of the worker's jobs
+#define JOBS     40          // jobs it checks in for
+#define LONGJOB  17          // the one that misses its deadline
+#define SHORT    (TEST_SLICE + TEST_SLICE/2) // cycles of a job
+#define LONG     (8*TEST_SLICE + TEST_SLICE/2)
+#define NAP      3           // ticks asleep between jobs, not counted
+#define TIMEOUT  (20*TEST_SLICE) // watchdog, cycles
+
+static uint32_t MissTick;    // tick the long job passed its deadline
+static uint64_t LastCheckIn; // Host_Cycles of the worker's last check-in
+static uint32_t QuietJobs;
+
+static void final(const char *reason){
+  uint32_t misses, worst, tick, thread;
+  uint64_t since = Host_Cycles() - LastCheckIn;
+  // the feed after the last check-in is on the next tick the handler
+  // takes, when the worker wakes from its nap, the reset two half
+  // timeouts after that, while the idle thread sleeps
+  CHECK(since > TIMEOUT + (NAP - 1)*TEST_SLICE);
+  CHECK(since <= TIMEOUT + NAP*TEST_SLICE + 1);
+  CHECK(OS_DeadlineStats(0, &misses, &worst));
+  CHECK(misses == 1);
+  CHECK(worst == LONG/TEST_SLICE + 1);   // ready on every tick of the job
+  CHECK(OS_MissLog(0, &tick, &thread));
+  CHECK(tick == MissTick);
+  CHECK(thread == 0);
+  CHECK(OS_MissLog(1, &tick, &thread) == 0);
+  CHECK(OS_DeadlineStats(1, &misses, &worst));
+  CHECK(misses == 0);
+  CHECK(worst == 1);
+  CHECK(QuietJobs > 0);
+  CHECK(OS_DeadlineStats(3, &misses, &worst) == 0);
+}
+
+void Sleeper(void){
+  while(1){
+    Test_Sleep(1000);
+  }
+}
+
+void Worker(void){             // critical, misses one deadline and later stops checking in
+  uint32_t k, start;
+  for(k = 0; k < JOBS; k++){
+    start = OS_TickCount();      // the tick it woke on counts as the job's first
+    if(k == LONGJOB){
+      MissTick = start + DEADLINE;
+      Host_Busy(LONG);
+    }else{
+      Host_Busy(SHORT);
+    }
+    OS_CheckIn();
+    LastCheckIn = Host_Cycles();
+    Test_Sleep(NAP);
+  }
+  Test_Expect = "watchdog reset";
+  Test_Final = final;
+  Sleeper();
+}
+
+void Quiet(void){              // not critical, long asleep, never late
+  while(1){
+    Host_Busy(TEST_SLICE/4);
+    OS_CheckIn();
+    QuietJobs++;
+    Test_Sleep(50);
+  }
+}
+
+int main(void){                // deadlines go after OS_AddThreads, as in user.c
+  OS_Init();
+  OS_AddThreads(Worker, Quiet, Sleeper);
+  CHECK(OS_SetDeadline(0, DEADLINE, 1));
+  CHECK(OS_SetDeadline(1, DEADLINE, 0));
+  CHECK(OS_SetDeadline(3, DEADLINE, 0) == 0);
+  OS_WatchdogInit(TIMEOUT);
+  OS_Launch(TEST_SLICE);
+  return 0;
+}
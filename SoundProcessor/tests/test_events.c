@@ -0,0 +1,78 @@
+//*****************************************************************************
+// test_events.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the periodic event threads of os.c: each runs on the ticks its
+// period and phase give, also while the idle thread sleeps through the
+// ticks in between, threads due on one tick run in the order added, and a
+// thread that runs into the next tick counts an overrun without moving
+// anyone's timing.
+
+#include <stdint.h>
+#include "test.h"
+#include "host.h"
+#include "os.h"
+
+#define NUMEVENTS 4          // must match os.c
+#define TICKS     1000       // ticks the test runs
+
+struct event{
+  uint32_t period, phase;
+  uint32_t runs;             // activations seen
+  uint32_t wrong;            // activations not on their tick
+  uint32_t order;            // activations after a later added thread on the same tick
+};
+static struct event Seen[NUMEVENTS] = {{5, 0}, {7, 6}, {5, 2}, {50, 10}};
+static uint32_t LastTick, LastIndex; // latest activation
+
+static void activation(uint32_t i){
+  struct event *e = &Seen[i];
+  uint32_t tick = OS_TickCount();
+  if(tick != e->phase + 1 + e->runs*e->period){ // Ticks counts the tick before the threads run
+    e->wrong++;
+  }
+  if((tick == LastTick) && (LastIndex > i)){
+    e->order++;
+  }
+  LastTick = tick;
+  LastIndex = i;
+  e->runs++;
+}
+
+void Event0(void){ activation(0); }
+void Event1(void){ activation(1); }
+void Event2(void){ activation(2); }
+void Event3(void){
+  activation(3);
+  if(Seen[3].runs == 3){
+    Host_Busy(TEST_SLICE + TEST_SLICE/2); // into the next tick, not the one after
+  }
+}
+
+void Task(void){
+  uint32_t i, runs, overruns;
+  Test_Sleep(TICKS);           // every thread blocked, the idle thread sleeps between events
+  for(i = 0; i < NUMEVENTS; i++){
+    CHECK(OS_EventStats(i, &runs, &overruns));
+    CHECK(runs == Seen[i].runs);
+    CHECK(runs == (OS_TickCount() - 1 - Seen[i].phase)/Seen[i].period + 1);
+    CHECK(overruns == ((i == 3) ? 1 : 0));
+    CHECK(Seen[i].wrong == 0);
+    CHECK(Seen[i].order == 0);
+  }
+  CHECK(OS_EventStats(NUMEVENTS, &runs, &overruns) == 0);
+  CHECK(OS_IdleCycles() > (TICKS/2)*TEST_SLICE); // asleep most of the time
+  Test_Exit();
+}
+
+int main(void){
+  OS_Init();
+  CHECK(OS_AddPeriodicEventThread(Event0, 0, 0) == 0);  // no period
+  CHECK(OS_AddPeriodicEventThread(Event0, 5, 5) == 0);  // phase past the period
+  CHECK(OS_AddPeriodicEventThread(Event0, 5, 0));
+  CHECK(OS_AddPeriodicEventThread(Event1, 7, 6));
+  CHECK(OS_AddPeriodicEventThread(Event2, 5, 2));
+  CHECK(OS_AddPeriodicEventThread(Event3, 50, 10));
+  CHECK(OS_AddPeriodicEventThread(Event0, 3, 0) == 0);  // table full
+  Test_Launch(Task, 0, 0);
+  return 0;
+}
@@ -0,0 +1,122 @@
+//*****************************************************************************
+// test_fft.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of call_FFT of user.c, the analysis of a frame through the shared
+// buffers: the power spectrum packed in place in SoundBufferOut, the dB
+// spectrum kept from frame to frame in magnitudeArr and the plot points are
+// bit for bit those of the same calls on buffers of their own, stored
+// before call_FFT runs, frame after frame and with the THD window.
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "test.h"
+#include "arm_math.h"
+#include "os.h"
+#include "filter.h"
+#include "spectral.h"
+#include "noisefloor.h"
+#include "peaks.h"
+#include "thd.h"
+
+#define FS      64000        // as user.c
+#define LENGTH  1024         // SAMPLELENGTH of user.c
+#define MAGNUM  512          // as user.c
+#define THDBAND 20000        // as user.c
+#define FRAMES  4
+#define SPECTRUM 0           // enum DisplayMode of user.c
+#define THD      4
+
+void call_FFT(void);         // user.c
+int8_t plotPoint(float32_t v); // user.c
+extern uint32_t Mode;        // user.c, an enum DisplayMode
+extern float32_t *SoundBufferIn, *SoundBufferOut, *magnitudeArr; // user.c
+extern int8_t *dBArray;
+extern arm_rfft_fast_instance_f32 fft_inst;
+extern spectralType Spectral;
+extern peaksType Peaks;
+extern noisefloorType Noise;
+extern thdType Thd;
+extern filterChainType Chain;
+extern int32_t filterReady;
+extern uint32_t maxInd;
+
+static float32_t Frame[LENGTH], Work[LENGTH], Level[MAGNUM]; // the blocks call_FFT is lent
+static float32_t In[LENGTH], Out[LENGTH], Power[MAGNUM], dB[MAGNUM]; // the reference's own
+static int8_t Points[MAGNUM];
+static spectralType RefSpectral;
+static filterChainType RefChain;
+static thdType RefThd;
+
+// a tone with a second harmonic and some noise, louder each frame
+static void frame(uint32_t f){
+  uint32_t n;
+  for(n = 0; n < LENGTH; n++){
+    Frame[n] = (float32_t)((200 + 100*f)*sin(2*M_PI*1000*n/FS + f) +
+               50*sin(4*M_PI*1000*n/FS) + (int32_t)(Test_Random()%101) - 50);
+  }
+}
+
+// the analysis of call_FFT, each stage into a buffer of its own
+static void reference(uint32_t mode){
+  uint32_t k;
+  memcpy(In, Frame, sizeof(In));
+  Filter_Run(&RefChain, In, LENGTH);
+  if(mode == THD){
+    Thd_Window(&RefThd, In);
+  }
+  arm_rfft_fast_f32(&fft_inst, In, Out, 0);
+  Power[0] = Out[0]*Out[0];
+  for(k = 1; k < MAGNUM; k++){
+    Power[k] = Out[2*k]*Out[2*k] + Out[2*k+1]*Out[2*k+1];
+  }
+  Spectral_Compute(&RefSpectral, Power, dB, MAGNUM);
+  for(k = 0; k < MAGNUM-1; k++){
+    Points[k] = plotPoint(dB[k]);
+  }
+}
+
+// call_FFT on the frame, the same as the reference to the bit
+static int same(uint32_t mode){
+  float32_t top;
+  uint32_t index;
+  reference(mode);
+  Mode = mode;
+  SoundBufferIn = Frame;
+  SoundBufferOut = Work;
+  magnitudeArr = Level;
+  call_FFT();
+  arm_max_f32(dB, MAGNUM-1, &top, &index);
+  return (memcmp(Work, Power, sizeof(Power)) == 0) &&
+         (memcmp(Level, dB, (MAGNUM-1)*sizeof(float32_t)) == 0) &&
+         (memcmp(dBArray, Points, MAGNUM-1) == 0) &&
+         (memcmp(&Spectral, &RefSpectral, sizeof(Spectral)) == 0) &&
+         (maxInd == index);
+}
+
+int main(void){
+  uint32_t f;
+  rfft_fast_init_1024_f32(&fft_inst);
+  Spectral_Init(&Spectral, (float32_t)FS/LENGTH);
+  Spectral_Init(&RefSpectral, (float32_t)FS/LENGTH);
+  Peaks_Init(&Peaks, (float32_t)FS/LENGTH);
+  Noise_Init(&Noise, MAGNUM-1);
+  Thd_Init(&Thd, (float32_t)FS/LENGTH, LENGTH, THDBAND);
+  Thd_Init(&RefThd, (float32_t)FS/LENGTH, LENGTH, THDBAND);
+  filterReady = Filter_Configure(&Chain, &FilterSet);
+  CHECK(filterReady);
+  CHECK(Filter_Configure(&RefChain, &FilterSet));
+  // frame after frame, magnitudeArr holding the previous one for the flux
+  for(f = 0; f < FRAMES; f++){
+    frame(f);
+    CHECK(same(SPECTRUM));
+    CHECK((f == 0) || (Spectral.flux > 0));
+  }
+  // the flat-top window on the frame in place
+  frame(FRAMES);
+  CHECK(same(THD));
+  frame(FRAMES + 1);
+  CHECK(same(SPECTRUM));
+  Test_Exit();
+  return 0;
+}
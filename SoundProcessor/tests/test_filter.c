@@ -0,0 +1,258 @@
+//*****************************************************************************
+// test_filter.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the filter chain of filter.c: a chain configured from a set filters
+// as the difference equations of its coefficients do, in any block
+// lengths, and its Q15 stage bit for bit with saturation; Filter_Verify
+// measures the true response H(e^jw) of the coefficients and finds a check
+// level that is off; the set linked in from filterset.c has check levels
+// that are its true response; and sets that do not fit leave the chain
+// empty, passing samples through.
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "test.h"
+#include "filter.h"
+
+#define FS      64000.0
+#define SECTIONS 2
+#define TAPS    15           // float FIR
+#define QTAPS   16           // Q15 FIR
+#define LENGTH  1000
+#define CHECKS  6
+
+static filterSetType Set;
+static float32_t Biquad[5*SECTIONS];
+static float32_t Fir[TAPS];    // time reversed, as CMSIS wants
+static q15_t Q15[QTAPS];       // time reversed
+static const float32_t CheckHz[CHECKS] = {50, 500, 2000, 5000, 12000, 30000};
+static float32_t x[LENGTH], y[LENGTH];
+static float32_t Scratch[FILTER_VERIFYLEN];
+static filterChainType Chain;
+static filterSetType Spoiled;  // a copy of the set linked in
+
+// a two section lowpass at 3 kHz, Q 0.54 and 1.31, CMSIS signs
+static void design(void){
+  const double q[SECTIONS] = {0.541, 1.307};
+  double w = 2*M_PI*3000/FS, alpha, a0;
+  uint32_t s, k;
+  for(s = 0; s < SECTIONS; s++){
+    alpha = sin(w)/(2*q[s]);
+    a0 = 1 + alpha;
+    Biquad[5*s+0] = (float32_t)((1 - cos(w))/2/a0);
+    Biquad[5*s+1] = (float32_t)((1 - cos(w))/a0);
+    Biquad[5*s+2] = (float32_t)((1 - cos(w))/2/a0);
+    Biquad[5*s+3] = (float32_t)(2*cos(w)/a0);
+    Biquad[5*s+4] = (float32_t)(-(1 - alpha)/a0);
+  }
+  for(k = 0; k < TAPS; k++){   // not symmetric, so the order matters
+    Fir[k] = (float32_t)(0.3*exp(-0.3*k)*((k%3) ? 1 : -0.5));
+  }
+  for(k = 0; k < QTAPS; k++){
+    Q15[k] = (q15_t)((k%2) ? 1500*(k + 1) : -1000*k);
+  }
+}
+
+// the true response of the biquads and float FIR in dB, in double from
+// the float coefficients
+static double response(double f){
+  double w = 2*M_PI*f/FS, re = 1, im = 0, nr, ni, dr, di, r, i2;
+  const float32_t *c;
+  uint32_t s, k;
+  for(s = 0; s < SECTIONS; s++){
+    c = &Biquad[5*s];
+    nr = c[0] + c[1]*cos(w) + c[2]*cos(2*w);
+    ni = -c[1]*sin(w) - c[2]*sin(2*w);
+    dr = 1 - c[3]*cos(w) - c[4]*cos(2*w);
+    di = c[3]*sin(w) + c[4]*sin(2*w);
+    r = (nr*dr + ni*di)/(dr*dr + di*di);
+    i2 = (ni*dr - nr*di)/(dr*dr + di*di);
+    nr = re*r - im*i2;
+    im = re*i2 + im*r;
+    re = nr;
+  }
+  nr = ni = 0;
+  for(k = 0; k < TAPS; k++){   // tap k delays TAPS-1-k
+    nr += Fir[k]*cos(w*(TAPS - 1 - k));
+    ni -= Fir[k]*sin(w*(TAPS - 1 - k));
+  }
+  return 10*log10((re*re + im*im)*(nr*nr + ni*ni));
+}
+
+// the float chain as a set, with the given check levels
+static void floatSet(const float32_t *checkdB){
+  uint32_t k;
+  memset(&Set, 0, sizeof(Set));
+  Set.magic = FILTER_MAGIC;
+  Set.fs = (float32_t)FS;
+  Set.numStages = 2;
+  Set.stages[0].type = FILTER_BIQUAD;
+  Set.stages[0].count = SECTIONS;
+  Set.stages[0].coeffs = Biquad;
+  Set.stages[1].type = FILTER_FIR;
+  Set.stages[1].count = TAPS;
+  Set.stages[1].coeffs = Fir;
+  Set.numChecks = CHECKS;
+  for(k = 0; k < CHECKS; k++){
+    Set.checkHz[k] = CheckHz[k];
+    Set.checkdB[k] = checkdB[k];
+  }
+}
+
+// a Q15 FIR of count taps as a set, no checks
+static void q15Set(uint32_t count){
+  memset(&Set, 0, sizeof(Set));
+  Set.magic = FILTER_MAGIC;
+  Set.fs = (float32_t)FS;
+  Set.numStages = 1;
+  Set.stages[0].type = FILTER_FIRQ15;
+  Set.stages[0].count = count;
+  Set.stages[0].coeffs = Q15;
+}
+
+// the float chain by its difference equations
+static void reference(const float32_t *in, double *out){
+  double v[LENGTH], s1, s2, u;
+  const float32_t *c;
+  uint32_t s, n, k;
+  for(n = 0; n < LENGTH; n++){
+    v[n] = in[n];
+  }
+  for(s = 0; s < SECTIONS; s++){
+    c = &Biquad[5*s];
+    s1 = s2 = 0;
+    for(n = 0; n < LENGTH; n++){ // direct form 2 transposed
+      u = c[0]*v[n] + s1;
+      s1 = c[1]*v[n] + c[3]*u + s2;
+      s2 = c[2]*v[n] + c[4]*u;
+      v[n] = u;
+    }
+  }
+  for(n = 0; n < LENGTH; n++){
+    out[n] = 0;
+    for(k = 0; (k < TAPS) && (k <= n); k++){
+      out[n] += Fir[TAPS - 1 - k]*v[n - k];
+    }
+  }
+}
+
+// a spoiled set leaves the chain empty, passing samples through
+static int rejected(void){
+  float32_t z[3] = {1, 2, 3};
+  if(Filter_Configure(&Chain, &Set)){
+    return 0;
+  }
+  Filter_Run(&Chain, z, 3);
+  return (Chain.numStages == 0) && (Chain.numChecks == 0) && (Chain.used == 0) &&
+         (z[0] == 1) && (z[1] == 2) && (z[2] == 3);
+}
+
+int main(void){
+  static double ref[LENGTH];
+  float32_t levels[CHECKS];
+  uint32_t i, k, n, bad;
+  int32_t v;
+  int64_t a;
+  double worst;
+  design();
+  for(k = 0; k < CHECKS; k++){
+    levels[k] = (float32_t)response(CheckHz[k]);
+  }
+  // the float chain against its difference equations, in uneven blocks
+  floatSet(levels);
+  CHECK(Filter_Configure(&Chain, &Set));
+  CHECK(Chain.numStages == 2);
+  for(n = 0; n < LENGTH; n++){
+    x[n] = (float32_t)((int32_t)(Test_Random()%4001) - 2000);
+    y[n] = x[n];
+  }
+  reference(x, ref);
+  for(n = 0, k = 1; n < LENGTH; n += k, k = 2*k + 1){
+    Filter_Run(&Chain, &y[n], (n + k > LENGTH) ? LENGTH - n : k);
+  }
+  worst = 0;
+  for(n = 0; n < LENGTH; n++){
+    worst = (fabs(y[n] - ref[n]) > worst) ? fabs(y[n] - ref[n]) : worst;
+  }
+  CHECK(worst < 2000*1e-5);
+  // Filter_Verify measures the true response, and a level that is off
+  CHECK(Filter_Verify(&Chain, Scratch) < 0.01f);
+  y[0] = 1000;
+  Filter_Run(&Chain, y, 1);        // cleared after the checks
+  CHECKNEAR(y[0], 1000*Biquad[0]*Biquad[5]*Fir[TAPS-1], 1e-3);
+  levels[3] += 1;
+  floatSet(levels);
+  CHECK(Filter_Configure(&Chain, &Set));
+  CHECKNEAR(Filter_Verify(&Chain, Scratch), 1, 0.01);
+  // the Q15 stage bit for bit, saturating at FILTER_Q15SCALE
+  q15Set(QTAPS);
+  CHECK(Filter_Configure(&Chain, &Set));
+  for(n = 0; n < LENGTH; n++){
+    x[n] = (float32_t)((int32_t)(Test_Random()%10001) - 5000); // past full scale
+    y[n] = x[n];
+  }
+  Filter_Run(&Chain, y, LENGTH);
+  bad = i = 0;
+  for(n = 0; n < LENGTH; n++){
+    a = 0;
+    for(k = 0; (k < QTAPS) && (k <= n); k++){
+      v = (int32_t)(x[n - k]*(32768/FILTER_Q15SCALE));
+      v = (v > 32767) ? 32767 : ((v < -32768) ? -32768 : v);
+      a += (int64_t)Q15[QTAPS - 1 - k]*v; // a 64 bit accumulator
+    }
+    a = a >> 15;
+    a = (a > 32767) ? 32767 : ((a < -32768) ? -32768 : a);
+    bad += y[n] != a*(FILTER_Q15SCALE/32768);
+    i += (a == 32767) || (a == -32768);
+  }
+  CHECK(bad == 0);
+  CHECK(i > 10);                   // saturated
+  // the set linked in, its check levels are its true response
+  CHECK(Filter_Configure(&Chain, &FilterSet));
+  CHECK(FilterSet.numStages == 1);
+  CHECK(FilterSet.stages[0].type == FILTER_BIQUAD);
+  memcpy(Biquad, FilterSet.stages[0].coeffs, 5*sizeof(float32_t));
+  for(k = 0; k < FilterSet.numChecks; k++){
+    double w = 2*M_PI*FilterSet.checkHz[k]/FilterSet.fs, nr, ni, dr, di;
+    nr = Biquad[0] + Biquad[1]*cos(w) + Biquad[2]*cos(2*w);
+    ni = -Biquad[1]*sin(w) - Biquad[2]*sin(2*w);
+    dr = 1 - Biquad[3]*cos(w) - Biquad[4]*cos(2*w);
+    di = Biquad[3]*sin(w) + Biquad[4]*sin(2*w);
+    CHECKNEAR(FilterSet.checkdB[k], 10*log10((nr*nr + ni*ni)/(dr*dr + di*di)), 1e-3);
+  }
+  CHECK(Filter_Verify(&Chain, Scratch) < 0.05f);
+  Biquad[3] = 1.9f;                // spoiled in RAM, the checks catch it
+  Chain.stages[0].inst.biquad.pCoeffs = Biquad;
+  CHECK(Filter_Verify(&Chain, Scratch) > FILTER_VERIFYDB);
+  // sets that do not fit
+  floatSet(levels);
+  Set.magic++;
+  CHECK(rejected());
+  floatSet(levels);
+  Set.numStages = FILTER_MAXSTAGES + 1;
+  CHECK(rejected());
+  floatSet(levels);
+  Set.stages[1].type = 7;          // no such type
+  CHECK(rejected());
+  floatSet(levels);
+  Set.stages[1].count = 0;
+  CHECK(rejected());
+  floatSet(levels);
+  Set.numChecks = FILTER_MAXCHECKS + 1;
+  CHECK(rejected());
+  q15Set(QTAPS - 1);               // odd
+  CHECK(rejected());
+  q15Set(2*FILTER_ARENAWORDS);     // more state than the arena holds
+  CHECK(rejected());
+  Spoiled = FilterSet;
+  Spoiled.magic = 0;
+  CHECK(Filter_Configure(&Chain, &Spoiled) == 0);
+  CHECK(Chain.numStages == 0);
+  Spoiled = FilterSet;
+  Spoiled.stages[0].count = FILTER_ARENAWORDS;
+  CHECK(Filter_Configure(&Chain, &Spoiled) == 0);
+  CHECK(Chain.numStages == 0);
+  Test_Exit();
+  return 0;
+}
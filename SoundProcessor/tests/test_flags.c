@@ -0,0 +1,171 @@
+//*****************************************************************************
+// test_flags.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the event flags, semaphores and atomics of os.c: waits for any
+// or all bits end on the tick the bits are set or the timeout passes and
+// clear only the bits returned; an event thread signalling a semaphore as
+// fast as two threads take from it loses and invents nothing, and a
+// semaphore used as a lock keeps them apart across preemption; OS_Signal
+// and the flag operations leave a critical section masked, and critical
+// sections nest.
+
+#include <stdint.h>
+#include "test.h"
+#include "host.h"
+#include "os.h"
+#include "CortexM.h"
+
+#define TOTAL 20000          // items the producer signals
+#define A 0x01               // flag bits
+#define B 0x02
+#define C 0x04
+#define D 0x80
+
+static uint32_t Flags;
+static uint32_t SetAt, SetBits; // the setter sets SetBits on tick SetAt
+static int32_t Items, Lock;
+static uint32_t Go;          // the producer starts
+static uint32_t Produced, Consumed[2];
+static uint32_t Inside, Overlaps, Negative;
+
+void Setter(void){
+  if((SetBits != 0) && (OS_TickCount() == SetAt)){
+    OS_FlagsSet(&Flags, SetBits);
+    SetBits = 0;
+  }
+}
+
+void Producer(void){           // up to 3 items a tick, at random
+  uint32_t n;
+  if(Go == 0){
+    return;
+  }
+  for(n = Test_Random()%4; n && (Produced < TOTAL); n--){
+    OS_Signal(&Items);
+    Produced++;
+  }
+}
+
+static void consume(uint32_t k){
+  while(1){
+    OS_Wait(&Items);
+    Consumed[k]++;
+    if(Items < 0){
+      Negative++;
+    }
+    OS_Wait(&Lock);
+    Inside++;
+    if(Inside != 1){
+      Overlaps++;
+    }
+    Host_Busy(Test_Random()%(TEST_SLICE/2)); // preempted in here now and then
+    Inside--;
+    OS_Signal(&Lock);
+  }
+}
+void Consumer0(void){ consume(0); }
+void Consumer1(void){ consume(1); }
+
+// the setter sets bits ticks from now
+static void setIn(uint32_t ticks, uint32_t bits){
+  SetAt = OS_TickCount() + ticks;
+  SetBits = bits;
+}
+
+static void testFlags(void){
+  uint32_t t;
+  // bits already set
+  OS_FlagsInit(&Flags, A|C|D);
+  CHECK(OS_FlagsWait(&Flags, A|B, OS_FLAGS_ANY, 0, OS_FOREVER) == A);
+  CHECK(Flags == (A|C|D));     // left set
+  CHECK(OS_FlagsWait(&Flags, A|C, OS_FLAGS_ALL, 1, 5) == (A|C));
+  CHECK(Flags == D);           // only the bits returned are cleared
+  CHECK(OS_FlagsSet(&Flags, B) == (B|D));
+  CHECK(OS_FlagsClear(&Flags, D|C) == B);
+  // any, woken on the tick a bit is set
+  OS_FlagsInit(&Flags, 0);
+  t = OS_TickCount();
+  setIn(3, C);
+  CHECK(OS_FlagsWait(&Flags, A|C, OS_FLAGS_ANY, 1, OS_FOREVER) == C);
+  CHECK(OS_TickCount() == t + 3);
+  CHECK(Flags == 0);
+  // all, one bit is not enough
+  OS_FlagsInit(&Flags, A);
+  t = OS_TickCount();
+  setIn(2, D);
+  CHECK(OS_FlagsWait(&Flags, A|B, OS_FLAGS_ALL, 0, 10) == 0); // timed out
+  CHECK(OS_TickCount() == t + 10);
+  CHECK(Flags == (A|D));       // nothing cleared on a timeout
+  t = OS_TickCount();
+  setIn(4, B);
+  CHECK(OS_FlagsWait(&Flags, A|B, OS_FLAGS_ALL, 1, 10) == (A|B));
+  CHECK(OS_TickCount() == t + 4);
+  CHECK(Flags == D);
+  // a timeout of one tick
+  t = OS_TickCount();
+  CHECK(OS_FlagsWait(&Flags, A, OS_FLAGS_ANY, 0, 1) == 0);
+  CHECK(OS_TickCount() == t + 1);
+}
+
+static void testCritical(void){
+  uint32_t t, u;
+  int32_t n = 0;
+  long sr, sr2;
+  // the OS calls a handler may make leave the interrupts masked
+  t = OS_TickCount();
+  sr = StartCritical();
+  OS_Signal(&Lock);
+  OS_Wait(&Lock);              // available, so it does not suspend
+  OS_FlagsSet(&Flags, A);
+  OS_FlagsClear(&Flags, A);
+  u = 0;
+  CHECK(OS_AtomicOr(&u, A|B) == (A|B));
+  CHECK(OS_AtomicAndNot(&u, A) == B);
+  Host_Busy(2*TEST_SLICE);     // ticks come and stay pending
+  CHECK(OS_TickCount() == t);
+  // and nest
+  sr2 = StartCritical();
+  EndCritical(sr2);
+  Host_Busy(TEST_SLICE);
+  CHECK(OS_TickCount() == t);
+  EndCritical(sr);             // the pending tick is taken now, once
+  CHECK(OS_TickCount() == t + 1);
+  // atomics
+  CHECK(OS_AtomicAdd(&n, 5) == 5);
+  CHECK(OS_AtomicAdd(&n, -7) == -2);
+  CHECK(OS_AtomicTake(&n) == 0);
+  CHECK(n == -2);              // not taken below 0
+  n = 1;
+  CHECK(OS_AtomicTake(&n) == 1);
+  CHECK(OS_AtomicTake(&n) == 0);
+  CHECK(n == 0);
+}
+
+void Main(void){
+  testFlags();
+  testCritical();
+  Go = 1;                      // now the stress
+  while((Produced < TOTAL) || (Items > 0)){
+    Test_Sleep(10);
+  }
+  Test_Sleep(5);               // for the last items to go through the lock
+  CHECK(Produced == TOTAL);
+  CHECK(Consumed[0] + Consumed[1] == TOTAL);
+  CHECK(Consumed[0] && Consumed[1]);
+  CHECK(Items == 0);
+  CHECK(Negative == 0);
+  CHECK(Overlaps == 0);
+  CHECK(Lock == 1);
+  CHECK(Inside == 0);
+  Test_Exit();
+}
+
+int main(void){
+  OS_Init();
+  OS_InitSemaphore(&Items, 0);
+  OS_InitSemaphore(&Lock, 1);
+  OS_AddPeriodicEventThread(Setter, 1, 0);
+  OS_AddPeriodicEventThread(Producer, 1, 0);
+  Test_Launch(Main, Consumer0, Consumer1);
+  return 0;
+}
@@ -0,0 +1,91 @@
+//*****************************************************************************
+// test_host.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the host port itself: simulated work and sleep advance the
+// clock and the tick count as on the board, and the microphone delivers
+// the samples of a WAV file at the rate it was started with, losing the
+// oldest ones when the thread falls behind by more than its FIFO.
+
+#include <stdio.h>
+#include <stdint.h>
+#include "test.h"
+#include "host.h"
+#include "os.h"
+#include "BSP.h"
+#include "CortexM.h"
+
+#define RATE     64000       // samples per second
+#define SAMPLES  20000       // in the file
+#define FIFOSIZE 256         // must match MICFIFOSIZE in bsp.c
+
+// a ramp the 10-bit microphone reads back as sample number mod 1024
+static int writeRamp(const char *name){
+  FILE *f = fopen(name, "wb");
+  uint32_t i, v;
+  static const uint8_t head[44] = {'R','I','F','F', 0,0,0,0, 'W','A','V','E',
+    'f','m','t',' ', 16,0,0,0, 1,0, 1,0, RATE&0xFF,(RATE>>8)&0xFF,RATE>>16,0,
+    (2*RATE)&0xFF,((2*RATE)>>8)&0xFF,(2*RATE)>>16,0, 2,0, 16,0, 'd','a','t','a',
+    (2*SAMPLES)&0xFF,((2*SAMPLES)>>8)&0xFF,(2*SAMPLES)>>16,0};
+  if(f == 0){
+    return 0;
+  }
+  fwrite(head, 1, sizeof(head), f);
+  for(i = 0; i < SAMPLES; i++){
+    v = ((i%1024)<<6) ^ 0x8000;    // offset binary back to signed
+    fputc(v & 0xFF, f);
+    fputc(v>>8, f);
+  }
+  fclose(f);
+  return 1;
+}
+
+// samples due since the microphone started, as bsp.c counts them
+static uint32_t due(uint32_t start){
+  return (uint32_t)((uint64_t)(DWT_CYCCNT - start)*RATE/TEST_CLOCK);
+}
+
+void Task(void){
+  uint32_t t, c, start, n, taken;
+  uint16_t mic;
+  // work runs the clock and the ticks on, nothing else is ready to run
+  t = OS_TickCount();
+  c = DWT_CYCCNT;
+  Host_Busy(10*TEST_SLICE + 5);
+  CHECK(DWT_CYCCNT - c == 10*TEST_SLICE + 5);
+  CHECK((OS_TickCount() - t == 10) || (OS_TickCount() - t == 11));
+  // a timed wait wakes on the tick it times out
+  t = OS_TickCount();
+  Test_Sleep(20);
+  CHECK(OS_TickCount() - t == 20);
+  // every sample due, in order
+  BSP_Microphone_Start(RATE, 2);
+  start = DWT_CYCCNT;
+  Test_Sleep(2);
+  taken = 0;
+  while(BSP_Microphone_Get(&mic)){
+    CHECK(mic == taken%1024);
+    taken++;
+  }
+  CHECK(taken == due(start));
+  CHECK(taken > 100);
+  // behind by more than the FIFO, the oldest are lost
+  Test_Sleep(10);
+  n = 0;
+  while(BSP_Microphone_Get(&mic)){
+    if(n == 0){
+      CHECK(mic == (due(start) - FIFOSIZE)%1024);
+    }
+    n++;
+  }
+  CHECK(n == FIFOSIZE);
+  CHECK(Host_MicSamples() == due(start));
+  Test_Exit();
+}
+
+int main(void){
+  CHECK(writeRamp("test_host.wav"));
+  CHECK(Host_MicOpen("test_host.wav"));
+  OS_Init();
+  Test_Launch(Task, 0, 0);
+  return 0;
+}
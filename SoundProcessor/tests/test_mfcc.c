@@ -0,0 +1,148 @@
+//*****************************************************************************
+// test_mfcc.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the MFCCs of mfcc.c with the parameters of user.c against a
+// reference written from the definitions in double precision, a dense
+// triangular mel filterbank, the log and an orthonormal DCT-II by cosines,
+// for random spectra, single tones and silence; and of the deltas on a
+// spectrum whose level rises at a steady rate. The cost of a frame on
+// this host is printed.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include "test.h"
+#include "mfcc.h"
+
+#define FS     64000         // as user.c
+#define LENGTH 1024
+#define BINS   512
+#define LOW    100
+#define HIGH   16000
+#define M      MFCC_NUMFILTERS
+#define RUNS   20000         // frames timed
+#define TOL    5e-3          // of a coefficient; the Q15 weights are within 1/32768,
+                             // more than that of a small weight on a strong tone
+
+static float32_t Power[BINS];
+
+static double mel(double f){
+  return 2595*log10(1 + f/700);
+}
+
+// the MFCCs as the textbook computes them
+static void reference(const float32_t *power, double *coeffs){
+  double edge[M+2], energy[M], f, w, sum;
+  uint32_t j, k, n;
+  for(j = 0; j < M+2; j++){    // in bins
+    f = mel(LOW) + (mel(HIGH) - mel(LOW))*j/(M + 1);
+    edge[j] = 700*(pow(10, f/2595) - 1)*LENGTH/FS;
+  }
+  for(j = 0; j < M; j++){
+    energy[j] = 0;
+    for(k = 0; k < BINS; k++){
+      if((k >= edge[j]) && (k < edge[j+1])){
+        w = (k - edge[j])/(edge[j+1] - edge[j]);
+      }else if((k >= edge[j+1]) && (k < edge[j+2])){
+        w = (edge[j+2] - k)/(edge[j+2] - edge[j+1]);
+      }else{
+        w = 0;
+      }
+      energy[j] += w*power[k];
+    }
+    energy[j] = log(energy[j] + 1e-10);
+  }
+  for(n = 0; n < MFCC_NUMCOEFFS; n++){
+    sum = 0;
+    for(j = 0; j < M; j++){
+      sum += energy[j]*cos(M_PI*n*(j + 0.5)/M);
+    }
+    coeffs[n] = sum*sqrt((n == 0 ? 1.0 : 2.0)/M);
+  }
+}
+
+static double compare(mfccType *m){
+  double ref[MFCC_NUMCOEFFS], worst = 0;
+  uint32_t n;
+  reference(Power, ref);
+  MFCC_Compute(m, Power);
+  for(n = 0; n < MFCC_NUMCOEFFS; n++){
+    if(fabs(m->coeffs[n] - ref[n]) > worst){
+      worst = fabs(m->coeffs[n] - ref[n]);
+    }
+  }
+  return worst;
+}
+
+static double uniform(void){
+  return (double)Test_Random()/0x7FFFFFFF;
+}
+
+int main(void){
+  mfccType m;
+  uint32_t i, k, n, t;
+  double worst, e, slope, seconds;
+  int valid;
+  CHECK(MFCC_Init(&m, FS, LENGTH, MFCC_MAXBINS + 1, LOW, HIGH) == 0);
+  CHECK(MFCC_Init(&m, FS, LENGTH, BINS, HIGH, LOW) == 0);
+  CHECK(MFCC_Init(&m, FS, LENGTH, 200, LOW, HIGH) == 0); // HIGH past the bins given
+  CHECK(MFCC_Init(&m, FS, LENGTH, BINS, LOW, HIGH));
+  // random spectra over 60 dB, as the microphone gives
+  worst = 0;
+  for(i = 0; i < 200; i++){
+    for(k = 0; k < BINS; k++){
+      Power[k] = (float32_t)pow(10, 6*uniform());
+    }
+    e = compare(&m);
+    worst = (e > worst) ? e : worst;
+  }
+  CHECK(worst < TOL);
+  // a tone 60 dB up in each bin in turn, mostly in one or two filters,
+  // up to the top edge, where its weight is 0 by a rounding
+  worst = 0;
+  for(i = 2; i < HIGH*LENGTH/FS; i++){
+    for(k = 0; k < BINS; k++){
+      Power[k] = 1;
+    }
+    Power[i] = 1e6f;
+    e = compare(&m);
+    worst = (e > worst) ? e : worst;
+  }
+  CHECK(worst < TOL);
+  // silence, every filter on the floor
+  for(k = 0; k < BINS; k++){
+    Power[k] = 0;
+  }
+  MFCC_Compute(&m, Power);
+  CHECKNEAR(m.coeffs[0], log(1e-10)*sqrt(M), 0.01);
+  for(n = 1; n < MFCC_NUMCOEFFS; n++){
+    CHECKNEAR(m.coeffs[n], 0, 1e-3);
+  }
+  // a level rising by a factor r a frame moves c0 by sqrt(M)*log(r) a
+  // frame and leaves the shape alone, once the delta window is full
+  CHECK(MFCC_Init(&m, FS, LENGTH, BINS, LOW, HIGH));
+  slope = log(1.5);
+  for(t = 0; t < 10; t++){
+    for(k = 0; k < BINS; k++){
+      Power[k] = (float32_t)(exp(slope*t)*(1 + k%7));
+    }
+    valid = MFCC_Compute(&m, Power);
+    CHECK(valid == (t >= 2*MFCC_DELTAWIN));
+  }
+  CHECKNEAR(m.delta[0], slope*sqrt(M), 1e-3);
+  for(n = 1; n < MFCC_NUMCOEFFS; n++){
+    CHECKNEAR(m.delta[n], 0, 1e-3);
+  }
+  // the cost of a frame, well inside its period even on a slow host
+  seconds = Test_Seconds();
+  for(i = 0; i < RUNS; i++){
+    Power[i%BINS] = (float32_t)i;  // not quite the same frame each time
+    MFCC_Compute(&m, Power);
+  }
+  seconds = (Test_Seconds() - seconds)/RUNS;
+  printf("MFCC_Compute: %.2f us a frame on this host, %.3f%% of a frame period\n",
+         1e6*seconds, 100*seconds*FS/LENGTH);
+  CHECK(seconds < 0.01*LENGTH/FS);
+  Test_Exit();
+  return 0;
+}
@@ -0,0 +1,116 @@
+//*****************************************************************************
+// test_noise.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the noise floor of noisefloor.c with the bins of user.c: on
+// periodograms of white noise the floor, with its bias added back, is the
+// mean noise level; a tone that starts is its own level above the floor
+// and the floor under it rises at NOISE_RISEDB a frame; the floor follows
+// a quieter room within the smoothing; and levels out of range are held
+// to what the Q8 storage can take.
+
+#include <stdint.h>
+#include <math.h>
+#include "test.h"
+#include "noisefloor.h"
+
+#define BINS   511           // MAGNUM-1
+#define LEVEL  20.0          // mean noise power in dB
+#define TONE   100           // bin of the tone
+
+static float32_t dB[BINS];
+
+static double uniform(void){
+  return (Test_Random() + 1.0)/2147483649.0;
+}
+
+// one periodogram of white noise, exponential power in each bin, plus a
+// tone of power tone dB in bin TONE, or none if tone is 0
+static void noise(double level, double tone){
+  uint32_t k;
+  double p;
+  for(k = 0; k < BINS; k++){
+    p = -log(uniform())*pow(10, level/10);
+    if((k == TONE) && (tone != 0)){
+      p += pow(10, tone/10);
+    }
+    dB[k] = (float32_t)(10*log10(p));
+  }
+}
+
+// mean of the floor over the bins other than the tone's
+static double meanFloor(noisefloorType *nf){
+  double sum = 0;
+  uint32_t k;
+  for(k = 0; k < BINS; k++){
+    if(k != TONE){
+      sum += Noise_Floor(nf, k);
+    }
+  }
+  return sum/(BINS - 1);
+}
+
+int main(void){
+  static noisefloorType nf;
+  uint32_t i, k;
+  float32_t snr, before;
+  double floor;
+  CHECK(Noise_Init(&nf, NOISE_MAXBINS + 1) == 0);
+  CHECK(Noise_Init(&nf, BINS));
+  // noise only, the corrected minimum is the mean level
+  for(i = 0; i < 300; i++){
+    noise(LEVEL, 0);
+    snr = Noise_Update(&nf, dB);
+  }
+  floor = meanFloor(&nf);
+  CHECKNEAR(floor, LEVEL, 0.5);
+  CHECK(snr < 3);
+  // a tone 30 dB above the noise in its bin, the SNR is tone over all noise
+  before = Noise_Floor(&nf, TONE);
+  noise(LEVEL, LEVEL + 30);
+  snr = Noise_Update(&nf, dB);
+  CHECKNEAR(snr, 30 - 10*log10(BINS), 1.5);
+  for(i = 1; i < 50; i++){
+    noise(LEVEL, LEVEL + 30);
+    Noise_Update(&nf, dB);
+  }
+  // the floor under a steady tone rises, but no faster than NOISE_RISEDB
+  CHECK(Noise_Floor(&nf, TONE) > before + 1);
+  CHECK(Noise_Floor(&nf, TONE) <= before + 50*NOISE_RISEDB);
+  CHECKNEAR(meanFloor(&nf), floor, 1);         // the other bins are unmoved
+  // the room 20 dB quieter, the floor is down within the smoothing
+  for(i = 0; i < 30; i++){
+    noise(LEVEL - 20, 0);
+    Noise_Update(&nf, dB);
+  }
+  CHECKNEAR(meanFloor(&nf), floor - 20, 1.5);
+  // a steady level: the floor rises in steps of NOISE_RISEDB in Q8 to it
+  CHECK(Noise_Init(&nf, BINS));
+  for(k = 0; k < BINS; k++){
+    dB[k] = 0;
+  }
+  Noise_Update(&nf, dB);
+  for(k = 0; k < BINS; k++){
+    dB[k] = 10;
+  }
+  for(i = 0; i < 40; i++){
+    Noise_Update(&nf, dB);
+  }
+  CHECKNEAR(Noise_Floor(&nf, 0), NOISE_BIASDB + 40*floorf(NOISE_RISEDB*256)/256, 1e-6);
+  for(i = 0; i < 100; i++){
+    Noise_Update(&nf, dB);
+  }
+  CHECKNEAR(Noise_Floor(&nf, 0), 10 + NOISE_BIASDB, 0.02); // caught up, but
+                               // for the truncation of the Q8 smoothing
+  CHECKNEAR(Noise_Update(&nf, dB), -60, 1e-3);             // all floor
+  // out of range, held to NOISE_MINDB and NOISE_MAXDB, not wrapped
+  CHECK(Noise_Init(&nf, BINS));
+  for(k = 0; k < BINS; k++){
+    dB[k] = (k%2) ? 300 : -INFINITY;
+  }
+  snr = Noise_Update(&nf, dB);
+  CHECKNEAR(Noise_Floor(&nf, 0), NOISE_MINDB + NOISE_BIASDB, 0.01);
+  CHECKNEAR(Noise_Floor(&nf, 1), NOISE_MAXDB + NOISE_BIASDB, 0.01);
+  CHECK(isfinite(snr));
+  Test_Exit();
+  return 0;
+}
@@ -0,0 +1,112 @@
+//*****************************************************************************
+// test_notch.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the mains notch of notch.c with the parameters of user.c: the
+// samples pass unchanged while 50 or 60 Hz is chosen and the right one is
+// chosen, then hum at the fundamental and its harmonics is removed while
+// a tone between them passes at its level, an off-nominal mains frequency
+// is tracked and removed, and a drift past NOTCH_MAXDRIFT is held there.
+
+#include <stdint.h>
+#include <math.h>
+#include "test.h"
+#include "notch.h"
+
+#define FS     64000         // as user.c
+#define HARMS  5             // NOTCHHARMONICS
+#define HUM    200.0         // amplitude of the fundamental
+#define TONE   1000.0        // a tone to keep, Hz
+#define TONEAMP 50.0
+
+static notchType N;
+static uint32_t Time;        // samples since the start
+
+struct spectrum{
+  double mains;              // frequency of the hum
+  double amp[HARMS + 1];     // output amplitude at each harmonic, [0] the tone
+};
+
+// the input: hum at mains with harmonics falling 6 dB each, and the tone
+static double input(double mains){
+  double x = 2048 + TONEAMP*sin(2*M_PI*TONE*Time/FS);
+  uint32_t h;
+  for(h = 1; h <= HARMS; h++){
+    x += HUM/(1 << (h - 1))*cos(2*M_PI*h*mains*Time/FS + h);
+  }
+  return x;
+}
+
+// run for seconds, measure the output amplitudes over the last second
+// by Hann windowed single-bin DFTs, which keep the DC out of bins that are
+// not a whole number of cycles; return the number of samples passed
+// unchanged
+static uint32_t run(struct spectrum *s, double seconds){
+  uint32_t i, h, total = (uint32_t)(seconds*FS), same = 0;
+  double re[HARMS + 1] = {0}, im[HARMS + 1] = {0}, x, y, f, w;
+  for(i = 0; i < total; i++){
+    x = input(s->mains);
+    y = Notch_Process(&N, (float32_t)x);
+    same += (float32_t)x == (float32_t)y;
+    if(i >= total - FS){
+      w = 1 - cos(2*M_PI*(i - (total - FS))/FS);
+      for(h = 0; h <= HARMS; h++){
+        f = (h == 0) ? TONE : h*s->mains;
+        re[h] += w*y*cos(2*M_PI*f*Time/FS);
+        im[h] += w*y*sin(2*M_PI*f*Time/FS);
+      }
+    }
+    Time++;
+  }
+  for(h = 0; h <= HARMS; h++){
+    s->amp[h] = 2*sqrt(re[h]*re[h] + im[h]*im[h])/FS;
+  }
+  return same;
+}
+
+// worst hum attenuation over the harmonics in dB
+static double attenuation(struct spectrum *s){
+  double worst = 1000, a;
+  uint32_t h;
+  for(h = 1; h <= HARMS; h++){
+    a = 20*log10(HUM/(1 << (h - 1))/s->amp[h]);
+    worst = (a < worst) ? a : worst;
+  }
+  return worst;
+}
+
+int main(void){
+  struct spectrum s;
+  CHECK(Notch_Init(&N, FS, 0) == 0);
+  CHECK(Notch_Init(&N, FS, NOTCH_MAXHARMONICS + 1) == 0);
+  CHECK(Notch_Init(&N, 600, 5) == 0);          // 300 Hz is Nyquist
+  // 60 Hz mains, passed through while choosing, then chosen
+  CHECK(Notch_Init(&N, FS, HARMS));
+  s.mains = 60;
+  CHECK(run(&s, 0.1*NOTCH_ACQUIRE) == (uint32_t)(0.1*NOTCH_ACQUIRE*FS));
+  CHECK(N.nominal == 60);
+  // 50 Hz mains, removed, and the tone kept
+  Time = 0;
+  CHECK(Notch_Init(&N, FS, HARMS));
+  s.mains = 50;
+  run(&s, 0.1*NOTCH_ACQUIRE);
+  CHECK(N.nominal == 50);
+  run(&s, 5);
+  CHECK(attenuation(&s) > 30);     // the loop still settling a few mHz
+  CHECKNEAR(20*log10(s.amp[0]/TONEAMP), 0, 0.01);
+  CHECKNEAR(N.f0, 50, 0.01);
+  // the mains 1.3 Hz high, tracked and removed, over a long run
+  s.mains = 51.3;
+  run(&s, 5);
+  CHECKNEAR(N.f0, s.mains, 0.01);
+  run(&s, 30);
+  CHECKNEAR(N.f0, s.mains, 0.001);
+  CHECK(attenuation(&s) > 60);
+  CHECKNEAR(20*log10(s.amp[0]/TONEAMP), 0, 0.01);
+  CHECKNEAR(sqrt(N.cosF*N.cosF + N.sinF*N.sinF), 1, 1e-4);
+  // past the drift allowed, the oscillator stays at the limit
+  s.mains = 50 - 1.5*NOTCH_MAXDRIFT;
+  run(&s, 5);
+  CHECKNEAR(N.f0, 50 - NOTCH_MAXDRIFT, 1e-3);
+  Test_Exit();
+  return 0;
+}
@@ -0,0 +1,115 @@
+//*****************************************************************************
+// test_onset.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the onset detector of onset.c on noise with bursts at known
+// samples: each burst is found once, in the hop it starts in, and none of
+// the noise is; the capture holds the samples around the event in order
+// with the event where eventOffset says; a burst while a capture is held
+// is counted as missed, one within the holdoff is not seen at all, and
+// the ring serves as the history of the last ONSET_CAPTURELEN samples.
+
+#include <stdint.h>
+#include <math.h>
+#include "test.h"
+#include "onset.h"
+
+#define SAMPLES  160000
+#define DC       2048        // ADC midscale
+#define NOISE    30          // background noise amplitude
+#define BURST    2000        // burst amplitude, decaying
+#define POST     512         // samples captured after the event hop
+#define HOLDOFF  6400        // samples between events
+#define NUMBURSTS 5
+
+static int16_t Input[SAMPLES];
+static int16_t Capture[ONSET_CAPTURELEN];
+// burst 1 comes while burst 0 is held, 3 within the holdoff of 2
+static const uint32_t Start[NUMBURSTS] = {20011, 50007, 90013, 93013, 130029};
+#define RELEASE1 60000       // burst 0 released
+#define RELEASE2 110000      // burst 2 released
+
+static void makeInput(void){
+  uint32_t n, b;
+  double x;
+  for(n = 0; n < SAMPLES; n++){
+    x = DC + (int)(Test_Random()%(2*NOISE + 1)) - NOISE;
+    for(b = 0; b < NUMBURSTS; b++){
+      if((n >= Start[b]) && (n < Start[b] + 1500)){
+        x += BURST*exp(-(n - Start[b])/300.0)*(((int)(Test_Random()%2001) - 1000)/1000.0);
+      }
+    }
+    Input[n] = (int16_t)x;
+  }
+}
+
+// the capture is the input around the event, in time order
+static int captureMatches(onsetType *o){
+  uint32_t i, first = o->eventSample - o->eventOffset;
+  if(Onset_Read(o, Capture) == 0){
+    return 0;
+  }
+  for(i = 0; i < ONSET_CAPTURELEN; i++){
+    if(Capture[i] != Input[first + i]){
+      return 0;
+    }
+  }
+  return 1;
+}
+
+int main(void){
+  onsetType o;
+  uint32_t n, b, found[NUMBURSTS] = {0}, when[NUMBURSTS] = {0}, noise = 0, history = 0;
+  int16_t old;
+  makeInput();
+  CHECK(Onset_Init(&o, ONSET_CAPTURELEN - ONSET_HOP, HOLDOFF) == 0);
+  CHECK(Onset_Init(&o, POST, HOLDOFF));
+  for(n = 0; n < SAMPLES; n++){
+    if(n == RELEASE1){
+      CHECK(o.state == ONSET_CAPTURED);
+      CHECK(o.eventSample == when[0]); // burst 1 did not move the capture
+      CHECK(captureMatches(&o));
+      Onset_Release(&o);
+      CHECK(Onset_Read(&o, Capture) == 0);
+    }
+    if(n == RELEASE2){
+      CHECK(o.eventSample == when[2]);
+      CHECK(captureMatches(&o));
+      Onset_Release(&o);
+    }
+    if(Onset_Oldest(&o, &old)){
+      if((n < Start[0]) && (n >= ONSET_CAPTURELEN) && (old != Input[n - ONSET_CAPTURELEN])){
+        history++;
+      }
+    }else{
+      CHECK(o.state == ONSET_CAPTURED);
+    }
+    if(Onset_Update(&o, Input[n])){
+      for(b = NUMBURSTS; b > 0; b--){ // the latest burst started by now
+        if(n >= Start[b-1]){
+          break;
+        }
+      }
+      if((b == 0) || (n >= Start[b-1] + 2*ONSET_HOP)){
+        noise++;                 // not on the rise of a burst
+      }else{
+        found[b-1]++;
+        when[b-1] = n + 1 - ONSET_HOP;
+      }
+    }
+  }
+  CHECK(noise == 0);
+  CHECK(history == 0);
+  for(b = 0; b < NUMBURSTS; b++){
+    CHECK(found[b] == (b != 3)); // burst 3 in the holdoff
+    if(b != 3){
+      CHECK((when[b] <= Start[b]) && (Start[b] < when[b] + ONSET_HOP)); // in its hop
+    }
+  }
+  CHECK(o.events == 4);
+  CHECK(o.missed == 1);          // burst 1
+  CHECK(o.eventSample == when[4]);
+  CHECK(o.eventOffset == ONSET_CAPTURELEN - POST - ONSET_HOP);
+  CHECK(captureMatches(&o));
+  Test_Exit();
+  return 0;
+}
@@ -0,0 +1,165 @@
+//*****************************************************************************
+// test_peaks.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the peak tracker of peaks.c with the bins of user.c on the dB
+// spectra of Hann windowed tones: the picked peaks are at the tones'
+// frequencies and levels, strongest first, only the strongest and those
+// within PEAKS_RANGE; a gliding tone stays one track, a jump starts a new
+// one and the old one dies, a tone that drops out for PEAKS_MAXMISSED
+// frames keeps its track, and a track is reported once it has been continued PEAKS_STABLE
+// frames.
+
+#include <stdint.h>
+#include <math.h>
+#include "test.h"
+#include "peaks.h"
+
+#define N      1024          // SAMPLELENGTH
+#define BINS   511           // MAGNUM-1
+#define BINHZ  62.5          // 64000/1024
+#define FLOOR  -100.0        // dB where there is no tone
+#define WIDTH  12            // bins computed either side of a tone
+#define LEVELTOL 0.4         // dB, of the parabolic fit
+#define GLIDE  3.5           // bins a frame, more than PEAKS_MAXJUMP
+
+struct tone{
+  double bin, dB;            // frequency in bins, level of the peak in dB
+};
+
+static float32_t dB[BINS];
+static peaksType P;
+
+// the dB spectrum of Hann windowed tones, by a DFT of the bins near each,
+// scaled so that a tone on a bin peaks at its level
+static void spectrum(const struct tone *t, uint32_t numTones){
+  double re, im, w, a, mag[BINS + 1] = {0};
+  uint32_t i, k, n;
+  for(i = 0; i < numTones; i++){
+    a = pow(10, t[i].dB/20)*4/N;
+    for(k = (t[i].bin > WIDTH) ? (uint32_t)t[i].bin - WIDTH : 1;
+        (k <= t[i].bin + WIDTH) && (k <= BINS); k++){
+      re = im = 0;
+      for(n = 0; n < N; n++){
+        w = a*(0.5 - 0.5*cos(2*M_PI*n/N))*cos(2*M_PI*t[i].bin*n/N);
+        re += w*cos(2*M_PI*k*n/N);
+        im -= w*sin(2*M_PI*k*n/N);
+      }
+      mag[k] += sqrt(re*re + im*im); // tones far enough apart to add
+    }
+  }
+  for(k = 1; k <= BINS; k++){
+    dB[k-1] = (mag[k] > pow(10, FLOOR/20)) ? (float32_t)(20*log10(mag[k])) : FLOOR;
+  }
+}
+
+static double uniform(void){
+  return (double)Test_Random()/0x7FFFFFFF;
+}
+
+// the track following frequency f, 0 if none
+static trackType *trackAt(double f){
+  uint32_t i;
+  for(i = 0; i < PEAKS_MAXTRACKS; i++){
+    if(P.tracks[i].id && (fabs(P.tracks[i].freq - f) < BINHZ)){
+      return &P.tracks[i];
+    }
+  }
+  return 0;
+}
+
+int main(void){
+  struct tone t[10];
+  float32_t freq[PEAKS_MAXTRACKS], amp[PEAKS_MAXTRACKS];
+  double worstF = 0, worstA = 0;
+  uint32_t i, k, id, old;
+  trackType *tr;
+  Peaks_Init(&P, BINHZ);
+  // a tone anywhere between bins, found at its frequency and level
+  for(i = 0; i < 200; i++){
+    t[0].bin = 5 + 490*uniform();
+    t[0].dB = 60;
+    spectrum(t, 1);
+    Peaks_Update(&P, dB, BINS);
+    CHECK(P.numPeaks == 1);
+    if(fabs(P.peaks[0].freq - t[0].bin*BINHZ) > worstF){
+      worstF = fabs(P.peaks[0].freq - t[0].bin*BINHZ);
+    }
+    if(fabs(P.peaks[0].amp - t[0].dB) > worstA){
+      worstA = fabs(P.peaks[0].amp - t[0].dB);
+    }
+  }
+  CHECK(worstF < 0.02*BINHZ);        // parabolic fit to a Hann peak in dB,
+  CHECK(worstA < LEVELTOL);          // a third of a dB high half way between bins
+  // ten tones 40 bins apart, levels 3 dB apart: the strongest first, those
+  // more than PEAKS_RANGE down left out, only PEAKS_MAXPEAKS kept
+  Peaks_Init(&P, BINHZ);
+  for(i = 0; i < 10; i++){
+    t[i].bin = 20 + 40*i + 0.3;
+    t[i].dB = 70 - 3*((i*7)%10);     // in no order of frequency
+  }
+  spectrum(t, 10);
+  Peaks_Update(&P, dB, BINS);
+  CHECK(P.numPeaks == PEAKS_MAXPEAKS);
+  for(k = 0; k < P.numPeaks; k++){
+    CHECKNEAR(P.peaks[k].amp, 70 - 3*k, LEVELTOL);
+  }
+  t[0].dB = 70;
+  t[1].dB = 70 - PEAKS_RANGE - 1;
+  spectrum(t, 2);
+  Peaks_Update(&P, dB, BINS);
+  CHECK(P.numPeaks == 1);
+  // a tone gliding GLIDE bins a frame, past PEAKS_MAXJUMP from where it
+  // was but not from where it was heading: one track, stable after
+  // PEAKS_STABLE continuations; its first step is within reach
+  Peaks_Init(&P, BINHZ);
+  t[0].bin = 100.2;
+  t[0].dB = 60;
+  t[1].bin = 300.5;                  // a steady tone 10 dB down
+  t[1].dB = 50;
+  spectrum(t, 2);
+  Peaks_Update(&P, dB, BINS);
+  CHECK(Peaks_Stable(&P, freq, amp, PEAKS_MAXTRACKS) == 0);
+  id = trackAt(t[0].bin*BINHZ)->id;
+  for(i = 1; i < 20; i++){
+    t[0].bin += (i == 1) ? GLIDE - 2 : GLIDE;
+    spectrum(t, 2);
+    Peaks_Update(&P, dB, BINS);
+    tr = trackAt(t[0].bin*BINHZ);
+    CHECK(tr && (tr->id == id));
+    CHECK(Peaks_Stable(&P, freq, amp, PEAKS_MAXTRACKS) == ((i < PEAKS_STABLE) ? 0 : 2));
+  }
+  CHECKNEAR(freq[0], t[0].bin*BINHZ, 0.02*BINHZ);   // strongest first
+  CHECKNEAR(freq[1], t[1].bin*BINHZ, 0.02*BINHZ);
+  CHECKNEAR(amp[1], 50, LEVELTOL);
+  CHECK(Peaks_Stable(&P, freq, 0, 1) == 1);          // room for one, the strongest
+  CHECKNEAR(freq[0], t[0].bin*BINHZ, 0.02*BINHZ);
+  CHECK(Peaks_Stable(&P, 0, amp, 1) == 1);
+  CHECKNEAR(amp[0], 60, LEVELTOL);
+  // the steady tone drops out for PEAKS_MAXMISSED frames: not reported
+  // meanwhile, then the same track again
+  old = trackAt(t[1].bin*BINHZ)->id;
+  for(i = 0; i < PEAKS_MAXMISSED; i++){
+    t[0].bin += GLIDE;
+    spectrum(t, 1);
+    Peaks_Update(&P, dB, BINS);
+    CHECK(Peaks_Stable(&P, freq, amp, PEAKS_MAXTRACKS) == 1);
+  }
+  t[0].bin += GLIDE;
+  spectrum(t, 2);
+  Peaks_Update(&P, dB, BINS);
+  CHECK(trackAt(t[1].bin*BINHZ)->id == old);
+  CHECK(Peaks_Stable(&P, freq, amp, PEAKS_MAXTRACKS) == 2);
+  // the glide jumps 20 bins: a new track, the old one coasts and dies
+  t[0].bin += 20;
+  for(i = 0; i <= PEAKS_MAXMISSED; i++){
+    spectrum(t, 2);
+    Peaks_Update(&P, dB, BINS);
+    tr = trackAt(t[0].bin*BINHZ);
+    CHECK(tr && (tr->id != id) && (tr->age == i));
+    k = (trackAt((t[0].bin - 20 + GLIDE*(i + 1))*BINHZ) != 0); // the old one coasting
+    CHECK(k == (i < PEAKS_MAXMISSED));
+  }
+  CHECK(P.nextId == id + 3);         // the steady tone, then the jump
+  Test_Exit();
+  return 0;
+}
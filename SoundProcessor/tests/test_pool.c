@@ -0,0 +1,282 @@
+//*****************************************************************************
+// test_pool.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the fixed-block pool of pool.c: a randomised stress of
+// allocations and frees of many sizes, from a thread and at the same time
+// from an event thread as an interrupt would, checks that no two blocks
+// in use overlap, that no block is corrupted while in use, that every
+// count adds up, and that a bad or repeated free is refused. The use of
+// the pool is reported, how much of each block the requests filled and
+// how often a request was refused while a larger class had room.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "test.h"
+#include "host.h"
+#include "os.h"
+#include "pool.h"
+#include "CortexM.h"
+
+#define NUMCLASSES 4
+#define MAXLIVE    8         // blocks a user holds at most
+#define STEPS      20000     // operations of the thread
+#define WORDS      4000      // arena
+static const uint32_t Sizes[NUMCLASSES] = {16, 100, 1024, 4096};
+static const uint32_t Counts[NUMCLASSES] = {8, 6, 4, 2};
+
+static uint32_t Arena[WORDS];
+static poolType Pool;
+
+struct block{
+  uint8_t *start;
+  uint32_t size;             // bytes asked for and filled with the tag
+  uint8_t tag;
+};
+struct user{
+  struct block live[MAXLIVE];
+  uint32_t n;                // blocks held
+  uint8_t tag;               // of the next block
+  uint32_t allocs[NUMCLASSES], refused[NUMCLASSES], couldBorrow[NUMCLASSES];
+  uint64_t requested[NUMCLASSES]; // bytes asked for in blocks given
+  uint32_t overlaps, corrupt, outside, badFrees;
+};
+static struct user Thread, Handler;
+
+static int classIndex(uint32_t size){
+  int i;
+  for(i = 0; i < NUMCLASSES; i++){
+    if(size <= Sizes[i]){
+      return i;
+    }
+  }
+  return -1;
+}
+
+// a size in a random class, now and then one no class holds
+static uint32_t randomSize(void){
+  uint32_t i = Test_Random()%(NUMCLASSES + 1), low;
+  if(i == NUMCLASSES){
+    return Sizes[NUMCLASSES-1] + 1 + Test_Random()%100;
+  }
+  low = (i == 0) ? 0 : Sizes[i-1];
+  return low + 1 + Test_Random()%(Sizes[i] - low);
+}
+
+static int overlaps(struct user *u, uint8_t *start, uint32_t size){
+  uint32_t i;
+  for(i = 0; i < u->n; i++){
+    if((start < u->live[i].start + Sizes[classIndex(u->live[i].size)]) &&
+       (u->live[i].start < start + size)){
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// the block lies on a block boundary of the class its size belongs to
+static int inClass(uint8_t *start, uint32_t size){
+  poolClassType *c = &Pool.classes[classIndex(size)];
+  return (start >= (uint8_t *)c->base) && (start < (uint8_t *)c->end) &&
+         (((start - (uint8_t *)c->base)%c->size) == 0);
+}
+
+static int intact(struct block *b){
+  uint32_t i;
+  for(i = 0; i < b->size; i++){
+    if(b->start[i] != b->tag){
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static void allocate(struct user *u){
+  uint32_t size = randomSize(), j;
+  int i = classIndex(size);
+  uint8_t *start = Pool_Alloc(&Pool, size);
+  struct block *b;
+  if(i < 0){
+    if(start){
+      u->outside++;
+    }
+    return;
+  }
+  if(start == 0){
+    u->refused[i]++;
+    for(j = i + 1; j < NUMCLASSES; j++){
+      if(Pool_Available(&Pool, Sizes[j])){
+        u->couldBorrow[i]++;
+        break;
+      }
+    }
+    return;
+  }
+  if((inClass(start, size) == 0) || overlaps(&Thread, start, size) || overlaps(&Handler, start, size)){
+    u->overlaps++;
+  }
+  u->allocs[i]++;
+  u->requested[i] += size;
+  b = &u->live[u->n];
+  b->start = start;
+  b->size = size;
+  b->tag = ++u->tag;
+  memset(start, b->tag, size);
+  u->n++;                      // after the fill, the other user checks only what is tagged
+}
+
+static void release(struct user *u){
+  uint32_t k = Test_Random()%u->n;
+  struct block b = u->live[k];
+  if(intact(&b) == 0){
+    u->corrupt++;
+  }
+  u->live[k] = u->live[u->n-1];
+  u->n--;                      // out of the table before the pool can give it away again
+  if(Pool_Free(&Pool, b.start) == 0){
+    u->badFrees++;
+  }
+}
+
+static void step(struct user *u){
+  if((u->n < MAXLIVE) && ((u->n == 0) || (Test_Random()%2))){
+    allocate(u);
+  }else{
+    release(u);
+  }
+}
+
+void Event(void){              // as an interrupt would, between any two operations of the thread
+  step(&Handler);
+  step(&Handler);
+}
+
+static void report(struct user *u, const char *name){
+  uint32_t i;
+  for(i = 0; i < NUMCLASSES; i++){
+    printf("  %-12s %4u byte blocks: %6u given, %3.0f%% of each used, %5u refused, %5u with a larger class free\n",
+      name, Sizes[i], u->allocs[i],
+      u->allocs[i] ? 100.0*u->requested[i]/u->allocs[i]/Sizes[i] : 0.0,
+      u->refused[i], u->couldBorrow[i]);
+  }
+}
+
+static void checkUser(struct user *u){
+  uint32_t i;
+  CHECK(u->overlaps == 0);
+  CHECK(u->corrupt == 0);
+  CHECK(u->outside == 0);
+  CHECK(u->badFrees == 0);
+  for(i = 0; i < u->n; i++){
+    CHECK(intact(&u->live[i]));
+  }
+}
+
+// used blocks as the users hold them, free ones as the lists link them
+static void checkCounts(void){
+  uint32_t i, j, held, free;
+  poolClassType *c;
+  void *f;
+  for(i = 0; i < NUMCLASSES; i++){
+    c = &Pool.classes[i];
+    held = 0;
+    for(j = 0; j < Thread.n; j++){
+      held += classIndex(Thread.live[j].size) == i;
+    }
+    for(j = 0; j < Handler.n; j++){
+      held += classIndex(Handler.live[j].size) == i;
+    }
+    free = 0;
+    for(f = c->free; f && (free <= c->count); f = *(void **)f){
+      free++;
+    }
+    CHECK(c->used == held);
+    CHECK(free + c->used == c->count);
+    CHECK(Pool_Available(&Pool, Sizes[i]) == free);
+    CHECK(c->peak <= c->count);
+    CHECK(c->fails == Thread.refused[i] + Handler.refused[i]);
+  }
+}
+
+void Task(void){
+  uint32_t i, j, runs, overruns;
+  long sr;
+  void *b[8];
+  for(i = 0; i < STEPS; i++){
+    step(&Thread);
+    Host_Busy(Test_Random()%(TEST_SLICE/8));
+  }
+  sr = StartCritical();        // the event thread holds still
+  checkUser(&Thread);
+  checkUser(&Handler);
+  checkCounts();
+  OS_EventStats(0, &runs, &overruns);
+  printf("  %u operations of the thread, %u runs of the event thread\n", STEPS, runs);
+  report(&Thread, "thread");
+  report(&Handler, "event thread");
+  for(i = 0; i < NUMCLASSES; i++){
+    CHECK(Pool.classes[i].peak == Counts[i]); // the stress used every block
+    CHECK(Thread.allocs[i] && Handler.allocs[i]);
+  }
+  // give back everything, then every block can be had once and only once
+  while(Thread.n){
+    release(&Thread);
+  }
+  while(Handler.n){
+    release(&Handler);
+  }
+  CHECK(Thread.badFrees + Handler.badFrees == 0);
+  for(i = 0; i < NUMCLASSES; i++){
+    CHECK(Pool.classes[i].used == 0);
+    for(j = 0; j < Counts[i]; j++){
+      b[j] = Pool_Alloc(&Pool, Sizes[i]);
+      CHECK(b[j] && inClass(b[j], Sizes[i]));
+      CHECK((j == 0) || (b[j] != b[j-1]));
+    }
+    CHECK(Pool_Alloc(&Pool, Sizes[i]) == 0);
+    for(j = 0; j < Counts[i]; j++){
+      CHECK(Pool_Free(&Pool, b[j]));
+    }
+  }
+  EndCritical(sr);
+  Test_Exit();
+}
+
+int main(void){
+  uint32_t sizes[NUMCLASSES] = {16, 100, 100, 4096}, counts[1] = {2};
+  uint8_t *b, *c;
+  // sizes that cannot make a pool
+  CHECK(Pool_Init(&Pool, Arena, WORDS, Sizes, Counts, 0) == 0);
+  CHECK(Pool_Init(&Pool, Arena, WORDS, Sizes, Counts, POOL_MAXCLASSES + 1) == 0);
+  CHECK(Pool_Init(&Pool, Arena, WORDS, sizes, Counts, NUMCLASSES) == 0); // not increasing
+  CHECK(Pool_Init(&Pool, Arena, 1000, Sizes, Counts, NUMCLASSES) == 0);  // arena too small
+  sizes[0] = sizeof(void *) - 4; // a word short of the link on the host, no words on the board
+  CHECK(Pool_Init(&Pool, Arena, WORDS, sizes, counts, 1) == 0);          // no room for the link
+  CHECK(Pool.numClasses == 0);
+  CHECK(Pool_Alloc(&Pool, 1) == 0);
+  CHECK(Pool_Init(&Pool, Arena, WORDS, Sizes, Counts, NUMCLASSES));
+  // frees the pool must refuse, and leave the counts as they were
+  b = Pool_Alloc(&Pool, 50);
+  c = Pool_Alloc(&Pool, 50);
+  CHECK(b && c && (c == b + 100)); // in address order
+  CHECK(Pool_Available(&Pool, 50) == Counts[1] - 2);
+  CHECK(Pool_Free(&Pool, 0));
+  CHECK(Pool_Free(&Pool, b + 4) == 0);       // inside the block
+  CHECK(Pool_Free(&Pool, Arena + WORDS) == 0); // not in the pool
+  CHECK(Pool_Free(&Pool, b));
+#if POOL_CHECK
+  CHECK(Pool_Free(&Pool, b) == 0);           // again
+#endif
+  CHECK(Pool_Available(&Pool, 50) == Counts[1] - 1);
+  CHECK(Pool_Alloc(&Pool, 50) == b);         // the list is still a list
+  CHECK(Pool_Alloc(&Pool, Sizes[NUMCLASSES-1] + 1) == 0); // too large, not a refusal
+  CHECK(Pool_Free(&Pool, b) && Pool_Free(&Pool, c));
+  CHECK(Pool.classes[1].used == 0);
+  CHECK(Pool.classes[1].peak == 2);
+  CHECK(Pool.classes[NUMCLASSES-1].fails == 0);
+  CHECK(Pool_Init(&Pool, Arena, WORDS, Sizes, Counts, NUMCLASSES));
+  OS_Init();
+  OS_AddPeriodicEventThread(Event, 1, 0);
+  Test_Launch(Task, 0, 0);
+  return 0;
+}
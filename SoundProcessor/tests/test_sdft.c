@@ -0,0 +1,177 @@
+//*****************************************************************************
+// test_sdft.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the sliding DFT of sdft.c with the band and window of user.c
+// against a direct DFT of the same window, in double precision, over
+// millions of samples of the integer ADC values it is given: re-anchored
+// every SDFTANCHOR windows the bins stay within -54 dB, left to run
+// without re-anchoring the error grows no faster than DRIFT a sample, a
+// re-anchor makes it exact again, a history that was overwritten is
+// reported invalid until a whole window has been re-anchored, and bad bin
+// ranges are refused.
+
+#include <stdint.h>
+#include <math.h>
+#include "test.h"
+#include "sdft.h"
+
+#define N       1024         // window length, SAMPLELENGTH and ONSET_CAPTURELEN
+#define FIRST   8            // SDFTFIRSTBIN
+#define BINS    SDFT_MAXBINS // SDFTNUMBINS
+#define ANCHOR  32           // SDFTANCHOR
+#define SAMPLES 4000000      // about a minute at 64 kHz, each run
+#define NEVER   0xFFFFFFFF   // windows between re-anchors, none in a run
+#define SPACING 997          // samples between checks, prime to N
+#define DRIFT   5e-8         // growth of the error a sample, relative to the strongest bin
+#define TOL     2e-3         // DRIFT over ANCHOR windows and a margin, -54 dB
+#define DBTOL   0.02         // dB, for bins within 40 dB of the strongest
+#define EXACT   1e-4         // just after a re-anchor, its one window of rotation, -80 dB
+
+static int16_t History[N];   // the last N samples, as the onset ring keeps them
+static uint32_t Pos;
+static double Cos[N], Sin[N];
+
+// ADC values: tones on and between the tracked bins, a drifting one, and
+// noise, about the mid scale
+static int16_t sample(uint32_t n){
+  double t = n;
+  return (int16_t)floor(2048 + 1000*sin(2*M_PI*(FIRST + 3)*t/N) +
+                        300*cos(2*M_PI*(FIRST + 8.5)*t/N + 1) +
+                        200*sin(2*M_PI*(FIRST + 12 + 2*sin(t/5000))*t/N) +
+                        (double)(Test_Random()%401) - 200.0 + 0.5);
+}
+
+// the direct DFT of the window
+static void direct(double *re, double *im){
+  uint32_t i, m;
+  for(i = 0; i < BINS; i++){
+    re[i] = 0;
+    im[i] = 0;
+    for(m = 0; m < N; m++){    // oldest sample first
+      re[i] += History[(Pos + m)%N]*Cos[((FIRST + i)*m)%N];
+      im[i] -= History[(Pos + m)%N]*Sin[((FIRST + i)*m)%N];
+    }
+  }
+}
+
+static void push(sdftType *s, int16_t x){
+  SDFT_Update(s, x, History[Pos]);
+  History[Pos] = x;
+  Pos = (Pos + 1)%N;
+}
+
+// largest error of the complex bins relative to the strongest, and of
+// the dB values of the bins within 40 dB of it
+static double error(sdftType *s, double *dBError, int *valid){
+  float32_t dB[BINS];
+  double re[BINS], im[BINS], p, top = 0, worst = 0;
+  uint32_t i;
+  *valid = SDFT_Magnitude(s, dB);
+  direct(re, im);
+  for(i = 0; i < BINS; i++){
+    p = re[i]*re[i] + im[i]*im[i];
+    top = (p > top) ? p : top;
+  }
+  *dBError = 0;
+  for(i = 0; i < BINS; i++){
+    p = hypot(s->re[i] - re[i], s->im[i] - im[i])/sqrt(top);
+    worst = (p > worst) ? p : worst;
+    p = re[i]*re[i] + im[i]*im[i];
+    if((p > top*1e-4) && (fabs(dB[i] - 10*log10(p)) > *dBError)){
+      *dBError = fabs(dB[i] - 10*log10(p));
+    }
+  }
+  return worst;
+}
+
+int main(void){
+  sdftType s;
+  uint32_t n, bad = 0, invalid = 0, checked = 0;
+  double e, dBe, worst = 0, worstdB = 0, drift = 0;
+  int valid;
+  for(n = 0; n < N; n++){
+    Cos[n] = cos(2*M_PI*n/N);
+    Sin[n] = sin(2*M_PI*n/N);
+  }
+  CHECK(SDFT_Init(&s, 0, 4, N, ANCHOR) == 0);        // DC
+  CHECK(SDFT_Init(&s, N/2 - 3, 4, N, ANCHOR) == 0);  // past N/2-1
+  CHECK(SDFT_Init(&s, FIRST, 0, N, ANCHOR) == 0);
+  CHECK(SDFT_Init(&s, FIRST, BINS + 1, N, ANCHOR) == 0);
+  CHECK(SDFT_Init(&s, FIRST, BINS, N, 0) == 0);
+  CHECK(SDFT_Init(&s, FIRST, BINS, N, ANCHOR));
+  // re-anchored as user.c does, from the empty history
+  for(n = 0; n < SAMPLES; n++){
+    push(&s, sample(n));
+    if(n%SPACING == 0){        // spread over the window
+      e = error(&s, &dBe, &valid);
+      invalid += valid == 0;
+      bad += (e > TOL) || (dBe > DBTOL);
+      worst = (e > worst) ? e : worst;
+      worstdB = (dBe > worstdB) ? dBe : worstdB;
+      checked++;
+    }
+  }
+  CHECK(invalid == 0);
+  CHECK(bad == 0);
+  CHECK(worst < TOL);
+  CHECK(worstdB < DBTOL);
+  CHECK(checked > SAMPLES/SPACING);
+  // never re-anchored: e^(j2pik/N) in float32 is not quite an N-th root
+  // of unity, so each sample leaves a little of itself behind when it
+  // leaves the window and the error grows in proportion to the run
+  CHECK(SDFT_Init(&s, FIRST, BINS, N, NEVER));
+  for(n = 0; n < N; n++){
+    History[n] = 0;            // the empty history Init assumes
+  }
+  for(n = 0; n < SAMPLES; n++){
+    push(&s, sample(n));
+    if(n%SPACING == 0){
+      e = error(&s, &dBe, &valid);
+      bad += e > EXACT + DRIFT*n;
+      drift = (e > drift) ? e : drift;
+      invalid += valid == 0;
+    }
+  }
+  CHECK(invalid == 0);
+  CHECK(bad == 0);
+  CHECK(drift > 0.1*DRIFT*SAMPLES);  // it does build up, re-anchoring is what bounds it
+  CHECK(drift > 20*worst);
+  // a re-anchor after the long run makes it exact again
+  SDFT_Invalidate(&s);
+  for(n = 0; n < 2*N; n++){    // the rest of this window, then the one anchored
+    push(&s, sample(n));
+  }
+  CHECK(error(&s, &dBe, &valid) < EXACT);
+  CHECK(dBe < DBTOL);
+  CHECK(valid);
+  // the history overwritten part way through a window
+  CHECK(SDFT_Init(&s, FIRST, BINS, N, ANCHOR));
+  for(n = 0; n < N; n++){
+    History[n] = 0;
+  }
+  Pos = 0;
+  for(n = 0; n < 5*N + N/3; n++){
+    push(&s, sample(n));
+  }
+  for(n = 0; n < N; n++){
+    History[n] = 0;            // e.g. the ring refilled, SDFT_Invalidate says so
+  }
+  SDFT_Invalidate(&s);
+  for(n = N/3; n < 2*N - 1; n++){ // rest of this window, then the one anchored
+    push(&s, sample(n));
+    error(&s, &dBe, &valid);
+    invalid += valid;          // none valid yet
+  }
+  CHECK(invalid == 0);
+  push(&s, sample(n++));
+  CHECK(error(&s, &dBe, &valid) < EXACT);
+  CHECK(valid);
+  for(; n < 4*N; n++){
+    push(&s, sample(n));
+  }
+  CHECK(error(&s, &dBe, &valid) < TOL);
+  CHECK(dBe < DBTOL);
+  CHECK(valid);
+  Test_Exit();
+  return 0;
+}
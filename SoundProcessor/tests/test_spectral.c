@@ -0,0 +1,196 @@
+//*****************************************************************************
+// test_spectral.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the spectral descriptors of spectral.c against the definitions
+// in double precision, for random spectra and for the known cases: a flat
+// spectrum is white, a 1/f (pink) spectrum has the centroid, spread,
+// flatness and roll-off of the harmonic sums, a tone has its own frequency
+// and no spread, a rise of the level shows as flux, and silence gives the
+// floor level, never -inf.
+
+#include <stdint.h>
+#include <math.h>
+#include "test.h"
+#include "spectral.h"
+
+#define BINS   512           // as user.c
+#define BINHZ  62.5          // 64000/1024
+#define REL    1e-4          // relative error of the descriptors
+#define EULER  0.5772156649015329 // Euler-Mascheroni constant
+#define FRAMES 4000          // pink noise frames averaged
+
+static float32_t Power[BINS];
+static float32_t dB[BINS];
+
+struct reference{
+  double centroid, spread, flatness, rolloff, flux;
+};
+
+static void reference(const float32_t *power, const float32_t *previous, struct reference *r){
+  double sumP = 0, sumFP = 0, sumFFP = 0, sumDb = 0, sumRise = 0, mean, level, tail;
+  uint32_t k;
+  for(k = 1; k < BINS; k++){
+    level = (power[k] < SPECTRAL_ZEROPOWER) ? SPECTRAL_ZERODB : 10*log10(power[k]);
+    if(level > previous[k-1]){
+      sumRise += level - previous[k-1];
+    }
+    sumDb += (level < SPECTRAL_MINDB) ? SPECTRAL_MINDB : level;
+    sumP += power[k];
+    sumFP += k*(double)power[k];
+    sumFFP += (double)k*k*power[k];
+  }
+  mean = sumFP/sumP;
+  r->centroid = mean*BINHZ;
+  r->spread = sqrt(sumFFP/sumP - mean*mean)*BINHZ;
+  r->flatness = pow(10, sumDb/(10*(BINS - 1)))/(sumP/(BINS - 1));
+  r->flux = sumRise/(BINS - 1);
+  tail = 0;                    // the highest bin with 15% of the power at or above it
+  for(k = BINS - 1; k > 1; k--){
+    tail += power[k];
+    if(tail >= (1 - SPECTRAL_ROLLOFF)*sumP){
+      break;
+    }
+  }
+  r->rolloff = k*BINHZ;
+}
+
+// H(n) = 1 + 1/2 + ... + 1/n, to double precision for n over 10
+static double harmonic(double n){
+  return log(n) + EULER + 1/(2*n) - 1/(12*n*n);
+}
+
+// ln(n!) by Stirling's series, to double precision for n over 10
+static double logFactorial(double n){
+  return n*log(n) - n + 0.5*log(2*M_PI*n) + 1/(12*n);
+}
+
+static double relative(double a, double b){
+  return fabs(a - b)/fabs(b);
+}
+
+static double uniform(void){
+  return (double)Test_Random()/0x7FFFFFFF;
+}
+
+int main(void){
+  spectralType d;
+  struct reference r;
+  static float32_t previous[BINS];
+  uint32_t i, k, bad, rolloffs;
+  double n, centroid, spread, flatness, rolloff, meanFlatness, expected;
+  Spectral_Init(&d, BINHZ);
+  // random spectra, 80 dB of range with a slope, one after the other
+  bad = rolloffs = 0;
+  for(k = 0; k < BINS; k++){
+    dB[k] = SPECTRAL_ZERODB;
+  }
+  for(i = 0; i < 200; i++){
+    for(k = 0; k < BINS; k++){
+      Power[k] = (float32_t)(pow(10, 8*uniform())/(1 + k*(i%5)));
+      previous[k] = dB[k];
+    }
+    Spectral_Compute(&d, Power, dB, BINS);
+    reference(Power, previous, &r);
+    if(i == 0){
+      CHECK(d.flux == 0);      // no previous frame
+    }else if(relative(d.flux, r.flux) > REL){
+      bad++;
+    }
+    if((relative(d.centroid, r.centroid) > REL) || (relative(d.spread, r.spread) > 1e-3) ||
+       (relative(d.flatness, r.flatness) > 1e-3)){
+      bad++;
+    }
+    if(d.rolloff != (float32_t)r.rolloff){
+      rolloffs++;              // float sums may tip a bin at the boundary
+      bad += fabs(d.rolloff - r.rolloff) > BINHZ;
+    }
+    for(k = 1; k < BINS; k++){
+      if(fabs(dB[k-1] - 10*log10(Power[k])) > 1e-4){
+        bad++;
+      }
+    }
+  }
+  CHECK(bad == 0);
+  CHECK(rolloffs < 5);
+  // white
+  for(k = 0; k < BINS; k++){
+    Power[k] = 1000;
+  }
+  Spectral_Compute(&d, Power, dB, BINS);
+  CHECKNEAR(d.flatness, 1, 1e-4);
+  CHECKNEAR(d.centroid, BINS/2*BINHZ, 1e-2);
+  CHECKNEAR(d.spread, sqrt(((BINS - 1)*(BINS - 1) - 1)/12.0)*BINHZ, 1); // discrete uniform
+  CHECKNEAR(d.rolloff, ceil(0.85*(BINS - 1))*BINHZ, BINHZ);
+  // pink, power 1/k in bins 1 to n: the sums of k^m/k are n(n+1)/2, n and
+  // H(n), the geometric mean is (n!)^(-1/n), and 15% of the power is at or
+  // above the bin where H(n) - H(k-1) first drops below 0.15 H(n)
+  n = BINS - 1;
+  for(k = 0; k < BINS; k++){
+    Power[k] = (float32_t)(1e6/((k == 0) ? 1 : k));
+  }
+  Spectral_Compute(&d, Power, dB, BINS);
+  centroid = n/harmonic(n)*BINHZ;
+  spread = sqrt(n*(n + 1)/(2*harmonic(n)) - n*n/(harmonic(n)*harmonic(n)))*BINHZ;
+  flatness = n*exp(-logFactorial(n)/n)/harmonic(n);
+  rolloff = floor(1 + exp(0.85*harmonic(n) - EULER) + 0.5)*BINHZ; // H(k-1) = 0.85 H(n)
+  CHECKNEAR(d.centroid, centroid, REL*centroid);
+  CHECKNEAR(d.spread, spread, REL*spread);
+  CHECKNEAR(d.flatness, flatness, REL*flatness);
+  CHECKNEAR(d.rolloff, rolloff, BINHZ);
+  CHECKNEAR(flatness, 0.396, 0.001); // tonal enough that the VAD takes it as sound
+  // a periodogram of pink noise, each bin 1/k times an exponential of mean
+  // 1: the mean log of the exponential is -EULER, so the geometric mean is
+  // e^-EULER of the smooth spectrum's, and the arithmetic mean varies by
+  // sum 1/k^2 over H(n)^2, which to second order raises the mean of its
+  // inverse by as much; the geometric mean varies by pi^2/6n, half of that
+  expected = exp(-EULER)*flatness*(1 + (M_PI*M_PI/6 - 1/n)/(harmonic(n)*harmonic(n)))*
+             (1 + M_PI*M_PI/(12*n));
+  meanFlatness = 0;
+  for(i = 0; i < FRAMES; i++){
+    for(k = 0; k < BINS; k++){
+      Power[k] = (float32_t)(-1e6*log((Test_Random() + 1.0)/2147483649.0)/((k == 0) ? 1 : k));
+    }
+    Spectral_Compute(&d, Power, dB, BINS);
+    meanFlatness += d.flatness/FRAMES;
+  }
+  CHECKNEAR(meanFlatness, expected, 0.015*expected);  // e^-EULER alone is 3.5% low
+  // white again, then the level up 6 dB in every other bin
+  for(k = 0; k < BINS; k++){
+    Power[k] = 1000;
+  }
+  Spectral_Compute(&d, Power, dB, BINS);
+  for(k = 0; k < BINS; k += 2){
+    Power[k] *= 3.98107f;
+  }
+  Spectral_Compute(&d, Power, dB, BINS);
+  CHECKNEAR(d.flux, 6.0*(BINS/2 - 1)/(BINS - 1), 1e-3); // bins 2 to 510 of 1 to 511
+  // a tone in one bin, over a floor 100 dB down
+  for(k = 0; k < BINS; k++){
+    Power[k] = 1e-4f;
+  }
+  Power[100] = 1e6f;
+  Spectral_Compute(&d, Power, dB, BINS);
+  CHECKNEAR(d.centroid, 100*BINHZ, 0.01*BINHZ);
+  CHECK(d.spread < 2*BINHZ);
+  CHECK(d.flatness < 1e-6);
+  CHECK(d.rolloff == 100*BINHZ);
+  // silence, and a bin the notch emptied
+  for(k = 0; k < BINS; k++){
+    Power[k] = 0;
+  }
+  Spectral_Compute(&d, Power, dB, BINS);
+  CHECK((d.centroid == 0) && (d.spread == 0) && (d.flatness == 0) && (d.rolloff == 0));
+  bad = 0;
+  for(k = 0; k < BINS - 1; k++){
+    bad += dB[k] != SPECTRAL_ZERODB;
+  }
+  CHECK(bad == 0);
+  Power[50] = 1;
+  Spectral_Compute(&d, Power, dB, BINS);
+  CHECK(dB[49] == 0);
+  CHECK(dB[50] == SPECTRAL_ZERODB);
+  CHECKNEAR(d.flux, 120.0/(BINS - 1), 1e-4);
+  CHECK(isfinite(d.flatness));
+  Test_Exit();
+  return 0;
+}
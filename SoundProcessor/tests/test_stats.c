@@ -0,0 +1,86 @@
+//*****************************************************************************
+// test_stats.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the scheduler statistics of os.c: each thread is charged the
+// cycles it ran and nothing of the SysTick handler, periodic event threads
+// are charged to the handler, thread, idle and handler time add up to the
+// time elapsed, and the stack high water mark is the deepest word written.
+
+#include <stdint.h>
+#include "test.h"
+#include "host.h"
+#include "os.h"
+#include "CortexM.h"
+
+#define STACKSIZE 256        // must match os.c
+#define JOBA  30000          // cycles of work per job, less than a tick
+#define JOBB  100000         // more than a tick, so it is preempted
+#define EVENT 1000           // cycles of the periodic event thread
+#define DEPTH 100            // stack words the test marks as used
+
+extern intptr_t Stacks[3][STACKSIZE]; // os.c, pointer sized words with HOST defined
+
+// cycles of work begun and finished by each thread
+static uint64_t Begun[2], Done[2];
+static uint32_t Jobs[2];
+
+void Event(void){
+  Host_Busy(EVENT);
+}
+
+void TaskA(void){
+  while(1){
+    Begun[0] += JOBA;
+    Host_Busy(JOBA);
+    Done[0] += JOBA;
+    Jobs[0]++;
+    Test_Sleep(2);
+  }
+}
+
+void TaskB(void){
+  Stacks[1][DEPTH] = 0;        // the threads run on host stacks, write what a deep call would
+  while(1){
+    Begun[1] += JOBB;
+    Host_Busy(JOBB);
+    Done[1] += JOBB;
+    Jobs[1]++;
+    Test_Sleep(5);
+  }
+}
+
+void Check(void){
+  uint32_t i, cycles[3], switches[3], stack[3], runs, overruns;
+  uint32_t eventCycles, switchCycles, stackSize, elapsed, sum;
+  Test_Sleep(500);
+  elapsed = DWT_CYCCNT;        // since OS_Init
+  for(i = 0; i < 3; i++){
+    CHECK(OS_ThreadStats(i, &cycles[i], &switches[i], &stack[i]));
+  }
+  CHECK(OS_ThreadStats(3, &cycles[0], &switches[0], &stack[0]) == 0);
+  OS_HandlerStats(&eventCycles, &switchCycles, &stackSize);
+  CHECK(OS_EventStats(0, &runs, &overruns));
+  for(i = 0; i < 2; i++){      // what the thread ran, no more
+    CHECK((cycles[i] >= Done[i]) && (cycles[i] <= Begun[i]));
+    CHECK(switches[i] >= Jobs[i]);
+  }
+  CHECK(cycles[2] == 0);       // only woke up to check
+  CHECK((switches[2] >= 2) && (switches[2] <= 3)); // to start the sleep and after it, a tick may come between
+  CHECK(switches[1] > Jobs[1]); // preempted in every job
+  CHECK(eventCycles == runs*EVENT);
+  CHECK(switchCycles == 0);    // the scheduler itself takes no time on the host
+  sum = cycles[0] + cycles[1] + cycles[2] + OS_IdleCycles() + eventCycles + switchCycles;
+  CHECK(sum <= elapsed);
+  CHECKNEAR(sum, elapsed, TEST_SLICE); // the idle thread's last sleep is not counted yet
+  CHECK(stack[1] == sizeof(intptr_t)*(STACKSIZE - DEPTH));
+  CHECK(stack[0] == sizeof(intptr_t)*16); // the initial frame SetStack wrote
+  CHECK(stackSize == sizeof(intptr_t)*STACKSIZE);
+  Test_Exit();
+}
+
+int main(void){
+  OS_Init();
+  OS_AddPeriodicEventThread(Event, 1, 0);
+  Test_Launch(TaskA, TaskB, Check);
+  return 0;
+}
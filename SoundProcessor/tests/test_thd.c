@@ -0,0 +1,135 @@
+//*****************************************************************************
+// test_thd.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the distortion measurement of thd.c with the parameters of
+// user.c, on flat-top windowed frames transformed by a DFT in double and
+// packed as packPower() packs them: a tone anywhere between bins has its
+// amplitude and frequency, harmonics at known levels give their levels and
+// THD, white noise of known power gives the THD+N and SINAD it should,
+// harmonics above the band are left out, and tones too low or silence are
+// not measured.
+
+#include <stdint.h>
+#include <math.h>
+#include "test.h"
+#include "thd.h"
+
+#define FS     64000.0       // as user.c
+#define N      1024
+#define BINS   512           // MAGNUM
+#define BINHZ  (FS/N)
+#define BAND   20000.0       // THDBAND
+#define AMP    1000.0
+
+static float32_t Frame[N];
+static float32_t Power[BINS];
+static double Cos[N], Sin[N];
+static thdType T;
+
+struct harmonic{
+  uint32_t h;
+  double dB;                 // below the fundamental
+};
+
+// a frame of a tone at f Hz with harmonics and white noise of rms sigma,
+// windowed and transformed into Power
+static void frame(double f, const struct harmonic *harm, uint32_t numHarm, double sigma){
+  double x, u, v, re, im, phase = 2*M_PI*(Test_Random()%1000)/1000;
+  uint32_t i, k, n;
+  for(n = 0; n < N; n++){
+    x = AMP*cos(2*M_PI*f*n/FS + phase);
+    for(i = 0; i < numHarm; i++){
+      x += AMP*pow(10, harm[i].dB/20)*cos(2*M_PI*harm[i].h*f*n/FS + i);
+    }
+    if(sigma > 0){           // Box-Muller
+      u = (Test_Random() + 1.0)/2147483649.0;
+      v = Test_Random()/2147483648.0;
+      x += sigma*sqrt(-2*log(u))*cos(2*M_PI*v);
+    }
+    Frame[n] = (float32_t)x;
+  }
+  Thd_Window(&T, Frame);
+  for(k = 0; k < BINS; k++){
+    re = im = 0;
+    for(n = 0; n < N; n++){
+      re += Frame[n]*Cos[(k*n)%N];
+      im -= Frame[n]*Sin[(k*n)%N];
+    }
+    Power[k] = (float32_t)(re*re + im*im);
+  }
+}
+
+static double uniform(void){
+  return (double)Test_Random()/0x7FFFFFFF;
+}
+
+int main(void){
+  struct harmonic harm[3];
+  double f, worstA = 0, worstF = 0, worstT = 0, sumN, sumS, expect;
+  uint32_t i, n;
+  for(n = 0; n < N; n++){
+    Cos[n] = cos(2*M_PI*n/N);
+    Sin[n] = sin(2*M_PI*n/N);
+  }
+  Thd_Init(&T, BINHZ, N, BAND);
+  // a pure tone anywhere between bins
+  for(i = 0; i < 40; i++){
+    f = 600 + 4000*uniform();
+    frame(f, 0, 0, 0);
+    CHECK(Thd_Measure(&T, Power, BINS));
+    worstA = (fabs(20*log10(T.amplitude/AMP)) > worstA) ? fabs(20*log10(T.amplitude/AMP)) : worstA;
+    worstF = (fabs(T.f0 - f) > worstF) ? fabs(T.f0 - f) : worstF;
+    worstT = (T.thd > worstT) ? T.thd : worstT;
+  }
+  CHECK(worstA < 0.01);              // the flat-top's 0.01 dB
+  CHECK(worstF < 0.01);              // Hz, the lobe centroid
+  CHECK(worstT < 0.01);              // below -80 dB
+  CHECK(T.harmonic[2] < -80);
+  // the second harmonic 40 dB down and the third 50 dB down
+  harm[0].h = 2;
+  harm[0].dB = -40;
+  harm[1].h = 3;
+  harm[1].dB = -50;
+  frame(1234.5, harm, 2, 0);
+  CHECK(Thd_Measure(&T, Power, BINS));
+  CHECKNEAR(T.harmonic[2], -40, 0.05);
+  CHECKNEAR(T.harmonic[3], -50, 0.05);
+  CHECK(T.harmonic[4] < -80);
+  CHECKNEAR(T.thd, 100*sqrt(1e-4 + 1e-5), 0.005);
+  CHECKNEAR(T.thdn, T.thd, 0.005);   // no noise
+  // white noise 60 dB below the tone's power, rest over fundamental is the
+  // noise's share of the band bins over the tone's
+  sumN = sumS = 0;
+  for(i = 0; i < 20; i++){
+    frame(2000 + 10.3*i, 0, 0, AMP/sqrt(2)*1e-3);
+    CHECK(Thd_Measure(&T, Power, BINS));
+    sumN += T.thdn*T.thdn;
+    sumS += pow(10, -T.sinad/10);
+  }
+  n = (uint32_t)(BAND/BINHZ) - THD_HALFWIDTH - (2*THD_HALFWIDTH + 1); // the band but DC and the tone
+  expect = 1e-6*n*2/N;               // noise per bin is sigma^2 sum w^2, the tone A^2/4 N sum w^2
+  CHECKNEAR(sqrt(sumN/20)/100, sqrt(expect), 0.03*sqrt(expect));
+  CHECKNEAR(10*log10(sumS/20), 10*log10(expect/(1 + expect)), 0.3);
+  // harmonics above the band are left out
+  harm[0].h = 7;                     // 21 kHz
+  harm[0].dB = -20;
+  frame(3000, harm, 1, 0);
+  CHECK(Thd_Measure(&T, Power, BINS));
+  CHECK(T.harmonic[6] < -80);
+  CHECK(T.harmonic[7] == THD_MINDB);
+  CHECK(T.thd < 0.01);
+  // too low for the harmonic lobes to be apart, then just high enough
+  frame(7.5*BINHZ, 0, 0, 0);
+  CHECK(Thd_Measure(&T, Power, BINS) == 0);
+  CHECK(T.valid == 0);
+  frame(2*THD_MINHALFWIDTH*BINHZ + 10, 0, 0, 0);
+  CHECK(Thd_Measure(&T, Power, BINS));
+  CHECK(T.valid);
+  // silence
+  for(i = 0; i < BINS; i++){
+    Power[i] = 0;
+  }
+  CHECK(Thd_Measure(&T, Power, BINS) == 0);
+  Test_Exit();
+  return 0;
+}
@@ -0,0 +1,103 @@
+//*****************************************************************************
+// test_tickless.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the tickless idle thread of os.c: with every thread blocked the
+// idle thread sleeps through the ticks nothing is due on, yet the tick
+// count keeps to the clock, timed waits end on their tick and event
+// threads run on theirs, and the time asleep is counted as idle.
+
+#include <stdint.h>
+#include "test.h"
+#include "host.h"
+#include "os.h"
+#include "CortexM.h"
+
+#define PERIOD 100           // ticks between event thread runs
+#define PHASE  30
+#define NAPA   337           // ticks the threads sleep for
+#define NAPB   13
+#define WORKB  (2*TEST_SLICE + TEST_SLICE/2) // cycles of work between naps
+#define TICKS  5000          // ticks the test runs
+#define DRIFT  100           // cycles the tick boundaries may lag per sleep
+
+static uint32_t Wraps;       // SysTick interrupts taken
+static uint32_t Runs, Wrong, Late; // event thread runs, off their tick, off the clock
+static uint32_t NapsA, WrongA, NapsB, WrongB;
+static uint32_t First;       // DWT_CYCCNT at the first event thread run
+
+static void countWrap(void){
+  Wraps++;
+}
+
+void Event(void){
+  uint32_t tick = OS_TickCount(), now = DWT_CYCCNT;
+  if(tick != PHASE + 1 + Runs*PERIOD){
+    Wrong++;
+  }
+  if(Runs == 0){
+    First = now;
+  }else if((int32_t)(now - First - Runs*PERIOD*TEST_SLICE) > (int32_t)((Runs + 1)*DRIFT)){
+    Late++;
+  }
+  Runs++;
+}
+
+void TaskA(void){
+  uint32_t t;
+  while(1){
+    t = OS_TickCount();
+    Test_Sleep(NAPA);
+    if(OS_TickCount() - t != NAPA){
+      WrongA++;
+    }
+    NapsA++;
+  }
+}
+
+void TaskB(void){              // work across ticks between short naps
+  uint32_t t;
+  while(1){
+    Host_Busy(WORKB);
+    t = OS_TickCount();
+    Test_Sleep(NAPB);
+    if(OS_TickCount() - t != NAPB){
+      WrongB++;
+    }
+    NapsB++;
+  }
+}
+
+void Check(void){
+  uint32_t elapsed, ticks, expected;
+  Test_Sleep(TICKS);
+  elapsed = DWT_CYCCNT;
+  ticks = OS_TickCount();
+  CHECK(ticks == TICKS + 1);   // Check's first tick
+  CHECK(Runs == (ticks - 1 - PHASE)/PERIOD + 1);
+  CHECK(Wrong == 0);
+  CHECK(Late == 0);
+  CHECK(NapsA == TICKS/NAPA);
+  CHECK(WrongA == 0);
+  CHECK(WrongB == 0);
+  CHECK(NapsB > 0);
+  // the tick count keeps to the clock, a few cycles behind per sleep at most
+  CHECK(elapsed >= ticks*TEST_SLICE);
+  CHECKNEAR(elapsed, ticks*TEST_SLICE, Wraps*DRIFT);
+  // SysTick is taken on the ticks TaskB works through and once per wake
+  // up, the other ticks are slept through
+  expected = NapsB*(WORKB/TEST_SLICE + 2) + NapsA + Runs + 2;
+  CHECK(Wraps <= expected);
+  CHECK(Wraps < ticks/4);
+  // all but TaskB's work is idle, its latest job may not be done yet
+  CHECK(OS_IdleCycles() <= elapsed - NapsB*WORKB);
+  CHECK(OS_IdleCycles() >= elapsed - (NapsB + 1)*WORKB - TEST_SLICE);
+  Test_Exit();
+}
+
+int main(void){
+  OS_Init();
+  OS_AddPeriodicEventThread(Event, PERIOD, PHASE);
+  Test_Tick = countWrap;
+  Test_Launch(TaskA, TaskB, Check);
+  return 0;
+}
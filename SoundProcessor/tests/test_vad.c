@@ -0,0 +1,106 @@
+//*****************************************************************************
+// test_vad.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the activity detector of vad.c with the frames of user.c: a
+// tone over quiet noise is active from its first frame and for exactly the
+// hangover after it, its level and zero-crossing rate are as computed by
+// hand, loud flat noise with many crossings is not active until its stale
+// flatness has decayed, the floor follows a quieter room at once and a
+// louder one within its window, a loud tone at boot or one that lasts
+// longer than the window stays active, and Vad_Take reports any active
+// frame once.
+
+#include <stdint.h>
+#include <math.h>
+#include "test.h"
+#include "vad.h"
+
+#define FS     64000         // as user.c
+#define FRAME  1024          // SAMPLELENGTH
+#define DC     2048.0        // ADC midscale
+#define QUIET  10.0          // background noise amplitude
+
+static vadType V;
+static uint32_t Time;        // samples fed since the start
+static int32_t Active[200];  // decision of each frame of the last feed
+
+// feed frames of noise of amplitude noise plus a tone of amplitude amp at
+// f Hz, return the number decided active
+static uint32_t feed(uint32_t frames, double noise, double amp, double f){
+  uint32_t i, n, count = 0;
+  double x;
+  for(i = 0; i < frames; i++){
+    for(n = 0; n < FRAME; n++){
+      x = DC + amp*sin(2*M_PI*f*Time/FS);
+      x += noise*((int)(Test_Random()%2001) - 1000)/1000.0;
+      Vad_Update(&V, (float32_t)x);
+      Time++;
+    }
+    Active[i] = V.active;
+    count += V.active;
+  }
+  return count;
+}
+
+int main(void){
+  uint32_t n, frames;
+  float32_t quietFloor;
+  Vad_Init(&V, FRAME);
+  CHECK(Vad_Take(&V) == 1);        // the first frame is analysed
+  CHECK(Vad_Take(&V) == 0);
+  // quiet is inactive from the first frame, as the DC estimate starts at
+  // the first sample and the first frame sets the floor
+  CHECK(feed(60, QUIET, 0, 0) == 0);
+  CHECK(Vad_Take(&V) == 0);
+  quietFloor = V.floor;
+  CHECKNEAR(V.level, 10*log10(QUIET*QUIET/3 + 1), 0.5); // uniform noise
+  CHECK(V.zcr > VAD_ZCRMAX);
+  // a 1 kHz tone, active from its first frame, then the hangover
+  CHECK(feed(5, QUIET, 300, 1000) == 5);
+  CHECKNEAR(V.level, 10*log10(300.0*300/2 + QUIET*QUIET/3 + 1), 0.1);
+  CHECKNEAR(V.zcr, 2*1000.0/FS, 0.002);
+  CHECK(V.floor == quietFloor);    // the quiet frames are still in the window
+  CHECK(feed(10, QUIET, 0, 0) == VAD_HANGOVER);
+  for(n = 0; n < VAD_HANGOVER; n++){
+    CHECK(Active[n]);
+  }
+  CHECK(Vad_Take(&V) == 1);
+  CHECK(Vad_Take(&V) == 0);
+  // loud white noise that the spectrum found flat, until the flatness ages
+  Vad_SetFlatness(&V, 0.9f);
+  CHECK(feed(10, 30*QUIET, 0, 0) == 10 - 3); // 0.9, 0.72, 0.576 are flat
+  CHECK(!Active[0] && !Active[1] && !Active[2] && Active[3]);
+  for(n = frames = 0; n < 10; n++){ // a fresh flatness every frame keeps it out
+    Vad_SetFlatness(&V, 0.9f);
+    frames += feed(1, 30*QUIET, 0, 0);
+  }
+  CHECK(frames == VAD_HANGOVER);   // of the stale frames
+  CHECK(V.active == 0);
+  // the same noise with a structured spectrum is sound
+  Vad_SetFlatness(&V, 0.1f);
+  CHECK(feed(1, 30*QUIET, 0, 0) == 1);
+  // the room gets 10 dB louder: the floor rises once the last quiet frame
+  // has left the window, and the activity ends a hangover later
+  feed(VAD_HANGOVER + 10, QUIET, 0, 0);
+  Vad_SetFlatness(&V, 0);
+  frames = feed(200, QUIET*sqrt(10.0), 0, 0);
+  CHECK(Active[0] && !Active[199]);
+  CHECK(frames >= VAD_FLOORSUBS*VAD_FLOORSUBLEN);
+  CHECK(frames <= (VAD_FLOORSUBS + 1)*VAD_FLOORSUBLEN + VAD_HANGOVER);
+  CHECK(V.floor == VAD_FLOORMAX);  // 25 dB, above it but by less than VAD_MARGIN
+  // and quiet again, the floor is back down in one frame
+  CHECK(feed(5, QUIET, 0, 0) == 0);
+  CHECKNEAR(V.floor, quietFloor, 0.5);
+  CHECK(V.frames == Time/FRAME);
+  // a steady tone outlasting the window stays active, the floor stops at
+  // VAD_FLOORMAX below it
+  CHECK(feed(200, QUIET, 300, 1000) == 200);
+  CHECK(V.floor == VAD_FLOORMAX);
+  // a tone playing from boot is active from the first frame
+  Vad_Init(&V, FRAME);
+  CHECK(feed(200, QUIET, 300, 1000) == 200);
+  CHECK(V.floor == VAD_FLOORMAX);
+  CHECK(V.activeFrames == 200);
+  Test_Exit();
+  return 0;
+}
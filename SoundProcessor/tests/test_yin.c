@@ -0,0 +1,156 @@
+//*****************************************************************************
+// test_yin.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the pitch tracker of yin.c with the rate and rfft of user.c: the
+// difference function through the rfft is the one summed directly, tones
+// over the pitch range are found at their frequency to 0.25 Hz and voiced,
+// harmonics as strong as 1/h to 0.5 Hz up to 500 Hz, a sound with no
+// fundamental or a strong second harmonic is found at its period and not an
+// octave off, noise and silence are not voiced, and what Yin_Compute costs
+// on the host.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include "test.h"
+#include "os.h"
+#include "yin.h"
+
+#define FS     64000         // as user.c
+#define AMP    1000.0
+#define LENGTH 1024          // samples a frame, as user.c
+#define RUNS   2000          // Yin_Compute calls timed
+
+static yinType Y;
+static arm_rfft_fast_instance_f32 Fft;
+static float32_t BufA[2*YIN_LENGTH], BufB[2*YIN_LENGTH];
+static uint32_t Time;
+
+// a sum of harmonics of f0, amp[h] the amplitude of harmonic h, for one
+// frame of history
+static void feed(double f0, const double *amp, uint32_t numHarm){
+  uint32_t n, h;
+  double x;
+  for(n = 0; n < YIN_LENGTH*YIN_DECIMATE; n++){
+    x = 0;
+    for(h = 1; h <= numHarm; h++){
+      x += amp[h]*sin(2*M_PI*h*f0*Time/FS + h);
+    }
+    Yin_Update(&Y, (float32_t)x);
+    Time++;
+  }
+}
+
+// largest difference of d' from the definitions summed directly over the
+// window Yin_Compute took
+static double direct(void){
+  double x[YIN_LENGTH], mean = 0, d, sum = 0, worst = 0;
+  uint32_t j, tau;
+  for(j = 0; j < YIN_LENGTH; j++){
+    x[j] = Y.ring[(Y.pos + j)%YIN_LENGTH];
+    mean += x[j]/YIN_LENGTH;
+  }
+  for(j = 0; j < YIN_LENGTH; j++){
+    x[j] -= mean;
+  }
+  for(tau = 1; tau <= Y.tauMax; tau++){
+    d = 0;
+    for(j = 0; j + tau < YIN_LENGTH; j++){
+      d += (x[j] - x[j + tau])*(x[j] - x[j + tau]);
+    }
+    d = d/(YIN_LENGTH - tau);
+    sum += d;
+    if(fabs(d*tau/sum - BufB[tau]) > worst){
+      worst = fabs(d*tau/sum - BufB[tau]);
+    }
+  }
+  return worst;
+}
+
+int main(void){
+  double amp[9] = {0}, f, worst = 0, worstCmnd = 0, t;
+  uint32_t i, h, voiced;
+  rfft_fast_init_1024_f32(&Fft);
+  CHECK(Yin_Init(&Y, 8000) == 0);      // 1 kHz decimated, no lag for YIN_MAXHZ
+  CHECK(Yin_Init(&Y, 4*FS) == 0);      // the longest lag past half the frame
+  CHECK(Yin_Init(&Y, FS));
+  // silence
+  CHECK(Yin_Compute(&Y, &Fft, BufA, BufB) == 0);
+  CHECK(Y.voiced == 0);
+  // tones over the range, log spaced between bins of nothing in particular
+  amp[1] = AMP;
+  for(i = 0; i < 12; i++){
+    f = YIN_MINHZ*1.1*pow(YIN_MAXHZ/YIN_MINHZ/1.2, i/11.0);
+    feed(f, amp, 1);
+    Yin_Compute(&Y, &Fft, BufA, BufB);
+    CHECK(Y.voiced);
+    CHECK(Y.confidence > 0.9);     // the least between the short lags
+    if(fabs(Y.pitch - f) > worst){
+      worst = fabs(Y.pitch - f);
+    }
+    if(direct() > worstCmnd){
+      worstCmnd = direct();
+    }
+  }
+  CHECK(worst < 0.25);
+  CHECK(worstCmnd < 1e-3);
+  // C6 and E6, 6 to 8 lags, where a parabola was 3 Hz off, at a few phases
+  for(i = 0; i < 8; i++){
+    feed(1046.5, amp, 1);
+    CHECKNEAR(Yin_Compute(&Y, &Fft, BufA, BufB), 1046.5, 0.25);
+    feed(1318.5, amp, 1);
+    CHECKNEAR(Yin_Compute(&Y, &Fft, BufA, BufB), 1318.5, 0.25);
+  }
+  // harmonics 1/h up to the fourth, to 500 Hz
+  for(h = 2; h <= 4; h++){
+    amp[h] = AMP/h;
+  }
+  worst = 0;
+  for(i = 0; i < 12; i++){
+    f = YIN_MINHZ*1.1*pow(500/YIN_MINHZ/1.1, i/11.0);
+    feed(f, amp, 4);
+    Yin_Compute(&Y, &Fft, BufA, BufB);
+    if(fabs(Y.pitch - f) > worst){
+      worst = fabs(Y.pitch - f);
+    }
+  }
+  CHECK(worst < 0.5);
+  // harmonics 2 to 6 of 180 Hz and no fundamental: the period is 180 Hz's
+  amp[1] = 0;
+  for(h = 2; h <= 6; h++){
+    amp[h] = AMP/h;
+  }
+  feed(180, amp, 6);
+  Yin_Compute(&Y, &Fft, BufA, BufB);
+  CHECK(Y.voiced);
+  CHECKNEAR(Y.pitch, 180, 1);
+  // a second harmonic twice the fundamental, not an octave up
+  amp[1] = AMP/2;
+  amp[2] = AMP;
+  feed(220, amp, 2);
+  Yin_Compute(&Y, &Fft, BufA, BufB);
+  CHECKNEAR(Y.pitch, 220, 1);
+  CHECK(direct() < 1e-3);
+  // white noise is not voiced
+  voiced = 0;
+  for(i = 0; i < 10; i++){
+    for(h = 0; h < YIN_LENGTH*YIN_DECIMATE; h++){
+      Yin_Update(&Y, (float32_t)((int32_t)(Test_Random()%2001) - 1000));
+    }
+    voiced += Yin_Compute(&Y, &Fft, BufA, BufB) != 0;
+    CHECK(Y.confidence < 0.5);
+  }
+  CHECK(voiced == 0);
+  // the cost of a call, well inside a frame period even on a slow host
+  feed(440, amp, 1);
+  t = Test_Seconds();
+  for(i = 0; i < RUNS; i++){
+    Yin_Compute(&Y, &Fft, BufA, BufB);
+  }
+  t = (Test_Seconds() - t)/RUNS;
+  printf("Yin_Compute: %.2f us a call on this host, %.3f%% of a frame period\n",
+         1e6*t, 100*t*FS/LENGTH);
+  CHECK(t < 0.05*LENGTH/FS);
+  Test_Exit();
+  return 0;
+}
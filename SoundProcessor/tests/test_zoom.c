@@ -0,0 +1,169 @@
+//*****************************************************************************
+// test_zoom.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Tests of the zoom FFT of zoomfft.c with the parameters of user.c: a tone
+// shows in the bin of its frequency at the level of its amplitude, two
+// tones a few bins apart are resolved, a tone outside the span does not
+// alias into it, neither does one where stage 1 folds the band onto the
+// span, about 2*span away, the level holds over a long run, and no
+// spectrum comes while the buffer is detached.
+
+#include <stdint.h>
+#include <math.h>
+#include "test.h"
+#include "zoomfft.h"
+
+#define FS     64000         // as user.c
+#define CENTER 400
+#define SPAN   256
+#define LENGTH 256
+#define AMP    100.0         // tone amplitude
+#define REJECT 55            // dB, stage 1 images below a tone where they land
+
+static float32_t Buf[2*LENGTH];
+static float32_t dB[LENGTH];
+static uint32_t Time;        // samples fed since the start
+
+struct tone{
+  double f, a;
+};
+
+// feed tones until a spectrum is ready, return the number fed
+static uint32_t run(zoomfftType *z, const struct tone *t, uint32_t n){
+  uint32_t k, fed = 0;
+  double x;
+  while(ZoomFFT_Magnitude(z, dB) == 0){
+    for(k = 0, x = 0; k < n; k++){
+      x += t[k].a*cos(2*M_PI*t[k].f*Time/FS);
+    }
+    ZoomFFT_Update(z, (float32_t)x);
+    Time++;
+    fed++;
+    if(fed > 10*FS){
+      break;                   // never ready
+    }
+  }
+  return fed;
+}
+
+static double binHz(uint32_t i){
+  return CENTER - SPAN/2 + (double)i*SPAN/LENGTH;
+}
+
+// strongest bin from lo to hi-1
+static uint32_t peak(uint32_t lo, uint32_t hi){
+  uint32_t i, best = lo;
+  for(i = lo; i < hi; i++){
+    if(dB[i] > dB[best]){
+      best = i;
+    }
+  }
+  return best;
+}
+
+// frequency of a peak by parabolic interpolation of the dB levels
+static double interpolate(uint32_t i){
+  double a = dB[i-1], b = dB[i], c = dB[i+1];
+  return binHz(i) + 0.5*(a - c)/(a - 2*b + c)*SPAN/LENGTH;
+}
+
+int main(void){
+  zoomfftType z;
+  struct tone t[2];
+  uint32_t i, k, fed;
+  // from the centre: the nearest images of stage 1, 1.5 to 1.65 spans
+  // away, on either side, further into the first and second images
+  const double image[] = {390, 400, 420, -390, -420, 600, 900, 1100};
+  double level, ref, worst, alias;
+  CHECK(ZoomFFT_Init(&z, FS, CENTER, SPAN, 100) == 0);   // not a power of 2
+  CHECK(ZoomFFT_Init(&z, FS, CENTER, SPAN, 512) == 0);   // too long
+  CHECK(ZoomFFT_Init(&z, FS, CENTER, 0, LENGTH) == 0);
+  CHECK(ZoomFFT_Init(&z, FS, FS/2, SPAN, LENGTH) == 0);
+  CHECK(ZoomFFT_Init(&z, FS, CENTER, FS/10, LENGTH) == 0);   // decimate by 5, less than the order
+  CHECK(ZoomFFT_Init(&z, FS, CENTER, 31, LENGTH) == 0);      // by 1032
+  CHECK(ZoomFFT_Init(&z, FS, CENTER, 260, LENGTH));      // rounded
+  CHECK(z.decimation == 123);
+  CHECKNEAR(z.span, FS/246.0, 1e-3);
+  CHECK(ZoomFFT_Init(&z, FS, CENTER, SPAN, LENGTH));
+  CHECK(z.decimation == FS/(2*SPAN));
+  // detached, nothing is collected
+  t[0].f = CENTER + 20;
+  t[0].a = AMP;
+  for(i = 0; i < 2*FS; i++){
+    ZoomFFT_Update(&z, (float32_t)(AMP*cos(2*M_PI*t[0].f*i/FS)));
+  }
+  CHECK(ZoomFFT_Magnitude(&z, dB) == 0);
+  CHECK(z.count == 0);
+  // a tone on a bin, at the level of a Hann windowed complex tone of A/2
+  ZoomFFT_Attach(&z, Buf);
+  fed = run(&z, t, 1);           // the filters settled while detached
+  CHECK(fed == 2*LENGTH*z.decimation);
+  k = peak(0, LENGTH);
+  CHECK(binHz(k) == t[0].f);
+  ref = 20*log10(AMP/2*LENGTH/2);
+  CHECKNEAR(dB[k], ref, 0.2);
+  CHECKNEAR(dB[k-1], ref - 6.02, 0.2);   // the Hann window's neighbours
+  CHECK(dB[k-3] < ref - 60);             // and nothing further out
+  // off a bin, between two
+  t[0].f = CENTER - 51.3;
+  run(&z, t, 1);
+  run(&z, t, 1);                 // the first spectrum spans the change
+  k = peak(0, LENGTH);
+  CHECKNEAR(interpolate(k), t[0].f, 0.1);
+  CHECK(dB[k] > ref - 1.5);      // Hann scalloping
+  // two tones 3 bins apart, 20 dB apart, both resolved
+  t[0].f = CENTER + 60;
+  t[1].f = CENTER + 63;
+  t[1].a = AMP/10;
+  run(&z, t, 2);
+  run(&z, t, 2);
+  k = peak(0, LENGTH);
+  CHECK(binHz(k) == t[0].f);
+  i = peak(k + 2, LENGTH);
+  CHECK(binHz(i) == t[1].f);
+  CHECKNEAR(dB[i], ref - 20, 0.5);
+  CHECK((dB[i] > dB[i-1] + 3) && (dB[i] > dB[i+1] + 3)); // a peak of its own
+  // a tone outside the span would alias into it without the filters
+  t[0].f = CENTER + 0.8*SPAN;    // aliases to CENTER - 0.2*SPAN
+  run(&z, t, 1);
+  run(&z, t, 1);
+  level = dB[peak(0, LENGTH)];
+  CHECK(level < ref - 50);
+  // tones where stage 1 folds the band onto the span, 2*span apart, each
+  // against a tone in the span at the frequency its image lands on
+  worst = -200;
+  for(i = 0; i < sizeof(image)/sizeof(image[0]); i++){
+    alias = image[i] - 2*SPAN*floor(image[i]/(2*SPAN) + 0.5);
+    t[0].f = CENTER + alias;
+    run(&z, t, 1);
+    run(&z, t, 1);
+    k = (uint32_t)(alias + SPAN/2);  // the bin it lands in
+    CHECK(peak(0, LENGTH) == k);
+    level = dB[k];
+    t[0].f = CENTER + image[i];
+    run(&z, t, 1);
+    run(&z, t, 1);
+    if(dB[peak(0, LENGTH)] - level > worst){
+      worst = dB[peak(0, LENGTH)] - level;
+    }
+  }
+  CHECK(worst < -REJECT);
+  // a long run, the oscillator stays on the unit circle
+  t[0].f = CENTER + 20;
+  worst = 0;
+  for(i = 0; i < 30; i++){
+    run(&z, t, 1);
+    k = peak(0, LENGTH);
+    if(fabs(dB[k] - ref) > worst){
+      worst = fabs(dB[k] - ref);
+    }
+  }
+  CHECK(worst < 0.2);
+  // detached part way, the next spectrum is all new samples
+  ZoomFFT_Attach(&z, 0);
+  CHECK(ZoomFFT_Magnitude(&z, dB) == 0);
+  ZoomFFT_Attach(&z, Buf);
+  CHECK(run(&z, t, 1) == 2*LENGTH*z.decimation);
+  Test_Exit();
+  return 0;
+}
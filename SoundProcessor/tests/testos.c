@@ -0,0 +1,51 @@
+//*****************************************************************************
+// testos.c
+// Runs on a Linux or other POSIX host, not on the TM4C123
+// Helpers for the tests of the OS on the host port, with the Host_Tick and
+// Host_Exit that sim.c gives the port in a simulation.
+
+#include <stdint.h>
+#include <string.h>
+#include "test.h"
+#include "host.h"
+#include "os.h"
+#include "BSP.h"
+
+const char *Test_Expect;
+void (*Test_Final)(const char *reason);
+void (*Test_Tick)(void);
+int32_t Never;               // semaphore nobody signals
+
+static void block(void){
+  while(1){
+    OS_Wait(&Never);
+  }
+}
+
+void Test_Launch(void(*task0)(void), void(*task1)(void), void(*task2)(void)){
+  OS_InitSemaphore(&Never, 0);
+  OS_AddThreads(task0 ? task0 : block, task1 ? task1 : block, task2 ? task2 : block);
+  OS_Launch(TEST_SLICE);
+}
+
+void Test_Sleep(uint32_t ticks){
+  uint32_t flags = 0;          // on this thread's own stack
+  OS_FlagsWait(&flags, 1, OS_FLAGS_ANY, 1, ticks);
+}
+
+// the tests look at the OS from their threads, or count the ticks taken
+void Host_Tick(void){
+  if(Test_Tick){
+    Test_Tick();
+  }
+}
+
+void Host_Exit(const char *reason, int status){
+  if((Test_Expect == 0) || (strcmp(reason, Test_Expect) != 0)){
+    Test_Check(0, reason, __FILE__, __LINE__);
+  }
+  if(Test_Final){
+    Test_Final(reason);
+  }
+  Test_Exit();
+}
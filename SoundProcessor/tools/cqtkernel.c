@@ -0,0 +1,261 @@
+//*****************************************************************************
+// cqtkernel.c
+// Runs on the host PC, not on the TM4C123
+// Generates the sparse spectral kernels of the constant-Q transform in
+// cqt.c as C source for flash, and checks them before writing anything.
+
+// Build:  gcc -O2 -o cqtkernel cqtkernel.c -lm
+// Usage:  cqtkernel [-fs Hz] [-n length] [-bpo bins] [-fmin Hz] [-fmax Hz]
+//                   [-thr ratio] [-name Name]
+//         cqtkernel > ../src/cqt_kernel.c                 24 bins per octave, 1 to 16 kHz
+//         cqtkernel -bpo 12 -fmin 500 > ../src/cqt_kernel.c
+// Bin k is centred on fmin*2^(k/bpo) for every such frequency below fmax,
+// Q = 1/(2^(1/bpo) - 1). Its temporal kernel is a Hann window of
+// length Q*fs/f (at most n) times exp(j*2*pi*f*t), normalized to unit sum and
+// centred in the frame; the spectral kernel is the conjugate of its DFT,
+// cut to the contiguous run of bins at least thr times its largest
+// magnitude. The accuracy check computes every bin of a set of test frames
+// both as the exact inner product with the temporal kernel and the way
+// Cqt_Compute() does, from the DFT and the float sparse kernels, and
+// reports the largest difference relative to the largest bin of the frame.
+// Nothing is written if it is above MAXERRDB.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#define MAXN      4096     // longest frame
+#define MAXBINS   128      // must match CQT_MAXBINS
+#define MAXCOEFFS 16384    // complex coefficients over all bins
+#define MAXERRDB  -40.0    // worst accepted error relative to the frame's largest bin
+#define TESTS     64       // random test frames, in addition to one tone per bin
+
+struct bin{
+  double freq;
+  int length;              // temporal kernel length in samples
+  int start, count, offset;
+};
+struct bin Bins[MAXBINS];
+int NumBins;
+float Coeffs[2*MAXCOEFFS];
+int NumCoeffs;
+double Fs = 64000;
+int N = 1024;
+double Cosine[MAXN], Sine[MAXN]; // one period in N steps
+
+static void fail(const char *msg, const char *arg){
+  fprintf(stderr, "cqtkernel: %s %s\n", msg, arg);
+  exit(1);
+}
+
+// temporal kernel of bin b over the whole frame, zero outside the window
+static void temporal(const struct bin *b, double *re, double *im){
+  int n, m, n0 = (N - b->length)/2;
+  double sum = 0, w;
+  for(m = 0; m < b->length; m++){
+    sum += 0.5 - 0.5*cos(2*M_PI*m/(b->length - 1));
+  }
+  for(n = 0; n < N; n++){
+    re[n] = 0;
+    im[n] = 0;
+  }
+  for(m = 0; m < b->length; m++){
+    w = (0.5 - 0.5*cos(2*M_PI*m/(b->length - 1)))/sum;
+    re[n0 + m] = w*cos(2*M_PI*b->freq*m/Fs);
+    im[n0 + m] = w*sin(2*M_PI*b->freq*m/Fs);
+  }
+}
+
+// DFT of a complex sequence, bins 0 to count-1
+static void dft(const double *xr, const double *xi, double *Xr, double *Xi, int count){
+  int j, n, i;
+  for(j = 0; j < count; j++){
+    Xr[j] = 0;
+    Xi[j] = 0;
+    for(n = 0, i = 0; n < N; n++, i = (i + j)%N){
+      Xr[j] += xr[n]*Cosine[i] + xi[n]*Sine[i];
+      Xi[j] += xi[n]*Cosine[i] - xr[n]*Sine[i];
+    }
+  }
+}
+
+static void build(double thr){
+  static double tr[MAXN], ti[MAXN], Tr[MAXN], Ti[MAXN];
+  double largest, m;
+  int k, j, first, last;
+  NumCoeffs = 0;
+  for(k = 0; k < NumBins; k++){
+    temporal(&Bins[k], tr, ti);
+    dft(tr, ti, Tr, Ti, N);
+    largest = 0;
+    for(j = 0; j < N; j++){
+      m = hypot(Tr[j], Ti[j]);
+      if(m > largest){
+        largest = m;
+      }
+    }
+    first = -1;
+    last = -1;
+    for(j = 1; j < N/2; j++){
+      if(hypot(Tr[j], Ti[j]) >= thr*largest){
+        if(first < 0){
+          first = j;
+        }
+        last = j;
+      }
+    }
+    if(first < 0){
+      fail("kernel outside the spectrum at", "fmin/fmax");
+    }
+    if(NumCoeffs + last - first + 1 > MAXCOEFFS){
+      fail("too many coefficients, raise", "-thr");
+    }
+    Bins[k].start = first;
+    Bins[k].count = last - first + 1;
+    Bins[k].offset = NumCoeffs;
+    for(j = first; j <= last; j++){ // conjugate, scaled by N so a tone reads as its FFT peak
+      Coeffs[2*NumCoeffs] = (float)Tr[j];
+      Coeffs[2*NumCoeffs + 1] = (float)-Ti[j];
+      NumCoeffs++;
+    }
+  }
+}
+
+// worst error of the sparse float kernels over one frame, dB re largest bin
+static double check(const double *x){
+  static double zero[MAXN], Xr[MAXN], Xi[MAXN], tr[MAXN], ti[MAXN];
+  double er, ei, re, im, worst = 0, largest = 0, exact[2*MAXBINS];
+  float xf[2*MAXN], sr, si;
+  const float *w, *s;
+  int k, n, j;
+  dft(x, zero, Xr, Xi, N/2);
+  for(j = 0; j < N/2; j++){ // rfft output rounded to float as on the board
+    xf[2*j] = (float)Xr[j];
+    xf[2*j + 1] = (float)Xi[j];
+  }
+  for(k = 0; k < NumBins; k++){
+    temporal(&Bins[k], tr, ti);
+    er = 0;
+    ei = 0;
+    for(n = 0; n < N; n++){ // N times the inner product with the kernel
+      er += N*x[n]*tr[n];
+      ei -= N*x[n]*ti[n];
+    }
+    exact[2*k] = er;
+    exact[2*k + 1] = ei;
+    if(hypot(er, ei) > largest){
+      largest = hypot(er, ei);
+    }
+  }
+  for(k = 0; k < NumBins; k++){ // same arithmetic as Cqt_Compute()
+    s = &xf[2*Bins[k].start];
+    w = &Coeffs[2*Bins[k].offset];
+    sr = 0;
+    si = 0;
+    for(j = 0; j < Bins[k].count; j++){
+      sr += s[2*j]*w[2*j] - s[2*j + 1]*w[2*j + 1];
+      si += s[2*j]*w[2*j + 1] + s[2*j + 1]*w[2*j];
+    }
+    re = sr - exact[2*k];
+    im = si - exact[2*k + 1];
+    if(hypot(re, im) > worst){
+      worst = hypot(re, im);
+    }
+  }
+  return 20*log10(worst/largest + 1e-12);
+}
+
+int main(int argc, char **argv){
+  const char *name = "CqtKernel";
+  static double x[MAXN];
+  double bpo = 24, fmin = 1000, fmax = 16000, thr = 0.002, q, e, worst = -300;
+  int i, k, n;
+  for(i = 1; i < argc; i++){
+    if((strcmp(argv[i], "-fs") == 0) && (i + 1 < argc)){
+      Fs = atof(argv[++i]);
+    }else if((strcmp(argv[i], "-n") == 0) && (i + 1 < argc)){
+      N = atoi(argv[++i]);
+    }else if((strcmp(argv[i], "-bpo") == 0) && (i + 1 < argc)){
+      bpo = atof(argv[++i]);
+    }else if((strcmp(argv[i], "-fmin") == 0) && (i + 1 < argc)){
+      fmin = atof(argv[++i]);
+    }else if((strcmp(argv[i], "-fmax") == 0) && (i + 1 < argc)){
+      fmax = atof(argv[++i]);
+    }else if((strcmp(argv[i], "-thr") == 0) && (i + 1 < argc)){
+      thr = atof(argv[++i]);
+    }else if((strcmp(argv[i], "-name") == 0) && (i + 1 < argc)){
+      name = argv[++i];
+    }else{
+      fail("unknown option", argv[i]);
+    }
+  }
+  if((N < 16) || (N > MAXN) || (N & (N - 1))){
+    fail("length must be a power of 2 up to", "4096");
+  }
+  if((bpo < 1) || (fmin <= 0) || (fmax <= fmin) || (fmax >= Fs/2)){
+    fail("bad frequency range", "");
+  }
+  for(i = 0; i < N; i++){
+    Cosine[i] = cos(2*M_PI*i/N);
+    Sine[i] = sin(2*M_PI*i/N);
+  }
+  q = 1/(pow(2, 1/bpo) - 1);
+  NumBins = 0;
+  while(fmin*pow(2, NumBins/bpo) < fmax){
+    if(NumBins == MAXBINS){
+      fail("too many bins, the limit is", "128");
+    }
+    Bins[NumBins].freq = fmin*pow(2, NumBins/bpo);
+    Bins[NumBins].length = (int)(q*Fs/Bins[NumBins].freq + 0.5);
+    if(Bins[NumBins].length > N){
+      Bins[NumBins].length = N;
+    }
+    NumBins++;
+  }
+  build(thr);
+  // a tone at every bin centre, then random frames
+  srand(1);
+  for(k = 0; k < NumBins + TESTS; k++){
+    for(n = 0; n < N; n++){
+      x[n] = (k < NumBins) ? 1000*cos(2*M_PI*Bins[k].freq*n/Fs + 0.3*k)
+                           : (rand()%4096) - 2048.0;
+    }
+    e = check(x);
+    if(e > worst){
+      worst = e;
+    }
+  }
+  fprintf(stderr, "cqtkernel: %d bins, Q %.1f, full Q above %.0f Hz, %d coefficients (%d bytes), worst error %.1f dB\n",
+          NumBins, q, q*Fs/N, NumCoeffs, 8*NumCoeffs, worst);
+  if(worst > MAXERRDB){
+    fail("kernels too inaccurate, lower", "-thr");
+  }
+  printf("//*****************************************************************************\n");
+  printf("// cqt_kernel.c\n");
+  printf("// Generated by tools/cqtkernel.c, do not edit\n//");
+  for(i = 1; i < argc; i++){
+    printf(" %s", argv[i]);
+  }
+  printf("\n// %d bins, %.0f per octave from %.1f Hz, Q %.2f, worst error %.1f dB\n",
+         NumBins, bpo, fmin, q, worst);
+  printf("\n#include <stdint.h>\n#include \"cqt.h\"\n\n");
+  printf("static const float32_t %s_Coeffs[%d] = {\n", name, 2*NumCoeffs);
+  for(k = 0; k < 2*NumCoeffs; k++){
+    printf("%s% .9ef,", (k%4 == 0) ? "  " : " ", Coeffs[k]);
+    if((k%4 == 3) || (k == 2*NumCoeffs - 1)){
+      printf("\n");
+    }
+  }
+  printf("};\n\n");
+  printf("static const cqtBinType %s_Bins[%d] = {\n", name, NumBins);
+  for(k = 0; k < NumBins; k++){
+    printf("  {%d, %d, %d, %.3ff},\n", Bins[k].start, Bins[k].count, Bins[k].offset, Bins[k].freq);
+  }
+  printf("};\n\n");
+  printf("const cqtKernelType %s = {\n  CQT_MAGIC,\n  %.1ff, // fs\n  %d, // length\n", name, Fs, N);
+  printf("  %.0f, // bins per octave\n  %d, // bins\n  %s_Bins,\n  %s_Coeffs\n};\n",
+         bpo, NumBins, name, name);
+  return 0;
+}
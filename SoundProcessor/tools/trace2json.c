@@ -0,0 +1,258 @@
+//*****************************************************************************
+// trace2json.c
+// Runs on the host PC, not on the TM4C123
+// Converts a Trace_Dump() capture from trace.c into the Chrome trace event
+// JSON format, for chrome://tracing or https://ui.perfetto.dev
+
+// Build:  gcc -O2 -o trace2json trace2json.c
+// Usage:  trace2json [-names t0,t1,t2] [-events e0,e1] trace.bin > trace.json
+//         stty -F /dev/ttyACM0 115200 raw -echo; cat /dev/ttyACM0 > trace.bin
+//         then press Button2 on the booster pack, wait a second and stop cat
+// Names default to the threads and periodic events of user.c, in the
+// order given to OS_AddThreads and OS_AddPeriodicEventThread.
+// Anything before the "TRC1" magic is skipped, so the capture may begin
+// with stray bytes. Cycle counts are unwrapped to 64 bits, which holds as
+// long as no two consecutive events are more than 2^32 cycles apart.
+// Lanes: SysTick shows the scheduler and, nested in it, each periodic event;
+// each thread and idle show when they ran, with semaphore and flag events as
+// instants; one frame lane per pipeline stage shows each frame from
+// TRACE_FRAME_START to TRACE_FRAME_END.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define MAGIC     0x31435254  // must match TRACE_MAGIC
+#define IDLE      255         // must match TRACE_IDLE
+#define MAXNAMES  8
+#define MAXSTAGES 3
+#define TID_TICK  1           // lane of the SysTick handler
+#define TID_IDLE  2
+#define TID_THREAD 10         // + thread index
+#define TID_FRAME  20         // + stage
+// must match enum TraceType
+#define TICK        1
+#define SWITCH      2
+#define EVENT_ENTER 3
+#define EVENT_EXIT  4
+#define WAIT        5
+#define SIGNAL      6
+#define FLAGS_WAIT  7
+#define FLAGS_SET   8
+#define FRAME_START 9
+#define FRAME_END   10
+#define MARK        11
+
+char *ThreadNames[MAXNAMES] = {"Analyse", "Display", "Control"};
+char *EventNames[MAXNAMES] = {"Acquire", "Rates"};
+char *StageNames[MAXSTAGES] = {"Acquire", "Analyse", "Display"};
+int NumThreads = 3, NumEvents = 2;
+int First = 1;  // no comma before the first event
+
+static void fail(const char *msg, const char *arg){
+  fprintf(stderr, "trace2json: %s %s\n", msg, arg);
+  exit(1);
+}
+
+// split a comma separated list in place
+static int split(char *list, char **names){
+  int n = 0;
+  char *s = strtok(list, ",");
+  while(s && (n < MAXNAMES)){
+    names[n++] = s;
+    s = strtok(0, ",");
+  }
+  return n;
+}
+
+static uint32_t le32(const unsigned char *p){
+  return p[0] | (p[1]<<8) | (p[2]<<16) | ((uint32_t)p[3]<<24);
+}
+
+static int threadLane(int id){
+  return (id == IDLE) ? TID_IDLE : TID_THREAD + id;
+}
+
+static void comma(void){
+  printf(First ? "\n" : ",\n");
+  First = 0;
+}
+
+static void span(int tid, const char *name, double start, double end){
+  comma();
+  printf("{\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"name\":\"%s\",\"ts\":%.3f,\"dur\":%.3f}",
+         tid, name, start, end - start);
+}
+
+static void instant(int tid, const char *name, double t, unsigned arg){
+  comma();
+  printf("{\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"name\":\"%s\",\"ts\":%.3f,"
+         "\"args\":{\"arg\":\"0x%04x\"}}", tid, name, t, arg);
+}
+
+static void lane(int tid, const char *name){
+  comma();
+  printf("{\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_name\",\"args\":{\"name\":\"%s\"}}",
+         tid, name);
+  comma();
+  printf("{\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_sort_index\",\"args\":{\"sort_index\":%d}}",
+         tid, tid);
+}
+
+int main(int argc, char **argv){
+  const char *file = 0;
+  FILE *f;
+  unsigned char *buf, *r;
+  long size, pos;
+  uint32_t clock, n, k, stamp, last;
+  uint64_t cycles = 0;
+  double t, runStart = 0, tickStart = 0;
+  double eventStart[MAXNAMES], frameStart[MAXSTAGES];
+  int eventOpen[MAXNAMES] = {0}, frameOpen[MAXSTAGES] = {0};
+  int running = -1, inTick = 0, suspend = 0, i, id, type;
+  unsigned arg;
+  char name[64];
+  for(i = 1; i < argc; i++){
+    if((strcmp(argv[i], "-names") == 0) && (i + 1 < argc)){
+      NumThreads = split(argv[++i], ThreadNames);
+    }else if((strcmp(argv[i], "-events") == 0) && (i + 1 < argc)){
+      NumEvents = split(argv[++i], EventNames);
+    }else if((argv[i][0] != '-') && (file == 0)){
+      file = argv[i];
+    }else{
+      fail("unknown option", argv[i]);
+    }
+  }
+  if(file == 0){
+    fail("no capture file given", "");
+  }
+  f = fopen(file, "rb");
+  if(f == 0){
+    fail("cannot open", file);
+  }
+  fseek(f, 0, SEEK_END);
+  size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  buf = malloc(size + 1);
+  if((buf == 0) || (fread(buf, 1, size, f) != (size_t)size)){
+    fail("cannot read", file);
+  }
+  fclose(f);
+  for(pos = 0; pos + 12 <= size; pos++){
+    if(le32(&buf[pos]) == MAGIC){
+      break;
+    }
+  }
+  if(pos + 12 > size){
+    fail("no trace found in", file);
+  }
+  clock = le32(&buf[pos + 4]);
+  n = le32(&buf[pos + 8]);
+  if(clock == 0){
+    fail("bad clock frequency in", file);
+  }
+  if(pos + 12 + 8*(long)n > size){
+    n = (size - pos - 12)/8;
+    fprintf(stderr, "trace2json: capture cut short, %u records\n", n);
+  }
+  r = &buf[pos + 12];
+  last = (n > 0) ? le32(r) : 0;
+  printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+  comma();
+  printf("{\"ph\":\"M\",\"pid\":1,\"name\":\"process_name\",\"args\":{\"name\":\"SoundProcessor %u Hz\"}}", clock);
+  lane(TID_TICK, "SysTick");
+  lane(TID_IDLE, "Idle");
+  for(i = 0; i < NumThreads; i++){
+    lane(TID_THREAD + i, ThreadNames[i]);
+  }
+  for(i = 0; i < MAXSTAGES; i++){
+    sprintf(name, "Frames %s", StageNames[i]);
+    lane(TID_FRAME + i, name);
+  }
+  t = 0;
+  for(k = 0; k < n; k++, r += 8){
+    stamp = le32(r);
+    cycles += (uint32_t)(stamp - last); // DWT_CYCCNT wraps every 2^32 cycles
+    last = stamp;
+    t = 1e6*cycles/clock;               // microseconds since the first record
+    type = r[4];
+    id = r[5];
+    arg = r[6] | (r[7]<<8);
+    switch(type){
+      case TICK:
+        if(running >= 0){
+          span(threadLane(running), (running == IDLE) ? "idle" : "run", runStart, t);
+        }
+        running = -1;
+        inTick = 1;
+        suspend = (arg == 0);
+        tickStart = t;
+        break;
+      case SWITCH:
+        if(inTick){
+          span(TID_TICK, suspend ? "Suspend" : "Scheduler", tickStart, t);
+        }
+        inTick = 0;
+        running = id;
+        runStart = t;
+        break;
+      case EVENT_ENTER:
+        if(id < MAXNAMES){
+          eventStart[id] = t;
+          eventOpen[id] = 1;
+        }
+        break;
+      case EVENT_EXIT:
+        if((id < MAXNAMES) && eventOpen[id]){
+          if(id < NumEvents){
+            span(TID_TICK, EventNames[id], eventStart[id], t);
+          }else{
+            sprintf(name, "Event %d", id);
+            span(TID_TICK, name, eventStart[id], t);
+          }
+          eventOpen[id] = 0;
+        }
+        break;
+      case WAIT:
+        instant(threadLane(id), "OS_Wait blocked", t, arg);
+        break;
+      case SIGNAL:
+        instant((inTick || (running < 0)) ? TID_TICK : threadLane(running), "OS_Signal", t, arg);
+        break;
+      case FLAGS_WAIT:
+        instant(threadLane(id), "OS_FlagsWait blocked", t, arg);
+        break;
+      case FLAGS_SET:
+        instant((inTick || (running < 0)) ? TID_TICK : threadLane(running), "OS_FlagsSet", t, arg);
+        break;
+      case FRAME_START:
+        if(id < MAXSTAGES){
+          frameStart[id] = t;
+          frameOpen[id] = 1;
+        }
+        break;
+      case FRAME_END:
+        if((id < MAXSTAGES) && frameOpen[id]){ // an end without its start is skipped
+          sprintf(name, "frame %u", arg);
+          span(TID_FRAME + id, name, frameStart[id], t);
+          frameOpen[id] = 0;
+        }
+        break;
+      case MARK:
+        sprintf(name, "mark %d", id);
+        instant((inTick || (running < 0)) ? TID_TICK : threadLane(running), name, t, arg);
+        break;
+      default:
+        fprintf(stderr, "trace2json: unknown record type %d at %u\n", type, k);
+        break;
+    }
+  }
+  if(running >= 0){ // the thread running when the trace stopped
+    span(threadLane(running), (running == IDLE) ? "idle" : "run", runStart, t);
+  }
+  printf("\n]}\n");
+  fprintf(stderr, "trace2json: %u records, %.3f ms\n", n, t/1000);
+  free(buf);
+  return 0;
+}
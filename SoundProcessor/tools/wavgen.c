@@ -0,0 +1,127 @@
+//*****************************************************************************
+// wavgen.c
+// Runs on the host PC, not on the TM4C123
+// Writes synthetic test sounds as 16 bit mono PCM WAV files, for the host
+// simulator in host/ and for training the classifier with tools/nbtrain.c.
+
+// Build:  gcc -O2 -o wavgen wavgen.c -lm
+// Usage:  wavgen [-fs Hz] [-s seconds] [-on s] [-off s] [-seed n] sound out.wav
+//         wavgen -s 20 -on 0.3 -off 0.05 whistle:1000:4000 whistle.wav
+//         wavgen -s 20 -on 0.3 -off 0.05 buzz:100:400 buzz.wav
+// Sounds, frequencies in Hz:
+//   tone:f                one sine
+//   whistle:f1:f2         sine, a new random frequency in f1..f2 each burst
+//   buzz:f1:f2            band limited sawtooth, a new random fundamental
+//                         in f1..f2 each burst, harmonics up to 0.45 fs
+//   noise                 white noise
+// The sound is played in bursts of -on seconds with -off seconds of quiet
+// between them, the VAD in vad.c passes the bursts and the quiet between
+// them goes as background; -off 0 gives one continuous sound, which at
+// this level stays active. A little noise is
+// always added, about 50 dB below the sound, so quiet is not digital zero.
+// The default rate is the board's, 64000 Hz.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#define AMPLITUDE  8000.0  // peak of the sound, 16 bit full scale is 32767
+#define NOISE      25.0    // peak of the background noise
+#define FADE       0.005   // seconds of fade in and out of each burst
+
+double Fs = 64000;
+
+static void fail(const char *msg, const char *arg){
+  fprintf(stderr, "wavgen: %s %s\n", msg, arg);
+  exit(1);
+}
+
+// uniform in -1..1, a fixed generator so every host writes the same file
+static uint32_t Seed = 1;
+static double noise(void){
+  Seed = Seed*1664525 + 1013904223;
+  return (Seed>>8)/8388608.0 - 1;
+}
+
+static void put(FILE *f, uint32_t v, int n){
+  while(n--){
+    fputc(v & 0xFF, f);
+    v >>= 8;
+  }
+}
+
+int main(int argc, char **argv){
+  const char *sound = 0, *out = 0;
+  char kind[16];
+  double seconds = 3, on = 0.3, off = 0.2, f1 = 0, f2 = 0, f = 0, phase = 0, x, g, t;
+  uint32_t i, n, k, burst = (uint32_t)-1;
+  FILE *wav;
+  for(i = 1; i < (uint32_t)argc; i++){
+    if((strcmp(argv[i], "-fs") == 0) && (i + 1 < (uint32_t)argc)){
+      Fs = atof(argv[++i]);
+    }else if((strcmp(argv[i], "-s") == 0) && (i + 1 < (uint32_t)argc)){
+      seconds = atof(argv[++i]);
+    }else if((strcmp(argv[i], "-on") == 0) && (i + 1 < (uint32_t)argc)){
+      on = atof(argv[++i]);
+    }else if((strcmp(argv[i], "-off") == 0) && (i + 1 < (uint32_t)argc)){
+      off = atof(argv[++i]);
+    }else if((strcmp(argv[i], "-seed") == 0) && (i + 1 < (uint32_t)argc)){
+      Seed = (uint32_t)atol(argv[++i]);
+    }else if(argv[i][0] == '-'){
+      fail("unknown option", argv[i]);
+    }else if(sound == 0){
+      sound = argv[i];
+    }else{
+      out = argv[i];
+    }
+  }
+  if((sound == 0) || (out == 0) || (Fs < 1) || (on <= 0) || (off < 0)){
+    fail("usage: wavgen [-fs Hz] [-s seconds] [-on s] [-off s] [-seed n] sound out.wav", "");
+  }
+  if((sscanf(sound, "%15[a-z]:%lf:%lf", kind, &f1, &f2) < 1) ||
+     (strcmp(kind, "tone") && strcmp(kind, "whistle") && strcmp(kind, "buzz") && strcmp(kind, "noise"))){
+    fail("unknown sound", sound);
+  }
+  if(f2 < f1){
+    f2 = f1;
+  }
+  if((wav = fopen(out, "wb")) == 0){
+    fail("cannot write", out);
+  }
+  n = (uint32_t)(seconds*Fs);
+  fwrite("RIFF", 1, 4, wav); put(wav, 36 + 2*n, 4);
+  fwrite("WAVEfmt ", 1, 8, wav); put(wav, 16, 4);
+  put(wav, 1, 2); put(wav, 1, 2);            // PCM, mono
+  put(wav, (uint32_t)Fs, 4); put(wav, 2*(uint32_t)Fs, 4);
+  put(wav, 2, 2); put(wav, 16, 2);
+  fwrite("data", 1, 4, wav); put(wav, 2*n, 4);
+  for(i = 0; i < n; i++){
+    t = fmod(i/Fs, on + off);                // time into this burst
+    if((uint32_t)(i/Fs/(on + off)) != burst){ // a new burst picks its frequency
+      burst = (uint32_t)(i/Fs/(on + off));
+      f = f1 + (f2 - f1)*(noise() + 1)/2;
+    }
+    g = (t < on) ? 1 : 0;
+    if(off > 0){                             // fade, so the bursts do not click
+      g = g*fmin(1, fmin(t, on - t)/FADE);
+    }
+    x = 0;
+    if(strcmp(kind, "noise") == 0){
+      x = noise();
+    }else if(strcmp(kind, "buzz") == 0){
+      for(k = 1; k*f < 0.45*Fs; k++){        // sawtooth, 1/k harmonics
+        x += sin(k*phase)/k;
+      }
+      x = x*0.55;
+    }else{
+      x = sin(phase);
+    }
+    phase = fmod(phase + 2*M_PI*f/Fs, 2*M_PI);
+    x = AMPLITUDE*g*x + NOISE*noise();
+    put(wav, (uint32_t)(int16_t)lrint(fmax(-32768, fmin(32767, x))), 2);
+  }
+  fclose(wav);
+  return 0;
+}